@@ -7,7 +7,17 @@
 #include <math.h>
 #include <stddef.h>
 #include <errno.h>
+#include <wchar.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "axp.h"
 
@@ -69,69 +79,647 @@ static double axp__lnf_seed(const AXP_Float *x) {
     return log(mantissa) + (double)exp_part * log(10.0);
 }
 
-static double axp__float_to_double(const AXP_Float *x) {
-    axp_size_t take = x->size < 17 ? x->size : 17;
-    double mantissa = 0.0;
-    for (axp_size_t i = 0; i < take; i++) {
-        mantissa = mantissa * 10.0 + (double)x->digits[x->size - 1 - i];
+// ------- Binary floating point -------
+
+// g(k) = floor(10^-k * 2^(125 - floor(log2 10^-k))) + 1 for k in [AXP__POW10_K_MIN, AXP__POW10_K_MAX], stored as
+// { g >> 63, g mod 2^63 }. Schubfach reads it for double -> decimal and the Eisel-Lemire product for decimal -> double
+#define AXP__POW10_K_MIN (-324)
+#define AXP__POW10_K_MAX 343
+static const uint64_t axp__pow10_g[][2] = {
+    { 0x4F0CEDC95A718DD4, 0x5B01E8B09AA0D1B5 }, { 0x7E7B160EF71C1621, 0x119CA780F767B5EE },
+    { 0x652F44D8C5B011B4, 0x0E16EC672C52F7F2 }, { 0x50F29D7A37C00E29, 0x581256B8F0425FF5 },
+    { 0x40C21794F96671BA, 0x79A84560C0351991 }, { 0x679CF287F570B5F7, 0x75DA089ACD21C281 },
+    { 0x52E3F5399126F7F9, 0x44AE6D48A41B0201 }, { 0x424FF76140EBF994, 0x36F1F106E9AF34CD },
+    { 0x6A198BCECE465C20, 0x57E981A4A918547B }, { 0x54E13CA571D1E34D, 0x2CBACE1D541376C9 },
+    { 0x43E763B78E4182A4, 0x23C8A4E44342C56E }, { 0x6CA56C58E39C043A, 0x060DD4A06B9E08B0 },
+    { 0x56EABD13E9499CFB, 0x1E7176E6BC7E6D59 }, { 0x458897432107B0C8, 0x7EC12BEBC9FEBDE1 },
+    { 0x6F40F20501A5E7A7, 0x7E01DFDFA9979635 }, { 0x5900C19D9AEB1FB9, 0x4B34B319547944F7 },
+    { 0x4733CE17AF227FC7, 0x55C3C27AA9FA9D93 }, { 0x71EC7CF2B1D0CC72, 0x560603F7765DC8EA },
+    { 0x5B2397288E40A38E, 0x7804CFF92B7E3A55 }, { 0x48E945BA0B66E93F, 0x13370CC755FE9511 },
+    { 0x74A86F90123E41FE, 0x51F1AE0BBCCA881B }, { 0x5D538C7341CB67FE, 0x74C1580963D539AF },
+    { 0x4AA93D29016F8665, 0x43CDE0078310FAF3 }, { 0x77752EA8024C0A3C, 0x0616333F381B2B1E },
+    { 0x5F90F22001D66E96, 0x3811C298F9AF55B1 }, { 0x4C73F4E667DEBEDE, 0x600E35472E25DE28 },
+    { 0x7A532170A6313164, 0x3349EED849D6303F }, { 0x61DC1AC084F42783, 0x42A18BE03B11C033 },
+    { 0x4E49AF006A5CEC69, 0x1BB46FE695A7CCF5 }, { 0x7D42B19A43C7E0A8, 0x2C53E63DBC3FAE55 },
+    { 0x64355AE1CFD31A20, 0x237651CAFCFFBEAA }, { 0x502AAF1B0CA8E1B3, 0x35F8416F30CC9888 },
+    { 0x402225AF3D53E7C2, 0x5E603458F3D6E06D }, { 0x669D0918621FD937, 0x4A3386F4B957CD7B },
+    { 0x52173A79E8197A92, 0x6E8F9F2A2DDFD796 }, { 0x41AC2EC7ECE12EDB, 0x720C7F54F17FDFAB },
+    { 0x69137E0CAE3517C6, 0x1CE0CBBB1BFFCC45 }, { 0x540F980A24F74638, 0x171A3C95AFFFD69E },
+    { 0x433FACD4EA5F6B60, 0x127B63AAF3331218 }, { 0x6B991487DD657899, 0x6A5F05DE51EB5026 },
+    { 0x5614106CB11DFA14, 0x5518D17EA7EF7352 }, { 0x44DCD9F08DB194DD, 0x2A7A41321FF2C2A8 },
+    { 0x6E2E2980E2B5BAFB, 0x5D906850331E043F }, { 0x5824EE00B55E2F2F, 0x647386A68F4B3699 },
+    { 0x4683F19A2AB1BF59, 0x36C2D21ED908F87B }, { 0x70D31C29DDE93228, 0x579E1CFE280E5A5D },
+    { 0x5A427CEE4B20F4ED, 0x2C7E7D98200B7B7E }, { 0x483530BEA280C3F1, 0x09FECAE019A2C932 },
+    { 0x73884DFDD0CE064E, 0x43314499C29E0EB6 }, { 0x5C6D0B3173D8050B, 0x4F5A9D47CEE4D891 },
+    { 0x49F0D5C129799DA2, 0x72AEE4397250AD41 }, { 0x764E22CEA8C295D1, 0x377E39F583B44868 },
+    { 0x5EA4E8A553CEDE41, 0x12CB61913629D387 }, { 0x4BB72084430BE500, 0x756F8140F8217605 },
+    { 0x792500D39E796E67, 0x6F18CECE59CF233C }, { 0x60EA670FB1FABEB9, 0x3F470BD847D8E8FD },
+    { 0x4D885272F4C89894, 0x329F3CAD064720CA }, { 0x7C0D50B7EE0DC0ED, 0x37652DE1A3A50143 },
+    { 0x633DDA2CBE716724, 0x2C50F1814FB73436 }, { 0x4F64AE8A31F45283, 0x3D0D8E010C92902B },
+    { 0x7F077DA9E986EA6B, 0x7B48E334E0EA8045 }, { 0x659F97BB2138BB89, 0x49071C2A4D88669D },
+    { 0x514C796280FA2FA1, 0x20D27CEEA46D1EE4 }, { 0x4109FAB533FB594D, 0x670ECA58838A7F1D },
+    { 0x680FF788532BC216, 0x0B4ADD5A6C10CB62 }, { 0x533FF939DC2301AB, 0x22A24AAEBCDA3C4E },
+    { 0x4299942E49B59AEF, 0x354EA22563E1C9D8 }, { 0x6A8F537D42BC2B18, 0x554A9D089FCFA95A },
+    { 0x553F75FDCEFCEF46, 0x776EE406E63FBAAE }, { 0x4432C4CB0BFD8C38, 0x5F8BE99F1E996225 },
+    { 0x6D1E07AB466279F4, 0x327975CB64289D08 }, { 0x574B3955D1E86190, 0x28612B091CED4A6D },
+    { 0x45D5C777DB204E0D, 0x06B4226DB0BDD524 }, { 0x6FBC72595E9A167B, 0x24536A491AC95506 },
+    { 0x59638EADE54811FC, 0x1D0F883A7BD44405 }, { 0x4782D88B1DD34196, 0x4A72D361FCA9D004 },
+    { 0x726AF411C952028A, 0x43EAEBCFFAA94CD3 }, { 0x5B88C3416DDB353B, 0x4FEF230CC88770A9 },
+    { 0x493A35CDF17C2A96, 0x0CBF4F3D6D3926EE }, { 0x7529EFAFE8C6AA89, 0x61321862485B717C },
+    { 0x5DBB262653D22207, 0x675B46B506AF8DFD }, { 0x4AFC1E850FDB4E6C, 0x52AF6BC405593E64 },
+    { 0x77F9CA6E7FC54A47, 0x377F12D33BC1FD6D }, { 0x5FFB085866376E9F, 0x45FF42429634CABD },
+    { 0x4CC8D379EB5F8BB2, 0x6B329B68782A3BCB }, { 0x7ADAEBF64565AC51, 0x2B842BDA59DD2C77 },
+    { 0x6248BCC5045156A7, 0x3C69BCAEAE4A89F9 }, { 0x4EA0970403744552, 0x6387CA25583BA194 },
+    { 0x7DCDBE6CD253A21E, 0x05A6103BC05F68ED }, { 0x64A498570EA94E7E, 0x37B80CFC99E5ED8A },
+    { 0x5083AD1272210B98, 0x2C933D96E184BE08 }, { 0x40695741F4E73C79, 0x7075CADF1AD09807 },
+    { 0x670EF2032171FA5C, 0x4D8944982AE759A4 }, { 0x52725B35B45B2EB0, 0x3E076A135585E150 },
+    { 0x41F515C49048F226, 0x64D2BB42AAD1810D }, { 0x698822D41A0E503E, 0x07B7920444826815 },
+    { 0x546CE8A9AE71D9CB, 0x1FC60E69D0685344 }, { 0x438A53BAF1F4AE3C, 0x196B3EBB0D20429D },
+    { 0x6C1085F7E9877D2D, 0x0F11FDF815006A94 }, { 0x56739E5FEE05FDBD, 0x58DB319344005543 },
+    { 0x45294B7FF19E6497, 0x60AF5ADC3666AA9C }, { 0x6EA878CCB5CA3A8C, 0x344BC4938A3DDDC7 },
+    { 0x5886C70A2B082ED6, 0x5D096A0FA1CB17D2 }, { 0x46D238D4EF39BF12, 0x173ABB3FB4A27975 },
+    { 0x71505AEE4B8F981D, 0x0B912B992103F588 }, { 0x5AA6AF25093FACE4, 0x0940EFADB4032AD3 },
+    { 0x488558EA6DCC8A50, 0x07672624900288A9 }, { 0x74088E43E2E0DD4C, 0x723EA36DB337410E },
+    { 0x5CD3A5031BE71770, 0x5B654F8AF5C5CDA5 }, { 0x4A42EA68E31F45F3, 0x62B772D5916B0AEB },
+    { 0x76D1770E38320986, 0x0458B7BC1BDE77DD }, { 0x5F0DF8D82CF4D46B, 0x1D13C630164B9318 },
+    { 0x4C0B2D79BD90A9EF, 0x30DC9E8CDEA2DC13 }, { 0x79AB7BF5FC1AA97F, 0x0160FDAE31049351 },
+    { 0x6155FCC4C9AEEDFF, 0x1AB3FE24F403A90E }, { 0x4DDE63D0A158BE65, 0x6229981D9002EDA5 },
+    { 0x7C97061A9BC130A2, 0x69DC2695B337E2A1 }, { 0x63AC04E2163426E8, 0x54B01EDE28F9821B },
+    { 0x4FBCD0B4DE901F20, 0x43C018B1BA6134E2 }, { 0x7F9481216419CB67, 0x1F99C11C5D68549D },
+    { 0x6610674DE9AE3C52, 0x4C7B00E37DED107E }, { 0x51A6B90B21583042, 0x09FC00B5FE574065 },
+    { 0x41522DA2811359CE, 0x3B3000919845CD1D }, { 0x68837C3734EBC2E3, 0x784CCDB5C06FAE95 },
+    { 0x539C635F5D8968B6, 0x2D0A3E2B00595877 }, { 0x42E382B2B13ABA2B, 0x3DA1CB5599E11393 },
+    { 0x6B059DEAB52AC378, 0x629C7888F634EC1E }, { 0x559E17EEF755692D, 0x3549FA072B5D89B1 },
+    { 0x447E798BF91120F1, 0x1107FB38EF7E07C1 }, { 0x6D9728DFF4E834B5, 0x01A65EC17F300C68 },
+    { 0x57AC20B32A535D5D, 0x4E1EB23465C009ED }, { 0x46234D5C21DC4AB1, 0x24E55B5D1E333B24 },
+    { 0x70387BC69C93AAB5, 0x216EF894FD1EC506 }, { 0x59C6C96BB076222A, 0x4DF2607730E56A6C },
+    { 0x47D23ABC8D2B4E88, 0x3E5B805F5A5121F0 }, { 0x72E9F79415121740, 0x63C59A322A1B697F },
+    { 0x5BEE5FA9AA74DF67, 0x03047B5B54E2BACC }, { 0x498B7FBAEEC3E5EC, 0x0269FC4910B5623D },
+    { 0x75ABFF917E063CAC, 0x6A432D41B45569FB }, { 0x5E2332DACB38308A, 0x21CF5767C37787FC },
+    { 0x4B4F5BE23C2CF3A1, 0x67D912B9692C6CCA }, { 0x787EF969F9E185CF, 0x595B5128A8471476 },
+    { 0x60659454C7E79E3F, 0x6115DA86ED05A9F8 }, { 0x4D1E1043D31FB1CC, 0x4DAB1538BD9E2193 },
+    { 0x7B634D3951CC4FAD, 0x62AB552795C9CF52 }, { 0x62B5D7610E3D0C8B, 0x0222AA86116E3F75 },
+    { 0x4EF7DF80D830D6D5, 0x4E822204DABE992A }, { 0x7E59659AF38157BC, 0x17369CD49130F510 },
+    { 0x65145148C2CDDFC9, 0x5F5EE3DD40F3F740 }, { 0x50DD0DD3CF0B196E, 0x1918B64A9A5CC5CD },
+    { 0x40B0D7DCA5A27ABE, 0x4746F83BAEB09E3E }, { 0x678159610903F797, 0x253E59F91780FD2F },
+    { 0x52CDE11A6D9CC612, 0x50FEAE60DF9A6426 }, { 0x423E4DAEBE1704DB, 0x5A65584D7FAEB685 },
+    { 0x69FD4917968B3AF9, 0x10A226E265E4573B }, { 0x54CAA0DFABA29594, 0x0D4E8581EB1D1295 },
+    { 0x43D54D7FBC821143, 0x243ED134BC174211 }, { 0x6C887BFF94034ED2, 0x06CAE85460253682 },
+    { 0x56D396661002A574, 0x6BD586A9E6842B9B }, { 0x457611EB40021DF7, 0x09779EEE52035616 },
+    { 0x6F234FDECCD02FF1, 0x5BF297E3B66BBCEF }, { 0x58E90CB23D73598E, 0x165BACB62B8963F3 },
+    { 0x4720D6F4FDF5E13E, 0x451623C4EFA11CC2 }, { 0x71CE24BB2FEFCECA, 0x3B569FA17F682E03 },
+    { 0x5B0B5095BFF30BD5, 0x15DEE61ACC535803 }, { 0x48D5DA11665C0977, 0x2B18B8157042ACCF },
+    { 0x74895CE8A3C6758B, 0x5E8DF355806AAE18 }, { 0x5D3AB0BA1C9EC46F, 0x653E5C4466BBBE7A },
+    { 0x4A955A2E7D4BD059, 0x3765169D1EFC9861 }, { 0x77555D172EDFB3C2, 0x256E8A94FE60F3CF },
+    { 0x5F777DAC257FC301, 0x6ABED543FEB3F63F }, { 0x4C5F97BCEACC9C01, 0x3BCBDDCFFEF65E99 },
+    { 0x7A328C6177ADC668, 0x5FAC961997F0975B }, { 0x61C209E792F16B86, 0x7FBD44E1465A12AF },
+    { 0x4E34D4B9425ABC6B, 0x7FCA9D810514DBBF }, { 0x7D21545B9D5DFA46, 0x32DDC8CE6E87C5FF },
+    { 0x641AA9E2E44B2E9E, 0x5BE4A0A525396B32 }, { 0x501554B5836F587E, 0x7CB6E6EA842DEF5C },
+    { 0x4011109135F2AD32, 0x30925255368B25E3 }, { 0x6681B41B89844850, 0x4DB6EA21F0DEA304 },
+    { 0x52015CE2D469D373, 0x57C5881B2718826A }, { 0x419AB0B576BB0F8F, 0x5FD139AF527A01EF },
+    { 0x68F781225791B27F, 0x4C81F5E550C3364A }, { 0x53F9341B79415B99, 0x239B2B1DDA35C508 },
+    { 0x432DC3492DCDE2E1, 0x02E288E4AE916A6D }, { 0x6B7C6BA849496B01, 0x516A74A1174F10AE },
+    { 0x55FD22ED076DEF34, 0x4121F6E745D8DA25 }, { 0x44CA82573924BF5D, 0x1A8192529E4714EB },
+    { 0x6E10D08B8EA1322E, 0x5D9C1D50FD3E87DD }, { 0x580D73A2D880F4F2, 0x17B01773FDCB9FE4 },
+    { 0x4671294F139A5D8E, 0x4626792997D61984 }, { 0x70B50EE4EC2A2F4A, 0x3D0A5B75BFBCF59F },
+    { 0x5A2A7250BCEE8C3B, 0x4A6EAF916630C47F }, { 0x4821F50D63F209C9, 0x21F2260DEB5A36CC },
+    { 0x736988156CB6760E, 0x69837016455D247A }, { 0x5C546CDDF091F80B, 0x6E02C011D1175062 },
+    { 0x49DD23E4C074C66F, 0x719BCCDB0DAC404E }, { 0x762E9FD467213D7F, 0x68F947C4E2AD33B0 },
+    { 0x5E8BB3105280FDFF, 0x6D94396A4EF0F627 }, { 0x4BA2F5A6A8673199, 0x3E102DEEA58D91B9 },
+    { 0x7904BC3DDA3EB5C2, 0x3019E3176F48E927 }, { 0x60D09697E1CBC49B, 0x4014B5AC590720EC },
+    { 0x4D73ABACB4A303AF, 0x4CDD5E237A6C1A57 }, { 0x7BEC45E12104D2B2, 0x47C8969F2A46908A },
+    { 0x63236B1A80D0A88E, 0x6CA0787F5505406F }, { 0x4F4F88E200A6ED3F, 0x0A19F9FF773766BF },
+    { 0x7EE5A7D0010B1531, 0x5CF65CCBF1F23DFE }, { 0x6584864000D5AA8E, 0x172B7D6FF4C1CB32 },
+    { 0x5136D1CCCD77BBA4, 0x78EF978CC3CE3C28 }, { 0x40F8A7D70AC62FB7, 0x13F2DFA3CFD83020 },
+    { 0x67F43FBE77A37F8B, 0x398499061959E699 }, { 0x5329CC985FB5FFA2, 0x6136E0D1ADE18548 },
+    { 0x4287D6E04C91994F, 0x00F8B3DAF181376D }, { 0x6A72F166E0E8F54B, 0x1B27862B1C01F247 },
+    { 0x5528C11F1A53F76F, 0x2F52D1BC1667F506 }, { 0x44209A7F48432C59, 0x0C424163451FF738 },
+    { 0x6D00F7320D3846F4, 0x7A039BD208332526 }, { 0x5733F8F4D76038C3, 0x7B361641A028EA85 },
+    { 0x45C32D90AC4CFA36, 0x2F5E78348020BB9E }, { 0x6F9EAF4DE07B29F0, 0x4BCA59ED99CDF8FC },
+    { 0x594BBF71806287F3, 0x563B7B247B0B2D96 }, { 0x476FCC5ACD1B9FF6, 0x11C92F50626F57AC },
+    { 0x724C7A2AE1C5CCBD, 0x02DB7EE703E55912 }, { 0x5B7061BBE7D17097, 0x1BE2CBEC031DE0DC },
+    { 0x4926B496530DF3AC, 0x164F09899C17E716 }, { 0x750ABA8A1E7CB913, 0x3D4B4275C68CA4F0 },
+    { 0x5DA22ED4E530940F, 0x4AA29B916BA3B726 }, { 0x4AE825771DC07672, 0x6EE87C74561C9285 },
+    { 0x77D9D58B62CD8A51, 0x3173FA53BCFA8408 }, { 0x5FE177A2B5713B74, 0x278FFB7630C869A0 },
+    { 0x4CB45FB55DF42F90, 0x1FA662C4F3D387B3 }, { 0x7ABA32BBC986B280, 0x32A3D13B1FB8D91F },
+    { 0x622E8EFCA1388ECD, 0x0EE9742F4C93E0E6 }, { 0x4E8BA596E760723D, 0x58BAC3590A0FE71E },
+    { 0x7DAC3C24A5671D2F, 0x412AD228101971C9 }, { 0x6489C9B6EAB8E426, 0x00EF0E8673478E3B },
+    { 0x506E3AF8BBC71CEB, 0x1A58D86B8F6C71C9 }, { 0x40582F2D6305B0BC, 0x1513E0560C56C16E },
+    { 0x66F37EAF04D5E793, 0x3B530089AD579BE2 }, { 0x525C6558D0AB1FA9, 0x15DC006E2446164F },
+    { 0x41E384470D55B2ED, 0x5E4999F1B69E783F }, { 0x696C06D81555EB15, 0x7D428FE92430C065 },
+    { 0x54566BE0111188DE, 0x31020CBA835A3384 }, { 0x4378564CDA746D7E, 0x5A680A2ECF7B5C69 },
+    { 0x6BF3BD47C3ED7BFD, 0x770CDD17B25EFA42 }, { 0x565C976C9CBDFCCB, 0x1270B0DFC1E59502 },
+    { 0x4516DF8A16FE63D5, 0x5B8D5A4C9B1E10CE }, { 0x6E8AFF4357FD6C89, 0x127BC3ADC4FCE7B0 },
+    { 0x586F329C466456D4, 0x0EC96957D0CA52F3 }, { 0x46BF5BB038504576, 0x3F07877973D50F29 },
+    { 0x71322C4D26E6D58A, 0x31A5A58F1FBB4B75 }, { 0x5A8E89D75252446E, 0x5AEAEAD8E62F6F91 },
+    { 0x487207DF750E9D25, 0x2F22557A51BF8C74 }, { 0x73E9A63254E42EA2, 0x1836EF2A1C65AD86 },
+    { 0x5CBAEB5B771CF21B, 0x2CF8BF54E3848AD2 }, { 0x4A2F22AF927D8E7C, 0x23FA32AA4F9D3BDB },
+    { 0x76B1D118EA627D93, 0x5329EAAA18FB92F8 }, { 0x5EF4A74721E86476, 0x0F54BBBB472FA8C6 },
+    { 0x4BF6EC38E7ED1D2B, 0x25DD62FC38F2ED6C }, { 0x798B138E3FE1C845, 0x22FBD1938E517BDF },
+    { 0x613C0FA4FFE7D36A, 0x4F2FDADC71DAC97F }, { 0x4DC9A61D998642BB, 0x58F3157D27E23ACC },
+    { 0x7C75D695C2706AC5, 0x74B82261D969F7AD }, { 0x63917877CEC0556B, 0x10934EB4ADEE5FBE },
+    { 0x4FA793930BCD1122, 0x4075D8908B251965 }, { 0x7F7285B812E1B504, 0x00BC8DB411D4F56E },
+    { 0x65F537C675815D9C, 0x66FD3E29A7DD9125 }, { 0x5190F96B91344AE3, 0x6BFDCB54864ADA84 },
+    { 0x4140C78940F6A24F, 0x6FFE3C439EA2486A }, { 0x6867A5A867F103B2, 0x7FFD2D38FDD073DC },
+    { 0x53861E2053273628, 0x6664242D97D9F64A }, { 0x42D1B1B375B8F820, 0x51E9B68ADFE191D5 },
+    { 0x6AE91C5255F4C034, 0x1CA924116635B621 }, { 0x558749DB77F70029, 0x63BA83411E915E81 },
+    { 0x446C3B15F9926687, 0x6962029A7EDAB201 }, { 0x6D79F82328EA3DA6, 0x0F03375D97C45001 },
+    { 0x5794C6828721CAEB, 0x259C2C4ADFD04001 }, { 0x46109ECED2816F22, 0x5149BD08B30D0001 },
+    { 0x701A97B150CF1837, 0x3542C80DEB480001 }, { 0x59AEDFC10D7279C5, 0x7768A00B22A00001 },
+    { 0x47BF19673DF52E37, 0x79208008E8800001 }, { 0x72CB5BD86321E38C, 0x5B67334174000001 },
+    { 0x5BD5E313828182D6, 0x7C528F6790000001 }, { 0x4977E8DC68679BDF, 0x16A872B940000001 },
+    { 0x758CA7C70D7292FE, 0x5773EAC200000001 }, { 0x5E0A1FD271287598, 0x45F6556800000001 },
+    { 0x4B3B4CA85A86C47A, 0x04C5112000000001 }, { 0x785EE10D5DA46D90, 0x07A1B50000000001 },
+    { 0x604BE73DE4838AD9, 0x52E7C40000000001 }, { 0x4D0985CB1D3608AE, 0x0F1FD00000000001 },
+    { 0x7B426FAB61F00DE3, 0x31CC800000000001 }, { 0x629B8C891B267182, 0x5B0A000000000001 },
+    { 0x4EE2D6D415B85ACE, 0x7C08000000000001 }, { 0x7E37BE2022C0914B, 0x1340000000000001 },
+    { 0x64F964E68233A76F, 0x2900000000000001 }, { 0x50C783EB9B5C85F2, 0x5400000000000001 },
+    { 0x409F9CBC7C4A04C2, 0x1000000000000001 }, { 0x6765C793FA10079D, 0x0000000000000001 },
+    { 0x52B7D2DCC80CD2E4, 0x0000000000000001 }, { 0x422CA8B0A00A4250, 0x0000000000000001 },
+    { 0x69E10DE76676D080, 0x0000000000000001 }, { 0x54B40B1F852BDA00, 0x0000000000000001 },
+    { 0x43C33C1937564800, 0x0000000000000001 }, { 0x6C6B935B8BBD4000, 0x0000000000000001 },
+    { 0x56BC75E2D6310000, 0x0000000000000001 }, { 0x4563918244F40000, 0x0000000000000001 },
+    { 0x6F05B59D3B200000, 0x0000000000000001 }, { 0x58D15E1762800000, 0x0000000000000001 },
+    { 0x470DE4DF82000000, 0x0000000000000001 }, { 0x71AFD498D0000000, 0x0000000000000001 },
+    { 0x5AF3107A40000000, 0x0000000000000001 }, { 0x48C2739500000000, 0x0000000000000001 },
+    { 0x746A528800000000, 0x0000000000000001 }, { 0x5D21DBA000000000, 0x0000000000000001 },
+    { 0x4A817C8000000000, 0x0000000000000001 }, { 0x7735940000000000, 0x0000000000000001 },
+    { 0x5F5E100000000000, 0x0000000000000001 }, { 0x4C4B400000000000, 0x0000000000000001 },
+    { 0x7A12000000000000, 0x0000000000000001 }, { 0x61A8000000000000, 0x0000000000000001 },
+    { 0x4E20000000000000, 0x0000000000000001 }, { 0x7D00000000000000, 0x0000000000000001 },
+    { 0x6400000000000000, 0x0000000000000001 }, { 0x5000000000000000, 0x0000000000000001 },
+    { 0x4000000000000000, 0x0000000000000001 }, { 0x6666666666666666, 0x3333333333333334 },
+    { 0x51EB851EB851EB85, 0x0F5C28F5C28F5C29 }, { 0x4189374BC6A7EF9D, 0x5916872B020C49BB },
+    { 0x68DB8BAC710CB295, 0x74F0D844D013A92B }, { 0x53E2D6238DA3C211, 0x43F3E0370CDC8755 },
+    { 0x431BDE82D7B634DA, 0x698FE69270B06C44 }, { 0x6B5FCA6AF2BD215E, 0x0F4CA41D811A46D4 },
+    { 0x55E63B88C230E77E, 0x3F70834ACDAE9F10 }, { 0x44B82FA09B5A52CB, 0x4C5A02A23E254C0D },
+    { 0x6DF37F675EF6EADF, 0x2D5CD10396A21347 }, { 0x57F5FF85E592557F, 0x3DE3DA69454E75D3 },
+    { 0x465E6604B7A84465, 0x7E4FE1EDD10B9175 }, { 0x709709A125DA0709, 0x4A19697C81AC1BEF },
+    { 0x5A126E1A84AE6C07, 0x54E1213067BCE326 }, { 0x480EBE7B9D58566C, 0x43E74DC052FD8285 },
+    { 0x734ACA5F6226F0AD, 0x530BAF9A1E626A6D }, { 0x5C3BD5191B525A24, 0x426FBFAE7EB521F1 },
+    { 0x49C97747490EAE83, 0x4EBFCC8B9890E7F4 }, { 0x760F253EDB4AB0D2, 0x4ACC7A78F41B0CBA },
+    { 0x5E72843249088D75, 0x223D2EC729AF3D62 }, { 0x4B8ED0283A6D3DF7, 0x34FDBF05BAF29781 },
+    { 0x78E480405D7B9658, 0x54C931A2C4B758CF }, { 0x60B6CD004AC94513, 0x5D6DC14F03C5E0A5 },
+    { 0x4D5F0A66A23A9DA9, 0x31249AA59C9E4D51 }, { 0x7BCB43D769F762A8, 0x4EA0F76F60FD4882 },
+    { 0x63090312BB2C4EED, 0x254D92BF80CAA068 }, { 0x4F3A68DBC8F03F24, 0x1DD7A89933D54D20 },
+    { 0x7EC3DAF941806506, 0x62F2A75B86221500 }, { 0x65697BFA9ACD1D9F, 0x025BB91604E810CD },
+    { 0x51212FFBAF0A7E18, 0x684960DE6A5340A4 }, { 0x40E7599625A1FE7A, 0x203AB3E521DC33B6 },
+    { 0x67D88F56A29CCA5D, 0x19F7863B696052BD }, { 0x5313A5DEE87D6EB0, 0x7B2C6B62BAB37564 },
+    { 0x42761E4BED31255A, 0x2F56BC4EFBC2C450 }, { 0x6A5696DFE1E83BC3, 0x655793B192D13A1A },
+    { 0x5512124CB4B9C969, 0x377942F475742E7B }, { 0x440E750A2A2E3ABA, 0x5F9435905DF68B96 },
+    { 0x6CE3EE76A9E3912A, 0x65B9EF4D63241289 }, { 0x571CBEC554B60DBB, 0x6AFB25D782834207 },
+    { 0x45B0989DDD5E7163, 0x08C8EB12CECF6806 }, { 0x6F80F42FC8971BD1, 0x5ADB11B7B14BD9A3 },
+    { 0x5933F68CA078E30E, 0x157C0E2C8DD647B5 }, { 0x475CC53D4D2D8271, 0x5DFCD823A4AB6C91 },
+    { 0x722E086215159D82, 0x632E269F6DDF141B }, { 0x5B5806B4DDAAE468, 0x4F581EE5F17F4349 },
+    { 0x49133890B1558386, 0x72ACE584C1329C3B }, { 0x74EB8DB44EEF38D7, 0x6AAE3C079B842D2A },
+    { 0x5D893E29D8BF60AC, 0x5558300616035755 }, { 0x4AD431BB13CC4D56, 0x7779C004DE6912AB },
+    { 0x77B9E92B52E07BBE, 0x258F99A163DB5111 }, { 0x5FC7EDBC424D2FCB, 0x37A614811CAF740D },
+    { 0x4C9FF163683DBFD5, 0x7951AA00E3BF900B }, { 0x7A998238A6C932EF, 0x754F7667D2CC19AB },
+    { 0x6214682D523A8F26, 0x2AA5F8530F09AE22 }, { 0x4E76B9BDDB620C1E, 0x55519375A5A1581B },
+    { 0x7D8AC2C95F034697, 0x3BB5B8BC3C3559C5 }, { 0x646F023AB2690545, 0x7C9160969691149E },
+    { 0x5058CE955B87376B, 0x16DAB3ABABA743B2 }, { 0x40470BAAAF9F5F88, 0x78AEF622EFB902F5 },
+    { 0x66D812AAB29898DB, 0x0DE4BD04B2C19E54 }, { 0x524675555BAD4715, 0x57EA30D08F014B76 },
+    { 0x41D1F7777C8A9F44, 0x4654F3DA0C01092C }, { 0x694FF258C7443207, 0x23BB1FC346680EAC },
+    { 0x543FF513D29CF4D2, 0x4FC8E635D1ECD88A }, { 0x43665DA9754A5D75, 0x263A51C4A7F0AD3B },
+    { 0x6BD6FC425543C8BB, 0x56C3B607731AAEC4 }, { 0x5645969B77696D62, 0x789C919F8F488BD0 },
+    { 0x4504787C5F878AB5, 0x46E3A7B2D906D640 }, { 0x6E6D8D93CC0C1122, 0x3E390C515B3E239A },
+    { 0x5857A4763CD6741B, 0x4B60D6A77C31B615 }, { 0x46AC8391CA4529AF, 0x55E7121F968E2B44 },
+    { 0x711405B6106EA919, 0x0971B698F0E3786D }, { 0x5A766AF80D255414, 0x078E2BAD8D82C6BD },
+    { 0x485EBBF9A41DDCDC, 0x6C71BC8AD79BD231 }, { 0x73CAC65C39C96161, 0x2D82C7448C2C8382 },
+    { 0x5CA23849C7D44DE7, 0x3E023903A356CF9B }, { 0x4A1B603B06437185, 0x7E682D9C82ABD949 },
+    { 0x76923391A39F1C09, 0x4A4048FA6AAC8EDB }, { 0x5EDB5C7482E5B007, 0x55003A61EEF07249 },
+    { 0x4BE2B05D35848CD2, 0x773361E7F259F507 }, { 0x796AB3C855A0E151, 0x3EB89CA6508FEE71 },
+    { 0x6122296D114D810D, 0x7EFA16EB73A6585B }, { 0x4DB4EDF0DAA4673E, 0x3261ABEF8FB846AF },
+    { 0x7C54AFE7C43A3ECA, 0x1D691318E5F3A44B }, { 0x6376F31FD02E98A1, 0x64540F471E5C836F },
+    { 0x4F925C1973587A1B, 0x0376729F4B7D35F3 }, { 0x7F50935BEBC0C35E, 0x38BD84321261EFEB },
+    { 0x65DA0F7CBC9A35E5, 0x13CAD0280EB4BFEF }, { 0x517B3F96FD482B1D, 0x5CA240200BC3CCBF },
+    { 0x412F66126439BC17, 0x63B50019A3030A33 }, { 0x684BD683D38F9359, 0x1F88002904D1A9EA },
+    { 0x536FDECFDC72DC47, 0x32D3335403DAEE55 }, { 0x42BFE57316C249D2, 0x5BDC291003158B77 },
+    { 0x6ACCA251BE03A951, 0x12F9DB4CD1BC1258 }, { 0x557081DAFE695440, 0x7594AF70A7C9A847 },
+    { 0x445A017BFEBAA9CD, 0x4476F2C0863AED06 }, { 0x6D5CCF2CCAC442E2, 0x3A57EACDA3917B3C },
+    { 0x577D728A3BD03581, 0x7B7988A482DAC8FD }, { 0x45FDF53B630CF79B, 0x15FAD3B6CF156D97 },
+    { 0x6FFCBB923814BF5E, 0x565E1F8AE4EF15BE }, { 0x5996FC74F9AA32B2, 0x11E4E608B725AAFF },
+    { 0x47ABFD2A6154F55B, 0x27EA51A0928488CC }, { 0x72ACC843CEEE555E, 0x7310829A84074146 },
+    { 0x5BBD6D030BF1DDE5, 0x42739BAED005CDD2 }, { 0x49645735A327E4B7, 0x4EC2E2F24004A4A8 },
+    { 0x756D5855D1D96DF2, 0x4AD16B1D333AA10C }, { 0x5DF11377DB1457F5, 0x2241227DC2954DA3 },
+    { 0x4B2742C648DD132A, 0x4E9A81FE35443E1C }, { 0x783ED13D4161B844, 0x175D9CC9EED39694 },
+    { 0x603240FDCDE7C69C, 0x7917B0A18BDC7876 }, { 0x4CF500CB0B1FD217, 0x1412F3B46FE39392 },
+    { 0x7B219ADE7832E9BE, 0x535185ED7FD285B6 }, { 0x628148B1F9C25498, 0x42A79E57997537C5 },
+    { 0x4ECDD3C1949B76E0, 0x3552E512E12A9304 }, { 0x7E161F9C20F8BE33, 0x6EEB081E3510EB39 },
+    { 0x64DE7FB01A609829, 0x3F226CE4F740BC2E }, { 0x50B1FFC0151A1354, 0x3281F0B72C33C9BE },
+    { 0x408E66334414DC43, 0x42018D5F568FD498 }, { 0x674A3D1ED354939F, 0x1CCF48988A7FBA8D },
+    { 0x52A1CA7F0F76DC7F, 0x30A5D3AD3B99620B }, { 0x421B0865A5F8B065, 0x73B7DC8A96144E6F },
+    { 0x69C4DA3C3CC11A3C, 0x52BFC7442353B0B1 }, { 0x549D7B6363CDAE96, 0x756639034F7626F4 },
+    { 0x43B12F82B63E2545, 0x4451C735D92B525D }, { 0x6C4EB26ABD303BA2, 0x3A1C71EFC1DEEA2E },
+    { 0x56A55B889759C94E, 0x61B05B2634B254F2 }, { 0x45511606DF7B0772, 0x1AF37C1E908EAA5B },
+    { 0x6EE8233E325E7250, 0x2B1F2CFDB41776F8 }, { 0x58B9B5CB5B7EC1D9, 0x6F4C23FE29AC5F2D },
+    { 0x46FAF7D5E2CBCE47, 0x72A34FFE87BD18F1 }, { 0x71918C896ADFB073, 0x04387FFDA5FB5B1B },
+    { 0x5ADAD6D4557FC05C, 0x0360666484C915AF }, { 0x48AF1243779966B0, 0x02B3851D3707448C },
+    { 0x744B506BF28F0AB3, 0x1DEC082EBE720746 }, { 0x5D090D2328726EF5, 0x64BCD358985B3905 },
+    { 0x4A6DA41C205B8BF7, 0x6A30A913AD15C738 }, { 0x7715D36033C5ACBF, 0x5D1AA81F7B560B8C },
+    { 0x5F44A919C3048A32, 0x7DAEECE5FC44D609 }, { 0x4C36EDAE359D3B5B, 0x7E258A51969D7808 },
+    { 0x79F17C49EF61F893, 0x16A276E8F0FBF33F }, { 0x618DFD07F2B4C6DC, 0x121B9253F3FCC299 },
+    { 0x4E0B30D328909F16, 0x41AFA84329970214 }, { 0x7CDEB4850DB431BD, 0x4F7F739EA8F19CED },
+    { 0x63E55D373E29C164, 0x3F99294BBA5AE3F1 }, { 0x4FEAB0F8FE87CDE9, 0x7FADBAA2FB7BE98D },
+    { 0x7FDDE7F4CA72E30F, 0x7F7C5DD1925FDC15 }, { 0x664B1FF7085BE8D9, 0x4C637E4141E649AB },
+    { 0x51D5B32C06AFED7A, 0x704F983434B83AEF }, { 0x4177C2899EF32462, 0x26A6135CF6F9C8BF },
+    { 0x68BF9DA8FE51D3D0, 0x3DD685618B294132 }, { 0x53CC7E20CB74A973, 0x4B12044E08EDCDC2 },
+    { 0x4309FE80A2C3BAC2, 0x6F419D0B3A57D7CE }, { 0x6B4330CDD1392AD1, 0x320294DEC3BFBFB0 },
+    { 0x55CF5A3E40FA88A7, 0x419BAA4BCFCC995A }, { 0x44A5E1CB672ED3B9, 0x1AE2EEA30CA3ADE1 },
+    { 0x6DD636123EB152C1, 0x77D17DD1ADD2AFCF }, { 0x57DE91A832277567, 0x797464A7BE42263F },
+    { 0x464BA7B9C1B92AB9, 0x4790508631CE84FF }, { 0x70790C5C6928445C, 0x0C1A1A704FB0D4CC },
+    { 0x59FA7049EDB9D049, 0x567B4859D95A43D6 }, { 0x47FB8D07F161736E, 0x11FC39E17AAE9CAB },
+    { 0x732C14D98235857D, 0x032D2968C44A9445 }, { 0x5C2343E134F79DFD, 0x4F575453D03BA9D1 },
+    { 0x49B5CFE75D92E4CA, 0x72AC4376402FBB0E }, { 0x75EFB30BC8EB07AB, 0x0446D256CD192B49 },
+    { 0x5E595C096D88D2EF, 0x1D0575123DADBC3A }, { 0x4B7AB0078AD3DBF2, 0x4A6AC40E97BE302F },
+    { 0x78C44CD8DE1FC650, 0x771139B0F2C9E6B1 }, { 0x609D0A4718196B73, 0x78DA948D8F07EBC1 },
+    { 0x4D4A6E9F467ABC5C, 0x60AEDD3E0C065634 }, { 0x7BAA4A9870C46094, 0x344AFB9679A3BD20 },
+    { 0x62EEA2138D69E6DD, 0x103BFC78614FCA80 }, { 0x4F254E760ABB1F17, 0x26966393810CA200 },
+    { 0x7EA21723445E9825, 0x2423D2859B476999 }, { 0x654E78E9037EE01D, 0x69B642047C392148 },
+    { 0x510B93ED9C658017, 0x6E2B680396941AA0 }, { 0x40D60FF149EACCDF, 0x71BC53361210154D },
+    { 0x67BCE64EDCAAE166, 0x1C6085235019BBAE }, { 0x52FD850BE3BBE784, 0x7D1A041C40149625 },
+    { 0x42646A6FE9631F9D, 0x4A7B367D0010781D }, { 0x6A3A43E642383295, 0x5D91F0C8001A59C8 },
+    { 0x54FB698501C68EDE, 0x17A7F3D3334847D4 }, { 0x43FC546A67D20BE4, 0x79532975C2A03976 },
+    { 0x6CC6ED770C83463B, 0x0EEB75893766C256 }, { 0x57058AC5A39C382F, 0x25892AD42C523512 },
+    { 0x459E089E1C7CF9BF, 0x37A0EF102374F742 }, { 0x6F6340FCFA618F98, 0x59017E8038BB2536 },
+    { 0x591C33FD951AD946, 0x7A67986693C8EA91 }, { 0x4749C33144157A9F, 0x151FAD1EDCA0BBA8 },
+    { 0x720F9EB539BBF765, 0x0832AE97C76792A5 }, { 0x5B3FB22A94965F84, 0x068EF21305EC7551 },
+    { 0x48FFC1BBAA11E603, 0x1ED8C1A8D189F774 }, { 0x74CC692C434FD66B, 0x4AF4690E1C0FF253 },
+    { 0x5D705423690CAB89, 0x225D20D816732843 }, { 0x4AC0434F873D5607, 0x35174D79AB8F5369 },
+    { 0x779A054C0B955672, 0x21BEE25C45B21F0E }, { 0x5FAE6AA33C77785B, 0x3498B5169E2818D8 },
+    { 0x4C8B888296C5F9E2, 0x5D46F7454B534713 }, { 0x7A78DA6A8AD65C9D, 0x7BA4BED545520B52 },
+    { 0x61FA48553BDEB07E, 0x2FB6FF110441A2A8 }, { 0x4E61D37763188D31, 0x72F8CC0D9D014EED },
+    { 0x7D6952589E8DAEB6, 0x1E5AE015C80217E1 }, { 0x645441E07ED7BEF8, 0x1848B344A001ACB4 },
+    { 0x504367E6CBDFCBF9, 0x603A2903B3348A2A }, { 0x4035ECB8A3196FFB, 0x002E873628F6D4EE },
+    { 0x66BCADF43828B32B, 0x19E40B89DB2487E3 }, { 0x52308B29C686F5BC, 0x14B66FA17C1D3983 },
+    { 0x41C06F549ED25E30, 0x1091F2E7967DC79C }, { 0x6933E554315096B3, 0x341CB7D8F0C93F5F },
+    { 0x542984435AA6DEF5, 0x767D5FE0C0A0FF80 }, { 0x435469CF7BB8B25E, 0x2B977FE70080CC66 },
+    { 0x6BBA42E592C11D63, 0x5F58CCA4CD9AE0A3 }, { 0x562E9BEADBCDB11C, 0x4C470A1D7148B3B6 },
+    { 0x44F216557CA48DB0, 0x3D05A1B1276D5C92 }, { 0x6E5023BBFAA0E2B3, 0x7B3C35E83F1560E9 },
+    { 0x58401C96621A4EF6, 0x2F635E5365AAB3ED }, { 0x4699B0784E7B725E, 0x591C4B75EAEEF658 },
+    { 0x70F5E726E3F8B6FD, 0x74FA125644B18A26 }, { 0x5A5E5285832D5F31, 0x43FB41DE9D5AD4EB },
+    { 0x484B75379C244C27, 0x4FFC34B2177BDD89 }, { 0x73ABEEBF603A1372, 0x4CC6BAB68BF96274 },
+    { 0x5C898BCC4CFB42C2, 0x0A38955ED6611B90 }, { 0x4A07A309D72F689B, 0x21C6DDE5784DAFA7 },
+    { 0x76729E762518A75E, 0x693E2FD58D49190B }, { 0x5EC2185E8413B918, 0x5431BFDE0AA0E0D5 },
+    { 0x4BCE79E536762DAD, 0x29C1664B3BB3E711 }, { 0x794A5CA1F0BD15E2, 0x0F9BD6DEC5ECA4E8 },
+    { 0x61084A1B26FDAB1B, 0x2616457F04BD50BA }, { 0x4DA03B48EBFE227C, 0x1E783798D09773C8 },
+    { 0x7C33920E46636A60, 0x30C058F480F252D9 }, { 0x635C74D8384F884D, 0x0D66AD9067284247 },
+    { 0x4F7D2A469372D370, 0x711EF14052869B6C }, { 0x7F2EAA0A85848581, 0x34FE4ECD50D75F14 },
+    { 0x65BEEE6ED136D134, 0x2A650BD773DF7F43 }, { 0x51658B8BDA9240F6, 0x551DA312C319329C },
+    { 0x411E093CAEDB672B, 0x5DB14F4235ADC217 }, { 0x68300EC77E2BD845, 0x7C4EE536BC49368A },
+    { 0x5359A56C64EFE037, 0x7D0BEA92303A9208 }, { 0x42AE1DF050BFE693, 0x173CBBA8269541A0 },
+    { 0x6AB02FE6E79970EB, 0x3EC792A6A422029A }, { 0x5559BFEBEC7AC0BC, 0x3239421EE9B4CEE1 },
+    { 0x4447CCBCBD2F0096, 0x5B6101B25490A581 }, { 0x6D3FADFAC84B3424, 0x2BCE691D541AA268 },
+    { 0x576624C8A03C29B6, 0x563EBA7DDCE21B87 }, { 0x45EB50A08030215E, 0x78322ECB171B4939 },
+    { 0x6FDEE76733803564, 0x59E9E47824F87527 }, { 0x597F1F85C2CCF783, 0x6187E9F9B72D2A86 },
+    { 0x4798E6049BD72C69, 0x346CBB2E2C242205 }, { 0x728E3CD42C8B7A42, 0x20ADF849E039D007 },
+    { 0x5BA4FD768A092E9B, 0x33BE603B19C7D99F }, { 0x4950CAC53B3A8BAF, 0x42FEB3627B0647B3 },
+    { 0x754E113B91F745E5, 0x5197856A5E7072B8 }, { 0x5DD80DC941929E51, 0x27AC6ABB7EC05BC6 },
+    { 0x4B133E3A9ADBB1DA, 0x52F05562CBCD1638 }, { 0x781EC9F75E2C4FC4, 0x1E4D556ADFAE89F3 },
+    { 0x6018A192B1BD0C9C, 0x7EA444557FBED4C3 }, { 0x4CE0814227CA707D, 0x4BB69D1132FF109C },
+    { 0x7B00CED03FAA4D95, 0x5F8A94E851981A93 }, { 0x62670BD9CC883E11, 0x32D543ED0E134875 },
+    { 0x4EB8D647D6D364DA, 0x5BDDCFF0D80F6D2B }, { 0x7DF48A0C8AEBD491, 0x12FC7FE7C018AEAB },
+    { 0x64C3A1A3A25643A7, 0x28C9FFEC99AD5889 }, { 0x509C814FB511CFB9, 0x0707FFF07AF113A1 },
+    { 0x407D343FC40E3FC7, 0x1F39998D2F2742E7 }, { 0x672EB9FFA016CC71, 0x7EC28F484B7204A4 },
+    { 0x528BC7FFB345705B, 0x189BA5D36F8E6A1D }, { 0x42096CCC8F6AC048, 0x7A161E42BFA521B1 },
+    { 0x69A8AE1418AACD41, 0x435696D132A1CF81 }, { 0x5486F1A9AD557101, 0x1C454574288172CE },
+    { 0x439F27BAF1112734, 0x169DD129BA0128A5 }, { 0x6C31D92B1B4EA520, 0x242FB50F9001DAA1 },
+    { 0x568E4755AF721DB3, 0x368C90D940017BB4 }, { 0x453E9F77BF8E7E29, 0x120A0D7A999AC95D },
+    { 0x6ECA98BF98E3FD0E, 0x50101590F5C47561 }, { 0x58A213CC7A4FFDA5, 0x26734473F7D05DE8 },
+    { 0x46E80FD6C83FFE1D, 0x6B8F69F65FD9E4B9 }, { 0x71734C8AD9FFFCFC, 0x45B24323CC8FD45C },
+    { 0x5AC2A3A247FFFD96, 0x6AF502830A0CA9E3 }, { 0x489BB61B6CCCCADF, 0x08C402026E7087E9 },
+    { 0x742C569247AE1164, 0x746CD003E3E73FDB }, { 0x5CF04541D2F1A783, 0x76BD73364FEC3315 },
+    { 0x4A59D101758E1F9C, 0x5EFDF5C50CBCF5AB }, { 0x76F61B3588E365C7, 0x4B2FEFA1ADFB22AB },
+    { 0x5F2B48F7A0B5EB06, 0x08F3261AF195B555 }, { 0x4C22A0C61A2B226B, 0x20C284E25ADE2AAB },
+    { 0x79D1013CF6AB6A45, 0x1AD0D49D5E304444 }, { 0x617400FD9222BB6A, 0x48A7107DE4F369D0 },
+    { 0x4DF6673141B562BB, 0x53B8D9FE50C2BB0D }, { 0x7CBD71E869223792, 0x52C15CCA1AD12B48 },
+    { 0x63CAC186BA81C60E, 0x75677D6E7BDA8906 }, { 0x4FD5679EFB9B04D8, 0x5DEC645863153A6C },
+    { 0x7FBBD8FE5F5E6E27, 0x497A3A2704EEC3DF }, { 0x662FE0CB7F7EBE86, 0x0794FB526A589CB3 },
+    { 0x51BFE70932CBCB9E, 0x3943FC41EEAD4A29 }, { 0x4166526DC23CA2E5, 0x14366367F2243B54 },
+    { 0x68A3B716039437D5, 0x06BD6BD9836D2BB9 }, { 0x53B62C119C769310, 0x6BCABCAE02BDBC94 },
+    { 0x42F8234149F875A7, 0x096EFD58023163AA }, { 0x6B269ECEDCC0BC3E, 0x424B2EF336B56C43 },
+    { 0x55B87F0BE3CD6365, 0x1B6F58C2922ABD02 }, { 0x449398D64FD782B7, 0x2F8C47020E889735 },
+    { 0x6DB8F48A1958D125, 0x327A0B367DA75855 }, { 0x57C72A0814470DB7, 0x41FB3C2B97B91377 },
+    { 0x4638EE6CDD05A492, 0x67FC3022DFC742C6 }, { 0x705B171494D5D41E, 0x0CC6B36AFFA537A2 },
+    { 0x59E278DD43DE434B, 0x23D22922661DC61C }, { 0x47E860B1031835D5, 0x6974EDB51E7E3816 },
+    { 0x730D67819E8D22EF, 0x5BEE4921CA638CF0 }, { 0x5C0AB9347ED74F26, 0x16583A816EB60A5A },
+    { 0x49A22DC398AC3F51, 0x5EACFB9ABEF80848 }, { 0x75D04938F446CBB5, 0x7DE19291318CDA0C },
+    { 0x5E403A93F69F095E, 0x3181420DC13D7B3D }, { 0x4B6695432BB26DE5, 0x0E0101A49A9795CB },
+    { 0x78A4220512B7163B, 0x30019C3A90F28944 }, { 0x60834E6A755F44FC, 0x2667B02EDA5BA103 },
+    { 0x4D35D8552AB29D96, 0x51EC8CF248494D9C }, { 0x7B895A21DDEA95BD, 0x697A7B1D407548FA },
+    { 0x62D4481B17EEDE31, 0x3AC8627DCD2AA0C8 }, { 0x4F1039AF4658B1C1, 0x156D1B97D7554D6D },
+    { 0x7E805C4BA3C11C68, 0x22482C26255548AE }, { 0x65337D094FCDB053, 0x350689B81DDDD3BE },
+    { 0x50F5FDA10CA48D0F, 0x44053AF9B17E42FF }, { 0x40C4CAE73D5070D9, 0x1CD0FBFAF4650265 },
+    { 0x67A144A52EE71AF5, 0x1481932B20A19D6F }, { 0x52E76A1DBF1F48C4, 0x1067A8EF4D4E178C },
+    { 0x4252BB4AFF4C3A36, 0x4052ED8C3DD812D6 }, { 0x6A1DF877FEE05D24, 0x0084AF46C959B7BD },
+    { 0x54E4C6C665804A83, 0x1A03BF6BD447C631 }, { 0x43EA389EB799D535, 0x619C992310396B5B },
+    { 0x6CA9F43125C2EEBC, 0x35C75B6B4D28ABC4 }, { 0x56EE5CF41E358BC9, 0x77D2AF890A86EFD0 },
+    { 0x458B7D90182AD63B, 0x130EF2D4086BF30D }, { 0x6F4595B359DE2391, 0x6B4B1E200D7984E1 },
+    { 0x590477C2AE4B4FA7, 0x6F6F4B4CD7946A4E }, { 0x4736C635583C3FB9, 0x3F8C3C3D7943883E },
+    { 0x71F13D2226C6CC5B, 0x7F46C6C8C205A6CA }, { 0x5B27641B5238A37C, 0x65D238A09B37B8A2 },
+    { 0x48EC5015DB6082CA, 0x1E41C6E6E292FA1B }, { 0x74AD4CEFC56737A9, 0x7D360B0B041E5CF8 },
+    { 0x5D5770BFD11F5FBB, 0x175E6F3C034B7D93 }, { 0x4AAC5A330DB2B2FC, 0x12B1F29669093142 },
+    { 0x777A29EB491DEB2D, 0x044FEA8A41A84ED0 }, { 0x5F94EE55D417EF57, 0x1D0CBBA1CE203F0D },
+};
+
+#define AXP__DBL_C_MIN (1ULL << 52)
+#define AXP__DBL_Q_MIN (-1074)
+#define AXP__MASK63 ((1ULL << 63) - 1)
+
+static const double axp__exact_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 axp__u128;
+#endif
+
+// High 64 bits of a * b, the low ones go to *lo when it is not NULL
+static inline uint64_t axp__umul128(uint64_t a, uint64_t b, uint64_t *lo) {
+#if defined(__SIZEOF_INT128__)
+    axp__u128 p = (axp__u128)a * b;
+    if (lo) *lo = (uint64_t)p;
+    return (uint64_t)(p >> 64);
+#else
+    uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+    uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+    uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+    if (lo) *lo = (mid << 32) | (ll & 0xFFFFFFFFu);
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+static inline uint64_t axp__double_bits(double val) {
+    uint64_t bits;
+    memcpy(&bits, &val, sizeof(bits));
+    return bits;
+}
+
+static inline double axp__bits_double(uint64_t bits) {
+    double val;
+    memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+
+// floor(e log10 2), floor(e log10 2 - log10 4/3) and floor(e log2 10), exact for the exponents doubles can reach
+static inline int axp__flog10_pow2(int e) { return (int)(((int64_t)e * 661971961083LL) >> 41); }
+static inline int axp__flog10_3q_pow2(int e) { return (int)(((int64_t)e * 661971961083LL - 274743187321LL) >> 41); }
+static inline int axp__flog2_pow10(int e) { return (int)(((int64_t)e * 913124641741LL) >> 38); }
+
+// Round to odd of g * cp / 2^127
+static inline uint64_t axp__round_odd(uint64_t g1, uint64_t g0, uint64_t cp) {
+    uint64_t x1 = axp__umul128(g0, cp, NULL);
+    uint64_t y0;
+    uint64_t y1 = axp__umul128(g1, cp, &y0);
+    uint64_t z = (y0 >> 1) + x1;
+    uint64_t vbp = y1 + (z >> 63);
+    return vbp | (((z & AXP__MASK63) + AXP__MASK63) >> 63);
+}
+
+// Schubfach (Giulietti): the shortest f * 10^e10 inside the rounding interval of c * 2^q, the closest one on ties
+static void axp__schubfach(int q, uint64_t c, int dk, uint64_t *f, int *e10) {
+    uint64_t out = c & 1;
+    uint64_t cb = c << 2;
+    uint64_t cbr = cb + 2;
+    uint64_t cbl;
+    int k;
+    if (c != AXP__DBL_C_MIN || q == AXP__DBL_Q_MIN) {
+        cbl = cb - 2;
+        k = axp__flog10_pow2(q);
+    } else {
+        cbl = cb - 1;
+        k = axp__flog10_3q_pow2(q);
     }
-    double val = mantissa * pow(10.0, (double)(x->exponent + (axp_exp_t)(x->size - take)));
-    return x->sign ? -val : val;
+    int h = q + axp__flog2_pow10(-k) + 2;
+    const uint64_t *g = axp__pow10_g[k - AXP__POW10_K_MIN];
+    uint64_t vb = axp__round_odd(g[0], g[1], cb << h);
+    uint64_t vbl = axp__round_odd(g[0], g[1], cbl << h);
+    uint64_t vbr = axp__round_odd(g[0], g[1], cbr << h);
+
+    uint64_t s = vb >> 2;
+    if (s >= 100) {
+        // s / 10 * 10 through a reciprocal multiplication, one digit shorter when it still fits the interval
+        uint64_t sp10 = 10 * axp__umul128(s, 115292150460684698ULL << 4, NULL);
+        uint64_t tp10 = sp10 + 10;
+        bool upin = vbl + out <= sp10 << 2;
+        bool wpin = (tp10 << 2) + out <= vbr;
+        if (upin != wpin) {
+            *f = upin ? sp10 : tp10;
+            *e10 = k;
+            return;
+        }
+    }
+    uint64_t t = s + 1;
+    bool uin = vbl + out <= s << 2;
+    bool win = (t << 2) + out <= vbr;
+    *e10 = k + dk;
+    if (uin != win) {
+        *f = uin ? s : t;
+        return;
+    }
+    int64_t cmp = (int64_t)(vb - ((s + t) << 1));
+    *f = (cmp < 0 || (cmp == 0 && !(s & 1))) ? s : t;
 }
 
-static bool axp__double_to_float(AXP_Ctx *ctx, double val, AXP_Float *out) {
-    uint8_t sign = 0;
-    if (val < 0) {
-        sign = 1;
-        val = -val;
+// Shortest decimal f * 10^e10 that reads back as the finite, non-zero |val|
+static void axp__double_shortest(double val, uint64_t *f, int *e10) {
+    uint64_t bits = axp__double_bits(val);
+    uint64_t t = bits & (AXP__DBL_C_MIN - 1);
+    int bq = (int)((bits >> 52) & 0x7FF);
+    if (bq) {
+        int mq = 1075 - bq;
+        uint64_t c = AXP__DBL_C_MIN | t;
+        if (0 < mq && mq < 53) {
+            // Integers are their own shortest form
+            uint64_t fi = c >> mq;
+            if (fi << mq == c) {
+                *f = fi;
+                *e10 = 0;
+                return;
+            }
+        }
+        axp__schubfach(-mq, c, 0, f, e10);
+    } else if (t < 3) {
+        // 4.9e-324 and 9.9e-324 are the closest two-digit forms, one digit reads back as well
+        *f = 5 * t;
+        *e10 = -324;
+    } else {
+        axp__schubfach(AXP__DBL_Q_MIN, t, 0, f, e10);
     }
-    if (val == 0.0) {
-        if (!axp_initf_ex(ctx, out, 1)) return false;
-        out->digits[0] = 0;
-        out->size = 1;
-        return true;
+}
+
+static axp_size_t axp__u64_to_digits(uint64_t v, axp_digit_t *dst) {
+    axp_size_t sz = 0;
+    do {
+        dst[sz++] = (axp_digit_t)(v % BASE);
+        v /= BASE;
+    } while (v);
+    return sz;
+}
+
+// Eisel-Lemire: w * 10^q rounded to a double through one 64x128 bit product. Returns false when the truncated
+// power of ten leaves the rounding undecided or the result is subnormal; *bits then holds a neighbour of the answer
+static bool axp__lemire(uint64_t w, int q, uint64_t *bits) {
+    int lz = 0;
+    while (!(w >> 63)) {
+        w <<= 1;
+        lz++;
+    }
+    const uint64_t *g = axp__pow10_g[-q - AXP__POW10_K_MIN];
+    uint64_t g_hi = (g[0] << 1) | (g[1] >> 62);
+    uint64_t g_lo = g[1] << 2;
+
+    uint64_t a0;
+    uint64_t a1 = axp__umul128(w, g_lo, &a0);
+    uint64_t b0;
+    uint64_t b1 = axp__umul128(w, g_hi, &b0);
+    uint64_t mid = b0 + a1;
+    uint64_t hi = b1 + (mid < b0);
+    (void)a0;
+
+    int shift = (hi >> 63) ? 10 : 9;
+    uint64_t m = hi >> shift;
+    // The table value overshoots by less than 2^66 units of the product, so only a round bit over a short tail is unclear
+    bool ambiguous = (m & 1) && !(hi & ((1ULL << shift) - 1)) && mid < 4;
+    m = (m >> 1) + (m & 1);
+    int e2 = shift + 2 + axp__flog2_pow10(q) - lz;
+    if (m == (1ULL << 53)) {
+        m >>= 1;
+        e2++;
+    }
+    int biased = e2 + 52 + 1023;
+    if (biased >= 0x7FF) {
+        *bits = 0x7FFULL << 52;
+        return !ambiguous;
     }
+    if (biased <= 0) {
+        *bits = axp__double_bits(ldexp((double)m, e2));
+        return false;
+    }
+    *bits = ((uint64_t)biased << 52) | (m & (AXP__DBL_C_MIN - 1));
+    return !ambiguous;
+}
 
-    char buf[32];
-    snprintf(buf, sizeof(buf), "%.17e", val);
+// |x| as a double. Correctly rounded when *exact comes back true, otherwise within an ulp of the answer
+static double axp__ftod_estimate(const AXP_Float *x, bool *exact) {
+    axp_size_t sz = x->size;
+    while (sz > 1 && x->digits[sz - 1] == 0) sz--;
+    axp_size_t n = sz < 19 ? sz : 19;
+    uint64_t w = 0;
+    for (axp_size_t i = 0; i < n; i++) w = w * 10 + x->digits[sz - 1 - i];
+    *exact = true;
+    if (!w) return 0.0;
 
-    if (!axp_initf_ex(ctx, out, 18)) return false;
+    bool truncated = false;
+    for (axp_size_t i = sz - n; i > 0 && !truncated; i--) truncated = x->digits[i - 1] != 0;
+    axp_exp_t q = x->exponent + (axp_exp_t)(sz - n);
+    // |x| lies in [10^(top-1), 10^top)
+    axp_exp_t top = q + (axp_exp_t)n;
+    if (top > 309) return HUGE_VAL;
+    if (top < -323) return 0.0;
+
+    if (!truncated && w <= (1ULL << 53) && q >= -22 && q <= 22) {
+        return q >= 0 ? (double)w * axp__exact_pow10[q] : (double)w / axp__exact_pow10[-q];
+    }
 
-    axp_size_t sz = 0;
-    char *scan = buf;
-    while (*scan && *scan != 'e') {
-        if (*scan != '.') out->digits[sz++] = (axp_digit_t)(*scan - '0');
-        scan++;
+    uint64_t bits;
+    *exact = axp__lemire(w, (int)q, &bits);
+    if (*exact && truncated) {
+        // The dropped digits put |x| between w and w + 1 units, both must round the same way
+        uint64_t bits_up;
+        *exact = axp__lemire(w + 1, (int)q, &bits_up) && bits_up == bits;
     }
+    return axp__bits_double(bits);
+}
 
-    axp_exp_t str_exp = 0;
-    int8_t exp_sign = 1;
-    scan++; // skip 'e'
-    if (*scan == '-') { exp_sign = -1; scan++; }
-    else if (*scan == '+') scan++;
-    while (*scan) str_exp = str_exp * 10 + (*scan++ - '0');
-    str_exp *= exp_sign;
-
-    for (axp_size_t i = 0; i < sz / 2; i++) {
-        axp_digit_t tmp = out->digits[i];
-        out->digits[i] = out->digits[sz - 1 - i];
-        out->digits[sz - 1 - i] = tmp;
-    }
-
-    out->size = sz;
-    out->exponent = str_exp - (axp_exp_t)(sz - 1);
-    out->sign = sign;
+static double axp__float_to_double(const AXP_Float *x) {
+    bool exact;
+    double val = axp__ftod_estimate(x, &exact);
+    return x->sign ? -val : val;
+}
+
+// Shortest round-trip digits of a finite val into a float with room for 18 digits
+static bool axp__double_to_float(AXP_Ctx *ctx, double val, AXP_Float *out) {
+    if (!axp_initf_ex(ctx, out, 18)) return false;
+    out->sign = signbit(val) ? 1 : 0;
+    if (fpclassify(val) == FP_ZERO) {
+        out->digits[0] = 0;
+        out->size = 1;
+        return true;
+    }
+    uint64_t f;
+    int e10;
+    axp__double_shortest(val, &f, &e10);
+    out->size = axp__u64_to_digits(f, out->digits);
+    out->exponent = e10;
     axp_normalizef(out);
     return true;
 }
 
 // ------- Allocation -------
 
+static void axp__stats_grow(AXP_Ctx *ctx, size_t bytes) {
+    ctx->stats.bytes_live += bytes;
+    if (ctx->stats.bytes_live > ctx->stats.bytes_peak) ctx->stats.bytes_peak = ctx->stats.bytes_live;
+}
+
+static void axp__stats_shrink(AXP_Ctx *ctx, size_t bytes) {
+    ctx->stats.bytes_live -= (bytes < ctx->stats.bytes_live) ? bytes : ctx->stats.bytes_live;
+}
+
+static void *axp__calloc(AXP_Ctx *ctx, size_t count, size_t size) {
+    void *ptr = calloc(count, size);
+    if (!ptr) return NULL;
+    ctx->stats.alloc_count++;
+    axp__stats_grow(ctx, count * size);
+    return ptr;
+}
+
+static void *axp__malloc(AXP_Ctx *ctx, size_t size) {
+    void *ptr = malloc(size);
+    if (!ptr) return NULL;
+    ctx->stats.alloc_count++;
+    axp__stats_grow(ctx, size);
+    return ptr;
+}
+
+static void *axp__realloc(AXP_Ctx *ctx, void *ptr, size_t old_size, size_t new_size) {
+    void *new_ptr = realloc(ptr, new_size);
+    if (!new_ptr) return NULL;
+    ctx->stats.realloc_count++;
+    axp__stats_shrink(ctx, old_size);
+    axp__stats_grow(ctx, new_size);
+    return new_ptr;
+}
+
+// Every digit buffer and scratch allocation is released here. `ctx` may be NULL for the context-free `axp_freei`/`axp_freef`
+static void axp__free(AXP_Ctx *ctx, void *ptr, size_t size) {
+    free(ptr);
+    if (!ptr || !ctx) return;
+    ctx->stats.free_count++;
+    ctx->stats.bytes_freed += size;
+    axp__stats_shrink(ctx, size);
+}
+
+void axp_ctx_stats_get(const AXP_Ctx *ctx, AXP_CtxStats *stats) {
+    *stats = ctx->stats;
+}
+
+void axp_ctx_stats_reset(AXP_Ctx *ctx) {
+    ctx->stats.bytes_peak = ctx->stats.bytes_live;
+    ctx->stats.alloc_count = 0;
+    ctx->stats.realloc_count = 0;
+    ctx->stats.free_count = 0;
+    ctx->stats.bytes_freed = 0;
+}
+
 bool axp_initi(AXP_Ctx *ctx, AXP_Int *x, axp_size_t initial_capacity)
 {
     x->size = 1;
     x->capacity = initial_capacity;
-    x->digits = calloc(initial_capacity, sizeof(axp_digit_t));
+    x->digits = axp__calloc(ctx, initial_capacity, sizeof(axp_digit_t));
     x->sign = 0;
     if (!x->digits) {
         axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_initi`.", initial_capacity*sizeof(axp_digit_t));
@@ -141,6 +729,20 @@ bool axp_initi(AXP_Ctx *ctx, AXP_Int *x, axp_size_t initial_capacity)
     return true;
 }
 
+bool axp_initi_i64(AXP_Ctx *ctx, AXP_Int *x, int64_t value)
+{
+    uint64_t magnitude = (value < 0) ? (uint64_t)0 - (uint64_t)value : (uint64_t)value;
+    if (!axp_initi(ctx, x, 20)) return false;
+    axp_size_t sz = 0;
+    do {
+        x->digits[sz++] = (axp_digit_t)(magnitude % BASE);
+        magnitude /= BASE;
+    } while (magnitude);
+    x->size = sz;
+    x->sign = value < 0;
+    return true;
+}
+
 bool axp_initf(AXP_Ctx *ctx, AXP_Float *x)
 {
     return axp_initf_ex(ctx, x, ctx->precision);
@@ -150,7 +752,7 @@ bool axp_initf_ex(AXP_Ctx *ctx, AXP_Float *x, axp_size_t precision)
 {
     x->size = 1;
     x->capacity = precision;
-    x->digits = calloc(precision, sizeof(axp_digit_t));
+    x->digits = axp__calloc(ctx, precision, sizeof(axp_digit_t));
     x->sign = 0;
     x->exponent = 0;
     if (!x->digits) {
@@ -169,7 +771,7 @@ bool axp_realloci(AXP_Ctx *ctx, AXP_Int *x, axp_size_t size)
         x->size = size;
     }
     
-    axp_digit_t *new_digits = realloc(x->digits, size * sizeof(axp_digit_t));
+    axp_digit_t *new_digits = axp__realloc(ctx, x->digits, x->capacity * sizeof(axp_digit_t), size * sizeof(axp_digit_t));
     if (!new_digits) {
         axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not reallocate %lu bytes in `axp_realloci`.", size*sizeof(axp_digit_t));
         return false;
@@ -189,7 +791,7 @@ bool axp_reallocf(AXP_Ctx *ctx, AXP_Float *x, axp_size_t size)
         x->size = size;
     }
     
-    axp_digit_t *new_digits = realloc(x->digits, size * sizeof(axp_digit_t));
+    axp_digit_t *new_digits = axp__realloc(ctx, x->digits, x->capacity * sizeof(axp_digit_t), size * sizeof(axp_digit_t));
     if (!new_digits) {
         axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not reallocate %lu bytes in `axp_reallocf`.", size*sizeof(axp_digit_t));
         return false;
@@ -202,7 +804,7 @@ bool axp_reallocf(AXP_Ctx *ctx, AXP_Float *x, axp_size_t size)
 
 bool axp_reallocf_round(AXP_Ctx *ctx, AXP_Float *x, axp_size_t size) {
     axp_roundf(x, size);
-    axp_digit_t *new_digits = realloc(x->digits, size * sizeof(axp_digit_t));
+    axp_digit_t *new_digits = axp__realloc(ctx, x->digits, x->capacity * sizeof(axp_digit_t), size * sizeof(axp_digit_t));
     if (!new_digits) {
         axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not reallocate %lu bytes in `axp_reallocf_round`.", size*sizeof(axp_digit_t));
         return false;
@@ -217,13 +819,25 @@ bool axp_reallocf_round(AXP_Ctx *ctx, AXP_Float *x, axp_size_t size) {
 void axp_freei(AXP_Int *x)
 {
     AXP_ASSERT(x->digits);
-    free(x->digits);
+    axp__free(NULL, x->digits, x->capacity * sizeof(axp_digit_t));
 }
 
 void axp_freef(AXP_Float *x)
 {
     AXP_ASSERT(x->digits);
-    free(x->digits);
+    axp__free(NULL, x->digits, x->capacity * sizeof(axp_digit_t));
+}
+
+void axp_freei_ex(AXP_Ctx *ctx, AXP_Int *x)
+{
+    AXP_ASSERT(x->digits);
+    axp__free(ctx, x->digits, x->capacity * sizeof(axp_digit_t));
+}
+
+void axp_freef_ex(AXP_Ctx *ctx, AXP_Float *x)
+{
+    AXP_ASSERT(x->digits);
+    axp__free(ctx, x->digits, x->capacity * sizeof(axp_digit_t));
 }
 
 bool axp_copyi(AXP_Ctx *ctx, AXP_Int *restrict dst, const AXP_Int *restrict src)
@@ -292,7 +906,7 @@ bool axp_copyf_ex_round(AXP_Ctx *ctx, AXP_Float *restrict dst, const AXP_Float *
                 memset(dst->digits, 0, precision * sizeof(axp_digit_t));
                 dst->digits[0] = 1;
                 dst->size = 1;
-                dst->exponent++;
+                dst->exponent += precision;
             }
         }
         dst->exponent += diff;
@@ -321,6 +935,12 @@ static inline void axp__swapf(AXP_Float *x, AXP_Float *y) {
     *y = tmp;
 }
 
+static inline void axp__releasef(AXP_Ctx *ctx, AXP_Float *x) {
+    if (!x->digits) return;
+    axp_freef_ex(ctx, x);
+    x->digits = NULL;
+}
+
 int8_t axp__abs_cmpi_digits(axp_digit_t *x_digits, axp_size_t x_sz, axp_digit_t *y_digits, axp_size_t y_sz) {
     if (x_sz > y_sz) return 1;
     if (x_sz < y_sz) return -1;
@@ -342,25 +962,34 @@ bool axp_abs_cmpi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, int8_t *res)
     return true;
 }
 
+// Compares |x| and |y| in place from the most significant digit down, so operands are never copied or aligned
+static int8_t axp__abs_cmpf_digits(const AXP_Float *x, const AXP_Float *y) {
+    axp_size_t x_sz = x->size, y_sz = y->size;
+    while (x_sz > 1 && x->digits[x_sz - 1] == 0) x_sz--;
+    while (y_sz > 1 && y->digits[y_sz - 1] == 0) y_sz--;
+    bool x_zero = x_sz == 0 || (x_sz == 1 && x->digits[0] == 0);
+    bool y_zero = y_sz == 0 || (y_sz == 1 && y->digits[0] == 0);
+    if (x_zero || y_zero) return (int8_t)(!x_zero - !y_zero);
+
+    axp_exp_t x_top = x->exponent + (axp_exp_t)x_sz, y_top = y->exponent + (axp_exp_t)y_sz;
+    if (x_top != y_top) return x_top > y_top ? 1 : -1;
+
+    axp_size_t i = x_sz, j = y_sz;
+    for (; i > 0 && j > 0; i--, j--) {
+        if (x->digits[i-1] != y->digits[j-1]) return x->digits[i-1] > y->digits[j-1] ? 1 : -1;
+    }
+    // The longer mantissa is larger only if one of its remaining digits is non-zero
+    for (; i > 0; i--) if (x->digits[i-1]) return 1;
+    for (; j > 0; j--) if (y->digits[j-1]) return -1;
+    return 0;
+}
+
 bool axp_abs_cmpf(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, int8_t *res) {
     if (!x->digits || !y->digits) {
         axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot compare uninitialized floats.");
         return false;
     }
-    AXP_Float x_cpy = { 0 };
-    AXP_Float y_cpy = { 0 };
-
-    if (!axp_copyf_exact(ctx, &x_cpy, x)) return false;
-    if (!axp_copyf_exact(ctx, &y_cpy, y)) {
-        axp_freef(&x_cpy);
-        return false;
-    }
-    axp_align_float_digits(&x_cpy, &y_cpy);
-    *res = axp__abs_cmpi_digits(x_cpy.digits, x_cpy.size, y_cpy.digits, y_cpy.size);
-
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
-
+    *res = axp__abs_cmpf_digits(x, y);
     axp_error_reset(ctx);
     return true;
 }
@@ -369,6 +998,29 @@ bool axp__is_zero_digits(const axp_digit_t *x, axp_size_t x_sz) {
     return (x_sz == 0 || ((x_sz == 1) && (x[0] == 0)));
 }
 
+bool axp_cmpi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, int8_t *res) {
+    if (!axp_abs_cmpi(ctx, x, y, res)) return false;
+    bool x_zero = axp__is_zero_digits(x->digits, x->size), y_zero = axp__is_zero_digits(y->digits, y->size);
+    bool x_neg = x->sign && !x_zero, y_neg = y->sign && !y_zero;
+    if (x_neg != y_neg) *res = x_neg ? -1 : 1;
+    else if (x_neg) *res = (int8_t)-*res;
+    return true;
+}
+
+static int8_t axp__cmpf_digits(const AXP_Float *x, const AXP_Float *y) {
+    bool x_zero = axp__is_zero_digits(x->digits, x->size), y_zero = axp__is_zero_digits(y->digits, y->size);
+    bool x_neg = x->sign && !x_zero, y_neg = y->sign && !y_zero;
+    if (x_neg != y_neg) return x_neg ? -1 : 1;
+    int8_t res = axp__abs_cmpf_digits(x, y);
+    return x_neg ? (int8_t)-res : res;
+}
+
+bool axp_cmpf(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, int8_t *res) {
+    if (!axp_abs_cmpf(ctx, x, y, res)) return false;
+    *res = axp__cmpf_digits(x, y);
+    return true;
+}
+
 bool axp_is_zeroi(AXP_Ctx *ctx, const AXP_Int *x, bool *res) {
     if (!x->digits) {
         axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot check value of uninitalized integer.");
@@ -433,7 +1085,7 @@ bool axp_floorf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Int *n, AXP_Float *f) {
         n->size = axp__shli_digits(n->digits, x->size, (axp_size_t)x->exponent);
         n->sign = x->sign;
         if (!axp_initf_ex(ctx, f, x->capacity)) { 
-            axp_freei(n);
+            axp_freei_ex(ctx, n);
             return false;
         }
         return true;
@@ -443,7 +1095,7 @@ bool axp_floorf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Int *n, AXP_Float *f) {
     if (frac_count >= x->size) {
         if (!axp_initi(ctx, n, 1)) return false;
         if (!axp_copyf_exact(ctx, f, x)) { 
-            axp_freei(n); 
+            axp_freei_ex(ctx, n); 
             return false; 
         }
         return true;
@@ -455,7 +1107,7 @@ bool axp_floorf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Int *n, AXP_Float *f) {
     n->sign = x->sign;
 
     if (!axp_initf_ex(ctx, f, x->capacity)) {
-        axp_freei(n);
+        axp_freei_ex(ctx, n);
         return false;
     }
     memcpy(f->digits, x->digits, frac_count * sizeof(axp_digit_t));
@@ -555,6 +1207,49 @@ static bool axp__round_is_unambiguous(const axp_digit_t *digits, axp_size_t safe
     return false;
 }
 
+// True when every value within 10^err_exp of v rounds to the same `precision` digits as v, i.e. the
+// digits from the rounding position down to err_exp are neither 4 9 9 .. 9 nor 5 0 0 .. 0
+static bool axp__round_is_settled(const AXP_Float *v, axp_size_t precision, axp_exp_t err_exp) {
+    axp_exp_t ulp_exp = v->exponent + (axp_exp_t)v->size - (axp_exp_t)precision;
+    if (err_exp >= ulp_exp) return false;
+    // Digits below v->exponent are zeros
+    axp_digit_t boundary = (ulp_exp - 1 >= v->exponent) ? v->digits[ulp_exp - 1 - v->exponent] : 0;
+    if (boundary != 4 && boundary != 5) return true;
+    axp_digit_t chase = (boundary == 4) ? 9 : 0;
+    for (axp_exp_t e = ulp_exp - 2; e >= err_exp; e--) {
+        axp_digit_t digit = (e >= v->exponent) ? v->digits[e - v->exponent] : 0;
+        if (digit != chase) return true;
+    }
+    return false;
+}
+
+// Ziv test of an attempt whose guard digits absorb its own error, so that only the `extra` digits past
+// the rounding position can be trusted
+static bool axp__ziv_is_ambiguous(const AXP_Float *v, axp_size_t precision, axp_size_t extra) {
+    return !axp__round_is_settled(v, precision, v->exponent + (axp_exp_t)v->size - (axp_exp_t)(precision + extra));
+}
+
+// Exact comparison of |x| and |y| without copying or aligning either operand
+static int8_t axp__abs_cmpf_exact(const AXP_Float *x, const AXP_Float *y) {
+    axp_size_t x_sz = x->size;
+    axp_size_t y_sz = y->size;
+    while (x_sz > 0 && x->digits[x_sz - 1] == 0) x_sz--;
+    while (y_sz > 0 && y->digits[y_sz - 1] == 0) y_sz--;
+    if (!x_sz || !y_sz) return (int8_t)((x_sz != 0) - (y_sz != 0));
+
+    axp_exp_t x_top = x->exponent + (axp_exp_t)x_sz - 1;
+    axp_exp_t y_top = y->exponent + (axp_exp_t)y_sz - 1;
+    if (x_top != y_top) return (x_top > y_top) ? 1 : -1;
+
+    axp_exp_t low = (x->exponent < y->exponent) ? x->exponent : y->exponent;
+    for (axp_exp_t e = x_top; e >= low; e--) {
+        axp_digit_t x_digit = (e >= x->exponent) ? x->digits[e - x->exponent] : 0;
+        axp_digit_t y_digit = (e >= y->exponent) ? y->digits[e - y->exponent] : 0;
+        if (x_digit != y_digit) return (x_digit > y_digit) ? 1 : -1;
+    }
+    return 0;
+}
+
 void axp_align_float_digits(AXP_Float *x, AXP_Float *y) {
     if (x->exponent == y->exponent) return;
 
@@ -608,7 +1303,7 @@ bool axp_addi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *res)
         }
         int8_t cmp;
         if (!axp_abs_cmpi(ctx, larger, smaller, &cmp)) {
-            axp_freei(res);
+            axp_freei_ex(ctx, res);
             return false;
         }
         if (cmp == 0) return true;
@@ -684,13 +1379,13 @@ bool axp_addf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float
     if (!axp_reallocf_round(ctx, res, precision)) goto cleanup_error;
 
 cleanup_success:
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
+    axp_freef_ex(ctx, &x_cpy);
+    axp_freef_ex(ctx, &y_cpy);
     return true;
 cleanup_error:
-    axp_freef(res);
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
+    axp_freef_ex(ctx, res);
+    axp_freef_ex(ctx, &x_cpy);
+    axp_freef_ex(ctx, &y_cpy);
     return false;
 }
 
@@ -730,7 +1425,7 @@ bool axp_subi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *res)
     axp_digit_t res_sign = x->sign;
     int8_t cmp;
     if (!axp_abs_cmpi(ctx, x, y, &cmp)) {
-        axp_freei(res);
+        axp_freei_ex(ctx, res);
         return false;
     }
     if (cmp == 0) {
@@ -797,18 +1492,155 @@ bool axp_subf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float
     if (!axp_reallocf_round(ctx, res, precision)) goto cleanup_error;
 
 cleanup_success:
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
+    axp_freef_ex(ctx, &x_cpy);
+    axp_freef_ex(ctx, &y_cpy);
     return true;
 
 cleanup_error:
-    axp_freef(res);
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
+    axp_freef_ex(ctx, res);
+    axp_freef_ex(ctx, &x_cpy);
+    axp_freef_ex(ctx, &y_cpy);
     return false;
 }
 
+// Products with both operands past AXP_MUL_LIMB_THRESHOLD digits are packed into base 10^8 limbs, which
+// does 64 digit products per limb product, and split by Karatsuba above AXP_MUL_KARATSUBA_LIMBS limbs
+#define AXP__LIMB_DIGITS 8
+#define AXP__LIMB_BASE 100000000u
+
+static void axp__limb_school(const uint32_t *x, size_t xn, const uint32_t *y, size_t yn, uint32_t *res) {
+    memset(res, 0, (xn + yn) * sizeof(uint32_t));
+    for (size_t i = 0; i < xn; i++) {
+        uint64_t xi = x[i];
+        uint64_t carry = 0;
+        if (!xi) continue;
+        for (size_t j = 0; j < yn; j++) {
+            uint64_t t = res[i + j] + xi * y[j] + carry;
+            res[i + j] = (uint32_t)(t % AXP__LIMB_BASE);
+            carry = t / AXP__LIMB_BASE;
+        }
+        res[i + yn] = (uint32_t)carry;
+    }
+}
+
+// res = a + b with an >= bn, returns the length including a final carry limb
+static size_t axp__limb_add(const uint32_t *a, size_t an, const uint32_t *b, size_t bn, uint32_t *res) {
+    uint32_t carry = 0;
+    for (size_t i = 0; i < an; i++) {
+        uint32_t t = a[i] + (i < bn ? b[i] : 0) + carry;
+        carry = t >= AXP__LIMB_BASE;
+        res[i] = carry ? t - AXP__LIMB_BASE : t;
+    }
+    res[an] = carry;
+    return an + 1;
+}
+
+// a += b, the sum fits an limbs
+static void axp__limb_add_inplace(uint32_t *a, size_t an, const uint32_t *b, size_t bn) {
+    uint32_t carry = 0;
+    for (size_t i = 0; i < an && (i < bn || carry); i++) {
+        uint32_t t = a[i] + (i < bn ? b[i] : 0) + carry;
+        carry = t >= AXP__LIMB_BASE;
+        a[i] = carry ? t - AXP__LIMB_BASE : t;
+    }
+}
+
+// a -= b for a >= b
+static void axp__limb_sub_inplace(uint32_t *a, size_t an, const uint32_t *b, size_t bn) {
+    uint32_t borrow = 0;
+    for (size_t i = 0; i < an && (i < bn || borrow); i++) {
+        uint32_t s = (i < bn ? b[i] : 0) + borrow;
+        borrow = a[i] < s;
+        a[i] = borrow ? a[i] + AXP__LIMB_BASE - s : a[i] - s;
+    }
+}
+
+// res gets xn + yn limbs; scratch holds 6 * (xn + yn) + 1024 limbs
+static void axp__limb_mul(const uint32_t *x, size_t xn, const uint32_t *y, size_t yn, uint32_t *res, uint32_t *scratch) {
+    if (xn < yn) {
+        const uint32_t *swap = x; x = y; y = swap;
+        size_t swap_n = xn; xn = yn; yn = swap_n;
+    }
+    if (yn < AXP_MUL_KARATSUBA_LIMBS) {
+        axp__limb_school(x, xn, y, yn, res);
+        return;
+    }
+    if (xn >= 2 * yn) {
+        // Unbalanced, y times each yn-limb slice of x
+        uint32_t *tmp = scratch;
+        memset(res, 0, (xn + yn) * sizeof(uint32_t));
+        for (size_t off = 0; off < xn; off += yn) {
+            size_t len = (xn - off < yn) ? xn - off : yn;
+            axp__limb_mul(x + off, len, y, yn, tmp, scratch + 2 * yn);
+            axp__limb_add_inplace(res + off, xn + yn - off, tmp, len + yn);
+        }
+        return;
+    }
+
+    // x = x0 + x1*B^m, y = y0 + y1*B^m and x*y = z0 + (z1 - z0 - z2)*B^m + z2*B^2m with z1 = (x0+x1)(y0+y1)
+    size_t m = xn / 2;
+    axp__limb_mul(x, m, y, m, res, scratch);
+    axp__limb_mul(x + m, xn - m, y + m, yn - m, res + 2 * m, scratch);
+    uint32_t *sx = scratch;
+    size_t sxn = axp__limb_add(x + m, xn - m, x, m, sx);
+    uint32_t *sy = sx + sxn;
+    size_t syn = (yn - m >= m) ? axp__limb_add(y + m, yn - m, y, m, sy) : axp__limb_add(y, m, y + m, yn - m, sy);
+    uint32_t *z1 = sy + syn;
+    axp__limb_mul(sx, sxn, sy, syn, z1, z1 + sxn + syn);
+    size_t z1n = sxn + syn;
+    axp__limb_sub_inplace(z1, z1n, res, 2 * m);
+    axp__limb_sub_inplace(z1, z1n, res + 2 * m, xn + yn - 2 * m);
+    while (z1n > 0 && z1[z1n - 1] == 0) z1n--;
+    axp__limb_add_inplace(res + m, xn + yn - m, z1, z1n);
+}
+
+static size_t axp__limbs_from_digits(const axp_digit_t *digits, axp_size_t sz, uint32_t *limbs) {
+    size_t n = ((size_t)sz + AXP__LIMB_DIGITS - 1) / AXP__LIMB_DIGITS;
+    for (size_t k = 0; k < n; k++) {
+        uint32_t v = 0;
+        size_t lo = k * AXP__LIMB_DIGITS;
+        size_t hi = (lo + AXP__LIMB_DIGITS < sz) ? lo + AXP__LIMB_DIGITS : sz;
+        for (size_t i = hi; i-- > lo;) v = v * BASE + digits[i];
+        limbs[k] = v;
+    }
+    return n;
+}
+
+// Returns 0 when the scratch space cannot be allocated and the caller falls back to the digit loop. The
+// digit layer has no context, the scratch is released before returning and not counted in its statistics.
+static axp_size_t axp__mul_digits_limbs(const axp_digit_t *x_digits, axp_size_t x_sz, const axp_digit_t *y_digits, axp_size_t y_sz, axp_digit_t *res) {
+    size_t xn = ((size_t)x_sz + AXP__LIMB_DIGITS - 1) / AXP__LIMB_DIGITS;
+    size_t yn = ((size_t)y_sz + AXP__LIMB_DIGITS - 1) / AXP__LIMB_DIGITS;
+    uint32_t *buf = malloc((xn + yn + (xn + yn) + 6 * (xn + yn) + 1024) * sizeof(uint32_t));
+    if (!buf) return 0;
+    uint32_t *x = buf;
+    uint32_t *y = x + xn;
+    uint32_t *prod = y + yn;
+    axp__limbs_from_digits(x_digits, x_sz, x);
+    axp__limbs_from_digits(y_digits, y_sz, y);
+    axp__limb_mul(x, xn, y, yn, prod, prod + xn + yn);
+
+    size_t pn = xn + yn;
+    while (pn > 1 && prod[pn - 1] == 0) pn--;
+    axp_size_t sz = 0;
+    for (size_t k = 0; k < pn; k++) {
+        uint32_t v = prod[k];
+        for (size_t i = 0; i < AXP__LIMB_DIGITS; i++) {
+            res[sz++] = (axp_digit_t)(v % BASE);
+            v /= BASE;
+            if (k + 1 == pn && v == 0) break;
+        }
+    }
+    free(buf);
+    while (sz > 1 && res[sz - 1] == 0) sz--;
+    return sz;
+}
+
 axp_size_t axp__mul_digits(const axp_digit_t *x_digits, axp_size_t x_sz, const axp_digit_t *y_digits, axp_size_t y_sz, axp_digit_t *res) {
+    if (x_sz >= AXP_MUL_LIMB_THRESHOLD && y_sz >= AXP_MUL_LIMB_THRESHOLD) {
+        axp_size_t sz = axp__mul_digits_limbs(x_digits, x_sz, y_digits, y_sz, res);
+        if (sz) return sz;
+    }
     axp_size_t i;
     axp_size_t j;
     axp_size_t max_written = 0;
@@ -866,23 +1698,23 @@ bool axp_mulf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float
     res->size = res_sz;
     res->sign = x->sign ^ y->sign;
     // Exponent overflow check
-    if (axp__add_exp_overflow(x->exponent, y->exponent)) {
-        axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow (%lld + %lld)", x->exponent, y->exponent);
+    if (axp__add_exp_overflow(x_cpy.exponent, y_cpy.exponent)) {
+        axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow (%lld + %lld)", x_cpy.exponent, y_cpy.exponent);
         goto cleanup_error;
     }
 
-    res->exponent = x->exponent + y->exponent;
+    res->exponent = x_cpy.exponent + y_cpy.exponent;
     axp_normalizef(res);
     if (!axp_reallocf_round(ctx, res, precision)) goto cleanup_error;
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
+    axp_freef_ex(ctx, &x_cpy);
+    axp_freef_ex(ctx, &y_cpy);
     axp_error_reset(ctx);
     return true;
 
 cleanup_error:
-    axp_freef(res);
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
+    axp_freef_ex(ctx, res);
+    axp_freef_ex(ctx, &x_cpy);
+    axp_freef_ex(ctx, &y_cpy);
     return false;
 }
 
@@ -993,9 +1825,9 @@ bool axp_divi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *res, AX
     res->size = axp__div_digits(x_copy.digits, x_copy.size, y_copy.digits, y_copy.size, res->digits, &remainder_sz);
     goto cleanup_success;
 cleanup_error:
-    axp_freei(&x_copy);
-    axp_freei(&y_copy);
-    axp_freei(res);
+    axp_freei_ex(ctx, &x_copy);
+    axp_freei_ex(ctx, &y_copy);
+    axp_freei_ex(ctx, res);
     return false;
 cleanup_success:
     // a = bq + r => a/b = q + r/b
@@ -1005,8 +1837,8 @@ cleanup_success:
         remainder->size = remainder_sz ? remainder_sz : 1;
         remainder->sign = x->sign;
     }
-    else axp_freei(&x_copy);
-    axp_freei(&y_copy);
+    else axp_freei_ex(ctx, &x_copy);
+    axp_freei_ex(ctx, &y_copy);
     axp_error_reset(ctx);
     return true;
 }
@@ -1032,6 +1864,8 @@ bool axp_divf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float
     AXP_Float y_cpy = { 0 };
     if (!axp_copyf_ex_round(ctx, &x_cpy, x, precision + 1)) goto cleanup_error;
     if (!axp_copyf_ex_round(ctx, &y_cpy, y, precision + 1)) goto cleanup_error;
+    // The running remainder is shifted one digit past the divisor's length
+    if (!axp_reallocf(ctx, &x_cpy, precision + 2)) goto cleanup_error;
 
     axp_exp_t exp_adjust;
 
@@ -1039,11 +1873,11 @@ bool axp_divf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float
     res->size = res_sz;
     res->sign = x->sign ^ y->sign;
     // Exponent overflow check
-    if (axp__sub_exp_overflow(x->exponent, y->exponent)) {
-        axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow (%lld - %lld)", x->exponent, y->exponent);
+    if (axp__sub_exp_overflow(x_cpy.exponent, y_cpy.exponent)) {
+        axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow (%lld - %lld)", x_cpy.exponent, y_cpy.exponent);
         goto cleanup_error;
     }
-    res->exponent = x->exponent - y->exponent;
+    res->exponent = x_cpy.exponent - y_cpy.exponent;
     if (axp__add_exp_overflow(res->exponent, exp_adjust)) {
         axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow (%lld + %lld)", res->exponent, exp_adjust);
         goto cleanup_error;
@@ -1052,76 +1886,186 @@ bool axp_divf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float
     res->exponent += exp_adjust;
     axp_normalizef(res);
     if (!axp_reallocf_round(ctx, res, precision)) goto cleanup_error;
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
+    axp_freef_ex(ctx, &x_cpy);
+    axp_freef_ex(ctx, &y_cpy);
     axp_error_reset(ctx);
     return true;
 
 cleanup_error:
-    axp_freef(res);
-    axp_freef(&x_cpy);
-    axp_freef(&y_cpy);
+    axp_freef_ex(ctx, res);
+    axp_freef_ex(ctx, &x_cpy);
+    axp_freef_ex(ctx, &y_cpy);
     return false;
     return false;
 }
 
-axp_size_t axp__pow_digits(axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp_digit_t *tmp_buf, axp_digit_t *res) {
-    res[0] = 1;
-    axp_size_t res_sz = 1;
-    axp_size_t remainder = 0;
-    while (y != 0) {
-        remainder = y % 2;
-        y /= 2;
-
-        if (remainder) {
-            res_sz = axp__mul_digits(res, res_sz, x_digits, x_sz, tmp_buf);
-            memcpy(res, tmp_buf, res_sz * sizeof(axp_digit_t));
-            memset(tmp_buf, 0, res_sz * sizeof(axp_digit_t));
-        }
-        if (y != 0) {
-            x_sz = axp__mul_digits(x_digits, x_sz, x_digits, x_sz, tmp_buf);
-            memcpy(x_digits, tmp_buf, x_sz * sizeof(axp_digit_t));
-            memset(tmp_buf, 0, x_sz * sizeof(axp_digit_t));
+// Left-to-right binary powering. Exact products grow with the exponent, so a table of odd powers would turn
+// the cheap multiplications by the short base into long ones; squarings dominate either way.
+// res and tmp_buf take turns as the product target (both zeroed on entry), and the start buffer is picked
+// from the parity of the step count so the last product lands in res without a copy
+axp_size_t axp__pow_digits(const axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp_digit_t *tmp_buf, axp_digit_t *res) {
+    if (y == 0) {
+        res[0] = 1;
+        return 1;
+    }
+    int top = 31;
+    while (!((y >> top) & 1)) top--;
+    axp_size_t steps = (axp_size_t)top;
+    for (axp_size_t bits = y & (y - 1); bits; bits &= bits - 1) steps++;
+
+    axp_digit_t *cur = (steps % 2) ? tmp_buf : res;
+    axp_digit_t *next = (steps % 2) ? res : tmp_buf;
+    memcpy(cur, x_digits, x_sz * sizeof(axp_digit_t));
+    axp_size_t cur_sz = x_sz;
+    for (int i = top - 1; i >= 0; i--) {
+        axp_size_t next_sz = axp__mul_digits(cur, cur_sz, cur, cur_sz, next);
+        memset(cur, 0, cur_sz * sizeof(axp_digit_t));
+        axp_digit_t *swap = cur; cur = next; next = swap;
+        cur_sz = next_sz;
+        if ((y >> i) & 1) {
+            next_sz = axp__mul_digits(cur, cur_sz, x_digits, x_sz, next);
+            memset(cur, 0, cur_sz * sizeof(axp_digit_t));
+            swap = cur; cur = next; next = swap;
+            cur_sz = next_sz;
         }
     }
-    return res_sz;
+    return cur_sz;
 }
 
-axp_size_t axp__pow_digits_float(axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp_digit_t *tmp_buf, axp_digit_t *res, axp_size_t res_cap, axp_exp_t *exp_adj) {
-    res[0] = 1;
-    axp_size_t res_sz = 1;
-    *exp_adj = 0;
-    axp_exp_t x_exp_adj = 0;
+// Carried from one Ziv attempt to the next so a retry can refine the previous result instead of
+// starting over, `value` is left empty by attempts that have nothing to resume from.
+typedef struct {
+    AXP_Float value;
+    axp_size_t precision; // Correct digits of `value`
+    axp_size_t step;      // Progress behind `value`, the bits of y still to apply in x^y or the halvings k of exp
+} axp__ZivState;
+
+static inline void axp__ziv_state_free(AXP_Ctx *ctx, axp__ZivState *state) {
+    axp__releasef(ctx, &state->value);
+    state->precision = 0;
+    state->step = 0;
+}
+
+// a*b rounded to cap digits into dst (which may alias a or b); prod must be zeroed and is left zeroed
+static axp_size_t axp__mul_round_into(const axp_digit_t *a, axp_size_t a_sz, const axp_digit_t *b, axp_size_t b_sz, axp_digit_t *prod, axp_digit_t *dst, axp_size_t cap, axp_exp_t *adj) {
+    axp_size_t prod_sz = axp__mul_digits(a, a_sz, b, b_sz, prod);
+    axp_size_t shift;
+    axp_size_t sz = axp__round_digits_into(prod, prod_sz, dst, cap, &shift);
+    memset(prod, 0, prod_sz * sizeof(axp_digit_t));
+    *adj += (axp_exp_t)shift;
+    return sz;
+}
 
-    axp_size_t remainder = 0;
-    while (y != 0) {
-        remainder = y % 2;
-        y /= 2;
+static bool axp__pow_keep_exact(AXP_Ctx *ctx, axp__ZivState *state, const axp_digit_t *digits, axp_size_t sz, axp_size_t step) {
+    axp__releasef(ctx, &state->value);
+    if (!axp_initf_ex(ctx, &state->value, sz)) return false;
+    memcpy(state->value.digits, digits, sz * sizeof(axp_digit_t));
+    state->value.size = sz;
+    state->step = step;
+    return true;
+}
 
-        if (remainder) {
-            axp_size_t prod_sz = axp__mul_digits(res, res_sz, x_digits, x_sz, tmp_buf);
-            axp_size_t shift;
-            res_sz = axp__round_digits_into(tmp_buf, prod_sz, res, res_cap, &shift);
-            memset(tmp_buf, 0, prod_sz * sizeof(axp_digit_t));
-            *exp_adj += (axp_exp_t)shift + x_exp_adj;
+// Left-to-right sliding-window powering with every product rounded to res_cap digits (x_sz <= res_cap).
+// Once the operands fill res_cap all products cost the same, so the table of odd powers x, x^3, ...
+// pays for itself by saving one multiplication per window. The dropped digits land in exp_adj.
+// With a `state` the last exact power x^(y >> step) before the first rounding is kept there, and a
+// call with more room for the same x and y resumes from it instead of from x
+static bool axp__pow_digits_float_resume(AXP_Ctx *ctx, const axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp__ZivState *state, axp_digit_t *tmp_buf, axp_digit_t *res, axp_size_t res_cap, axp_size_t *res_sz, axp_exp_t *exp_adj) {
+    *exp_adj = 0;
+    if (y == 0) {
+        res[0] = 1;
+        *res_sz = 1;
+        return true;
+    }
+    int top = 31;
+    while (!((y >> top) & 1)) top--;
+    int width = (top < 8) ? 1 : ((top < 24) ? 2 : 3);
+    axp_size_t slots = (axp_size_t)1 << (width - 1);
+
+    // Slot k holds x^(2k+1); the extra slot holds x^2 while the table is built
+    axp_digit_t *table = axp__malloc(ctx, (size_t)(slots + 1) * res_cap * sizeof(axp_digit_t));
+    if (!table) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate the power table in `axp__pow_digits_float`.");
+        return false;
+    }
+    axp_size_t table_sz[4];
+    axp_exp_t table_adj[4];
+    memcpy(table, x_digits, x_sz * sizeof(axp_digit_t));
+    table_sz[0] = x_sz;
+    table_adj[0] = 0;
+    if (slots > 1) {
+        axp_digit_t *sq = table + slots * res_cap;
+        axp_exp_t sq_adj = 0;
+        axp_size_t sq_sz = axp__mul_round_into(table, x_sz, table, x_sz, tmp_buf, sq, res_cap, &sq_adj);
+        for (axp_size_t k = 1; k < slots; k++) {
+            table_adj[k] = table_adj[k - 1] + sq_adj;
+            table_sz[k] = axp__mul_round_into(table + (k - 1) * res_cap, table_sz[k - 1], sq, sq_sz, tmp_buf, table + k * res_cap, res_cap, &table_adj[k]);
         }
+    }
 
-        if (y != 0) {
-            axp_size_t prod_sz = axp__mul_digits(x_digits, x_sz, x_digits, x_sz, tmp_buf);
-            axp_size_t shift;
-            x_sz = axp__round_digits_into(tmp_buf, prod_sz, x_digits, res_cap, &shift);
-            memset(tmp_buf, 0, prod_sz * sizeof(axp_digit_t));
-            x_exp_adj = 2 * x_exp_adj + (axp_exp_t)shift;
+    axp_size_t cur_sz = 0;
+    int i = top;
+    axp_size_t kept = (axp_size_t)top + 1; // Bits of y left in the exact power held by state
+    if (state && state->value.digits && state->value.size <= res_cap) {
+        memcpy(res, state->value.digits, state->value.size * sizeof(axp_digit_t));
+        cur_sz = state->value.size;
+        kept = state->step;
+        i = (int)kept - 1;
+    }
+    bool ok = true;
+    while (i >= 0) {
+        int low = i;
+        axp_size_t slot = 0;
+        bool one = (y >> i) & 1;
+        if (one) {
+            low = (i - width + 1 > 0) ? i - width + 1 : 0;
+            while (!((y >> low) & 1)) low++;
+            slot = ((y >> low) & (((axp_size_t)1 << (i - low + 1)) - 1)) / 2;
+        }
+        // res = x^(y >> (i + 1)) is exact so far, keep it before a window that may round
+        if (state && cur_sz && *exp_adj == 0 && (axp_size_t)i + 1 < kept) {
+            bool exact = one ? table_adj[slot] == 0 && ((size_t)cur_sz << (i - low + 1)) + table_sz[slot] <= res_cap : 2 * (size_t)cur_sz <= res_cap;
+            if (!exact) {
+                kept = (axp_size_t)i + 1;
+                if (!(ok = axp__pow_keep_exact(ctx, state, res, cur_sz, kept))) break;
+            }
         }
+        if (!one) {
+            *exp_adj *= 2;
+            cur_sz = axp__mul_round_into(res, cur_sz, res, cur_sz, tmp_buf, res, res_cap, exp_adj);
+            i--;
+            continue;
+        }
+        if (!cur_sz) {
+            memcpy(res, table + slot * res_cap, table_sz[slot] * sizeof(axp_digit_t));
+            cur_sz = table_sz[slot];
+            *exp_adj = table_adj[slot];
+        } else {
+            for (int s = low; s <= i; s++) {
+                *exp_adj *= 2;
+                cur_sz = axp__mul_round_into(res, cur_sz, res, cur_sz, tmp_buf, res, res_cap, exp_adj);
+            }
+            *exp_adj += table_adj[slot];
+            cur_sz = axp__mul_round_into(res, cur_sz, table + slot * res_cap, table_sz[slot], tmp_buf, res, res_cap, exp_adj);
+        }
+        i = low - 1;
     }
-    return res_sz;
+    if (ok && state && *exp_adj == 0 && kept > 0) ok = axp__pow_keep_exact(ctx, state, res, cur_sz, 0);
+    axp__free(ctx, table, (size_t)(slots + 1) * res_cap * sizeof(axp_digit_t));
+    if (!ok) return false;
+    *res_sz = cur_sz;
+    return true;
+}
+
+bool axp__pow_digits_float(AXP_Ctx *ctx, const axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp_digit_t *tmp_buf, axp_digit_t *res, axp_size_t res_cap, axp_size_t *res_sz, axp_exp_t *exp_adj) {
+    return axp__pow_digits_float_resume(ctx, x_digits, x_sz, y, NULL, tmp_buf, res, res_cap, res_sz, exp_adj);
 }
 
 bool axp_powi(AXP_Ctx *ctx, AXP_Int *x, axp_size_t y, AXP_Int *res) {
     bool is_zero;
     if (!axp_is_zeroi(ctx, x, &is_zero)) return false;
     if (is_zero && !(y == 0)) {
-        if (!axp_copyi(ctx, res, x)) return false;
+        return axp_copyi(ctx, res, x);
     } else if (is_zero && y == 0) {
         axp_throw(ctx, AXP_ERR_DIV_ZERO, "0^0 is undefined.");
         return false;
@@ -1133,72 +2077,89 @@ bool axp_powi(AXP_Ctx *ctx, AXP_Int *x, axp_size_t y, AXP_Int *res) {
         return true;
     }
 
-    double logx = floor((y * (x->size - 1 + log10(x->digits[x->size - 1] + 1))));
-    
-    if (logx > (double)((axp_size_t)-1)) {
+    // x = m * 10^t gives m^y shifted by t*y digits, so a power of ten only writes its single 1
+    axp_size_t tz = 0;
+    while (x->digits[tz] == 0) tz++;
+    axp_size_t m_sz = x->size - tz;
+
+    double logx = floor((y * (m_sz - 1 + log10(x->digits[x->size - 1] + 1))));
+    double shift = (double)tz * (double)y;
+
+    if (logx + shift + 1 > (double)((axp_size_t)-1)) {
         axp_throw(ctx, AXP_ERR_OVERFLOW, "Integer overflow.");
         return false;
     }
-    
-    axp_size_t max_sz = (axp_size_t)logx + 1;
-    
-    AXP_Int tmp_buf;
-    AXP_Int x_copy = { 0 };
-    if (!axp_initi(ctx, res, max_sz)) goto cleanup_error;
-    if (!axp_initi(ctx, &tmp_buf, max_sz)) goto cleanup_error;
-    if (!axp_copyi_ex(ctx, &x_copy, x, max_sz)) goto cleanup_error;
 
-    res->size = axp__pow_digits(x_copy.digits, x_copy.size, y, tmp_buf.digits, res->digits);
+    axp_size_t pow_sz = (axp_size_t)logx + 1;
+    axp_size_t res_shift = tz * y;
+
+    if (!axp_initi(ctx, res, pow_sz + res_shift)) return false;
+    if (m_sz == 1 && x->digits[tz] == 1) {
+        res->digits[res_shift] = 1;
+        res->size = res_shift + 1;
+    } else {
+        AXP_Int tmp_buf;
+        if (!axp_initi(ctx, &tmp_buf, pow_sz)) {
+            axp_freei_ex(ctx, res);
+            return false;
+        }
+        res->size = res_shift + axp__pow_digits(x->digits + tz, m_sz, y, tmp_buf.digits, res->digits + res_shift);
+        axp_freei_ex(ctx, &tmp_buf);
+    }
     res->sign = (y % 2) && x->sign;
-    axp_freei(&tmp_buf);
-    axp_freei(&x_copy);
     axp_error_reset(ctx);
     return true;
-
-cleanup_error:
-    axp_freei(res);
-    axp_freei(&tmp_buf);
-    axp_freei(&x_copy);
-    return false;
 }
 
 bool axp_powf(AXP_Ctx *ctx, AXP_Float *x, axp_exp_t y, AXP_Float *res) {
     return axp_powf_ex(ctx, x, y, res, ctx->precision);
 }
 
-static bool axp__powf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_exp_t y, axp_size_t abs_y, axp_size_t guard, axp_size_t precision, axp_size_t extra, AXP_Float *out, bool *ambiguous) {
+// When the digits of x fit the working precision they are used as they are, and `state` keeps the
+// exact leading powers of x for the retries, which then only redo the products that were rounded
+static bool axp__powf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_exp_t y, axp_size_t abs_y, axp_size_t guard, axp_size_t precision, axp_size_t extra, axp__ZivState *state, AXP_Float *out, bool *ambiguous) {
     axp_size_t prec = precision + guard + extra;
 
     AXP_Float x_cpy = { 0 };
     AXP_Float tmp_buf = { 0 };
     AXP_Float res = { 0 };
     if (!axp_initf_ex(ctx, &res, prec)) return false;
-    if (!axp_initf_ex(ctx, &tmp_buf, 2 * prec)) { axp_freef(&res); return false; }
-    if (!axp_copyf_ex(ctx, &x_cpy, x, prec)) { axp_freef(&res); axp_freef(&tmp_buf); return false; }
+    if (!axp_initf_ex(ctx, &tmp_buf, 2 * prec)) { axp_freef_ex(ctx, &res); return false; }
+    axp_size_t tz = 0;
+    while (x->digits[tz] == 0) tz++;
+    bool exact = x->size - tz <= prec;
+    bool copy_ok = exact ? axp_initf_ex(ctx, &x_cpy, x->size - tz) : axp_copyf_ex(ctx, &x_cpy, x, prec);
+    if (!copy_ok) { axp_freef_ex(ctx, &res); axp_freef_ex(ctx, &tmp_buf); return false; }
+    if (exact) {
+        memcpy(x_cpy.digits, x->digits + tz, (x->size - tz) * sizeof(axp_digit_t));
+        x_cpy.size = x->size - tz;
+        x_cpy.exponent = x->exponent + (axp_exp_t)tz;
+    }
 
     axp_exp_t exp_adj;
-    res.size = axp__pow_digits_float(x_cpy.digits, x_cpy.size, abs_y, tmp_buf.digits, res.digits, prec, &exp_adj);
-    axp_freef(&tmp_buf);
-
-    if (axp__mul_exp_overflow(x->exponent, (axp_exp_t)abs_y)) {
-        axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow in `axp_powf` (%lld * %u)", x->exponent, abs_y);
-        axp_freef(&res); axp_freef(&x_cpy);
+    bool pow_ok = axp__pow_digits_float_resume(ctx, x_cpy.digits, x_cpy.size, abs_y, exact ? state : NULL, tmp_buf.digits, res.digits, prec, &res.size, &exp_adj);
+    axp_freef_ex(ctx, &tmp_buf);
+    if (!pow_ok) { axp_freef_ex(ctx, &res); axp_freef_ex(ctx, &x_cpy); return false; }
+
+    // x_cpy.exponent already accounts for any digits dropped by the copy
+    if (axp__mul_exp_overflow(x_cpy.exponent, (axp_exp_t)abs_y)) {
+        axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow in `axp_powf` (%lld * %u)", x_cpy.exponent, abs_y);
+        axp_freef_ex(ctx, &res); axp_freef_ex(ctx, &x_cpy);
         return false;
     }
-    res.exponent = x->exponent * (axp_exp_t)abs_y;
+    res.exponent = x_cpy.exponent * (axp_exp_t)abs_y;
     if (axp__add_exp_overflow(res.exponent, exp_adj)) {
         axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow in `axp_powf` (%lld + %lld)", res.exponent, exp_adj);
-        axp_freef(&res); axp_freef(&x_cpy);
+        axp_freef_ex(ctx, &res); axp_freef_ex(ctx, &x_cpy);
         return false;
     }
     res.exponent += exp_adj;
     res.sign = (abs_y % 2) && x->sign;
     axp_normalizef(&res);
-    axp_freef(&x_cpy);
+    axp_freef_ex(ctx, &x_cpy);
 
     if (y >= 0) {
-        axp_size_t safety = (res.size > precision) ? (res.size - precision) : 0;
-        *ambiguous = !axp__round_is_unambiguous(res.digits, safety);
+        if (ambiguous) *ambiguous = axp__ziv_is_ambiguous(&res, precision, extra);
         *out = res;
         axp_error_reset(ctx);
         return true;
@@ -1207,12 +2168,12 @@ static bool axp__powf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_exp_t y, axp
     AXP_Float one = { 0 };
     AXP_Float recip_raw = { 0 };
     AXP_Float res_cpy = { 0 };
-    if (!axp_initf_ex(ctx, &one, prec + 2)) { axp_freef(&res); return false; }
+    if (!axp_initf_ex(ctx, &one, prec + 2)) { axp_freef_ex(ctx, &res); return false; }
     one.digits[0] = 1;
     one.size = 1;
-    if (!axp_initf_ex(ctx, &recip_raw, target + 1)) { axp_freef(&res); axp_freef(&one); return false; }
+    if (!axp_initf_ex(ctx, &recip_raw, target + 1)) { axp_freef_ex(ctx, &res); axp_freef_ex(ctx, &one); return false; }
     if (!axp_copyf_ex_round(ctx, &res_cpy, &res, prec)) {
-        axp_freef(&res); axp_freef(&one); axp_freef(&recip_raw);
+        axp_freef_ex(ctx, &res); axp_freef_ex(ctx, &one); axp_freef_ex(ctx, &recip_raw);
         return false;
     }
 
@@ -1221,27 +2182,26 @@ static bool axp__powf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_exp_t y, axp
     recip_raw.size = recip_raw_sz;
     recip_raw.sign = res.sign;
 
-    bool overflow = axp__sub_exp_overflow(0, res.exponent);
+    bool overflow = axp__sub_exp_overflow(0, res_cpy.exponent);
     axp_exp_t base_exp = 0;
     if (!overflow) {
-        base_exp = -res.exponent;
+        base_exp = -res_cpy.exponent;
         overflow = axp__add_exp_overflow(base_exp, div_exp_adj);
     }
 
-    axp_freef(&one);
-    axp_freef(&res_cpy);
-    axp_freef(&res);
+    axp_freef_ex(ctx, &one);
+    axp_freef_ex(ctx, &res_cpy);
+    axp_freef_ex(ctx, &res);
 
     if (overflow) {
         axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow in `axp_powf` reciprocal");
-        axp_freef(&recip_raw);
+        axp_freef_ex(ctx, &recip_raw);
         return false;
     }
     recip_raw.exponent = base_exp + div_exp_adj;
     axp_normalizef(&recip_raw);
 
-    axp_size_t safety = (recip_raw.size > precision) ? (recip_raw.size - precision) : 0;
-    *ambiguous = !axp__round_is_unambiguous(recip_raw.digits, safety);
+    if (ambiguous) *ambiguous = axp__ziv_is_ambiguous(&recip_raw, precision, extra);
     *out = recip_raw;
     axp_error_reset(ctx);
     return true;
@@ -1270,6 +2230,23 @@ bool axp_powf_ex(AXP_Ctx *ctx, AXP_Float *x, axp_exp_t y, AXP_Float *res, axp_si
         res->size = 1;
         return true;
     }
+    axp_size_t tz = 0;
+    while (x->digits[tz] == 0) tz++;
+    if (tz == x->size - 1 && x->digits[tz] == 1) {
+        // (+-10^e)^y is exact, only the exponent moves
+        axp_exp_t e = x->exponent + (axp_exp_t)tz;
+        if (axp__mul_exp_overflow(e, y)) {
+            axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow in `axp_powf` (%lld * %lld)", (long long)e, (long long)y);
+            return false;
+        }
+        if (!axp_initf_ex(ctx, res, precision)) return false;
+        res->digits[0] = 1;
+        res->size = 1;
+        res->exponent = e * y;
+        res->sign = (y % 2 != 0) && x->sign;
+        axp_error_reset(ctx);
+        return true;
+    }
     axp_size_t abs_y = (axp_size_t)(y < 0 ? -y : y); // TODO: This may truncate y
 
     // floor(log2(abs_y)) extra precision needed (https://gitlab.inria.fr/mpfr/mpfr/-/blob/master/src/pow_ui.c?ref_type=heads line 96)
@@ -1281,99 +2258,666 @@ bool axp_powf_ex(AXP_Ctx *ctx, AXP_Float *x, axp_exp_t y, AXP_Float *res, axp_si
     axp_size_t extra = ctx->fast_rounding ? (axp_size_t)(y < 0 ? 1 : 0) : (ctx->ziv_safety_digits ? ctx->ziv_safety_digits : AXP_ZIV_DEFAULT_SAFETY_DIGITS);
     axp_size_t max_attempts = ctx->fast_rounding ? 1 : (ctx->ziv_max_retries ? ctx->ziv_max_retries : AXP_ZIV_DEFAULT_MAX_RETRIES);
 
+    axp__ZivState state = { 0 };
     for (axp_size_t attempt = 0; attempt < max_attempts; attempt++) {
         AXP_Float candidate = { 0 };
         bool ambiguous = false;
-        if (!axp__powf_attempt(ctx, x, y, abs_y, guard, precision, extra, &candidate, &ambiguous)) return false;
+        if (!axp__powf_attempt(ctx, x, y, abs_y, guard, precision, extra, &state, &candidate, &ambiguous)) { axp__ziv_state_free(ctx, &state); return false; }
         if (ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
+            axp__ziv_state_free(ctx, &state);
             *res = candidate;
             if (!axp_reallocf_round(ctx, res, precision)) return false;
             axp_error_reset(ctx);
             return true;
         }
-        axp_freef(&candidate);
+        axp_freef_ex(ctx, &candidate);
         extra *= 2;
     }
     UNREACHABLE("axp_powf_ex retry loop should always return");
     return false;
 }
 
-bool axp_e(AXP_Ctx *ctx, AXP_Float *res) {
-    return axp_e_ex(ctx, res, ctx->precision);
+static inline void axp__releasei(AXP_Ctx *ctx, AXP_Int *x) {
+    if (!x->digits) return;
+    axp_freei_ex(ctx, x);
+    x->digits = NULL;
 }
 
-bool axp_e_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision) {
-    axp_size_t guard = 0;
-    axp_size_t tmp_precision = precision;
+static bool axp__series_merge(AXP_Ctx *ctx, AXP_Series *left, AXP_Series *right) {
+    // P = P1*P2, Q = Q1*Q2, B = B1*B2, T = B2*Q2*T1 + B1*P1*T2
+    AXP_Series merged = { 0 };
+    AXP_Int scale = { 0 };
+    AXP_Int t1 = { 0 };
+    AXP_Int t2 = { 0 };
+
+    if (!axp_muli(ctx, &left->p, &right->p, &merged.p)) goto cleanup_error;
+    if (!axp_muli(ctx, &left->q, &right->q, &merged.q)) goto cleanup_error;
+    if (!axp_muli(ctx, &left->b, &right->b, &merged.b)) goto cleanup_error;
+
+    if (!axp_muli(ctx, &right->b, &right->q, &scale)) goto cleanup_error;
+    if (!axp_muli(ctx, &scale, &left->t, &t1)) goto cleanup_error;
+    axp__releasei(ctx, &scale);
+
+    if (!axp_muli(ctx, &left->b, &left->p, &scale)) goto cleanup_error;
+    if (!axp_muli(ctx, &scale, &right->t, &t2)) goto cleanup_error;
+    axp__releasei(ctx, &scale);
+
+    if (!axp_addi(ctx, &t1, &t2, &merged.t)) goto cleanup_error;
+    axp__releasei(ctx, &t1);
+    axp__releasei(ctx, &t2);
+
+    merged.terms = left->terms + right->terms;
+    axp_series_free(ctx, left);
+    axp_series_free(ctx, right);
+    *left = merged;
+    return true;
 
-    while (tmp_precision) { guard++; tmp_precision /= 10; }
-    axp_size_t workprec = precision + guard + 5;
-    
-    AXP_Float term = { 0 };
-    AXP_Float threshold = { 0 };
-    AXP_Float scratch = { 0 };
+cleanup_error:
+    axp__releasei(ctx, &scale);
+    axp__releasei(ctx, &t1);
+    axp__releasei(ctx, &t2);
+    axp_series_free(ctx, &merged);
+    axp_series_free(ctx, left);
+    axp_series_free(ctx, right);
+    return false;
+}
 
-    if (!axp_initf_ex(ctx, res, workprec)) return false;
-    if (!axp_initf_ex(ctx, &term, workprec)) goto cleanup_error;
-    if (!axp_initf_ex(ctx, &threshold, workprec)) goto cleanup_error;
-    if (!axp_initf_ex(ctx, &scratch, workprec)) goto cleanup_error;
+static bool axp__series_bsplit(AXP_Ctx *ctx, axp_series_term_fn term, void *user, axp_size_t from, axp_size_t to, AXP_Series *out) {
+    AXP_ASSERT(to > from);
+    if (to - from == 1) {
+        AXP_Int a = { 0 };
+        if (!term(ctx, user, from, &out->p, &out->q, &a, &out->b)) return false;
+        bool ok = axp_muli(ctx, &a, &out->p, &out->t);
+        axp_freei_ex(ctx, &a);
+        if (!ok) {
+            axp_series_free(ctx, out);
+            return false;
+        }
+        out->terms = 1;
+        return true;
+    }
 
-    term.digits[0] = 1;
-    term.size = 1;
+    axp_size_t mid = from + (to - from) / 2;
+    AXP_Series right = { 0 };
+    if (!axp__series_bsplit(ctx, term, user, from, mid, out)) return false;
+    if (!axp__series_bsplit(ctx, term, user, mid, to, &right)) {
+        axp_series_free(ctx, out);
+        return false;
+    }
+    return axp__series_merge(ctx, out, &right);
+}
 
-    threshold.digits[0] = 1;
-    threshold.size = 1;
-    threshold.exponent = -(axp_exp_t)(precision + guard);
+bool axp_series_extend(AXP_Ctx *ctx, AXP_Series *series, axp_series_term_fn term, void *user, axp_size_t terms) {
+    if (terms <= series->terms) {
+        axp_error_reset(ctx);
+        return true;
+    }
+    if (series->terms == 0) {
+        if (!axp__series_bsplit(ctx, term, user, 0, terms, series)) return false;
+        axp_error_reset(ctx);
+        return true;
+    }
 
-    res->digits[0] = 1; // First iteration just sets res to 1/0! = 1
-    res->size = 1;
+    AXP_Series tail = { 0 };
+    if (!axp__series_bsplit(ctx, term, user, series->terms, terms, &tail)) return false;
+    if (!axp__series_merge(ctx, series, &tail)) return false;
+    axp_error_reset(ctx);
+    return true;
+}
 
-    axp_size_t k = 1;
-    while (true) {
-        axp_exp_t new_exp;
-        scratch.size = axp__divf_uint(term.digits, term.size, term.exponent, k, scratch.digits, workprec, &new_exp);
-        scratch.exponent = new_exp;
-        scratch.sign     = term.sign;
-        axp__swapf(&term, &scratch);
-        
-        int8_t cmp;
-        if (!axp_abs_cmpf(ctx, &term, &threshold, &cmp)) goto cleanup_error;
-        if (cmp < 0) break;
+bool axp_series_sumf(AXP_Ctx *ctx, const AXP_Series *series, AXP_Float *res, axp_size_t precision) {
+    if (series->terms == 0) {
+        if (!axp_initf_ex(ctx, res, precision)) return false;
+        res->size = 1;
+        return true;
+    }
 
-        axp_align_float_digits(res, &term);
+    AXP_Int denom = { 0 };
+    if (!axp_muli(ctx, &series->b, &series->q, &denom)) return false;
 
-        scratch.size = axp__add_digits(res->digits, res->size, term.digits, term.size, scratch.digits);
-        scratch.exponent = res->exponent;
-        scratch.sign = 0;
-        axp__swapf(res, &scratch);
+    // Non-owning float views of the integers, `axp_divf_ex` only reads its operands
+    AXP_Float num_view = { series->t.size, series->t.capacity, series->t.digits, series->t.sign, 0 };
+    AXP_Float denom_view = { denom.size, denom.capacity, denom.digits, denom.sign, 0 };
+    bool ok = axp_divf_ex(ctx, &num_view, &denom_view, res, precision);
+    axp_freei_ex(ctx, &denom);
+    return ok;
+}
 
-        memset(scratch.digits, 0, scratch.size * sizeof(axp_digit_t));
-        scratch.size = 1;
-        scratch.exponent = 0;
-        k++;
+void axp_series_free(AXP_Ctx *ctx, AXP_Series *series) {
+    axp__releasei(ctx, &series->p);
+    axp__releasei(ctx, &series->q);
+    axp__releasei(ctx, &series->b);
+    axp__releasei(ctx, &series->t);
+    series->terms = 0;
+}
+
+// sum 1/k! = sum prod_{j<=k} 1/q(j) with q(0) = 1 and q(j) = j
+static bool axp__e_term(AXP_Ctx *ctx, void *user, axp_size_t k, AXP_Int *p, AXP_Int *q, AXP_Int *a, AXP_Int *b) {
+    (void)user;
+    if (!axp_initi_i64(ctx, p, 1)) return false;
+    if (!axp_initi_i64(ctx, q, k ? (int64_t)k : 1)) goto cleanup_error;
+    if (!axp_initi_i64(ctx, a, 1)) goto cleanup_error;
+    if (!axp_initi_i64(ctx, b, 1)) goto cleanup_error;
+    return true;
+cleanup_error:
+    axp__releasei(ctx, p);
+    axp__releasei(ctx, q);
+    axp__releasei(ctx, a);
+    return false;
+}
+
+// Smallest N such that the tail sum_{k>=N} 1/k! < 2/N! is below 10^-digits
+static axp_size_t axp__e_series_terms(axp_size_t digits) {
+    axp_size_t n = 1;
+    double log_fact = 0.0;
+    while (log_fact < (double)digits + 1.0) {
+        n++;
+        log_fact += log10((double)n);
+    }
+    return n;
+}
+
+typedef struct {
+    int64_t x;
+    bool alternating;
+} axp__ArctanArgs;
+
+// sum_k (-1)^k / ((2k+1) x^(2k+1)) = atan(1/x), without the sign changes it is atanh(1/x)
+static bool axp__arctan_term(AXP_Ctx *ctx, void *user, axp_size_t k, AXP_Int *p, AXP_Int *q, AXP_Int *a, AXP_Int *b) {
+    const axp__ArctanArgs *args = user;
+    if (!axp_initi_i64(ctx, p, (k && args->alternating) ? -1 : 1)) return false;
+    if (!axp_initi_i64(ctx, q, k ? args->x * args->x : args->x)) goto cleanup_error;
+    if (!axp_initi_i64(ctx, a, 1)) goto cleanup_error;
+    if (!axp_initi_i64(ctx, b, 2 * (int64_t)k + 1)) goto cleanup_error;
+    return true;
+cleanup_error:
+    axp__releasei(ctx, p);
+    axp__releasei(ctx, q);
+    axp__releasei(ctx, a);
+    return false;
+}
+
+// Each term shrinks by a factor of at least x^2
+static axp_size_t axp__arctan_series_terms(axp_size_t digits, int64_t x) {
+    return (axp_size_t)((double)digits / (2.0 * log10((double)x))) + 2;
+}
+
+// Chudnovsky: pi = 426880 sqrt(10005) / sum_k (-1)^k (6k)! (13591409 + 545140134 k) / ((3k)! (k!)^3 640320^(3k))
+// with the term ratio p(k)/q(k) = -(6k-5)(2k-1)(6k-1) / (k^3 640320^3 / 24)
+static bool axp__chudnovsky_term(AXP_Ctx *ctx, void *user, axp_size_t k, AXP_Int *p, AXP_Int *q, AXP_Int *a, AXP_Int *b) {
+    (void)user;
+    AXP_Int f = { 0 };
+    AXP_Int g = { 0 };
+    int64_t k64 = (int64_t)k;
+    if (k == 0) {
+        if (!axp_initi_i64(ctx, p, 1)) return false;
+        if (!axp_initi_i64(ctx, q, 1)) goto cleanup_error;
+    } else {
+        if (!axp_initi_i64(ctx, &f, -(6 * k64 - 5) * (2 * k64 - 1))) goto cleanup_error;
+        if (!axp_initi_i64(ctx, &g, 6 * k64 - 1)) goto cleanup_error;
+        if (!axp_muli(ctx, &f, &g, p)) goto cleanup_error;
+        axp_freei_ex(ctx, &f);
+        axp_freei_ex(ctx, &g);
+        f = (AXP_Int){ 0 };
+        g = (AXP_Int){ 0 };
+        if (!axp_initi_i64(ctx, &f, k64 * k64 * k64)) goto cleanup_error;
+        if (!axp_initi_i64(ctx, &g, 10939058860032000LL)) goto cleanup_error;
+        if (!axp_muli(ctx, &f, &g, q)) goto cleanup_error;
+        axp_freei_ex(ctx, &f);
+        axp_freei_ex(ctx, &g);
+        f = (AXP_Int){ 0 };
+        g = (AXP_Int){ 0 };
     }
+    if (!axp_initi_i64(ctx, a, 13591409 + 545140134 * k64)) goto cleanup_error;
+    if (!axp_initi_i64(ctx, b, 1)) goto cleanup_error;
+    return true;
+cleanup_error:
+    axp__releasei(ctx, &f);
+    axp__releasei(ctx, &g);
+    axp__releasei(ctx, p);
+    axp__releasei(ctx, q);
+    axp__releasei(ctx, a);
+    return false;
+}
 
-    axp_freef(&term);
-    axp_freef(&threshold);
-    axp_freef(&scratch);
+// Every Chudnovsky term adds log10(640320^3 / 1728) > 14.18 digits
+static axp_size_t axp__chudnovsky_series_terms(axp_size_t digits) {
+    return (axp_size_t)((double)digits / 14.18) + 2;
+}
 
-    axp_normalizef(res);
-    if (!axp_reallocf_round(ctx, res, precision)) goto cleanup_error;
+static bool axp__arctan_sumf(AXP_Ctx *ctx, AXP_Series *series, int64_t x, bool alternating, AXP_Float *res, axp_size_t precision) {
+    axp__ArctanArgs args = { x, alternating };
+    if (!axp_series_extend(ctx, series, axp__arctan_term, &args, axp__arctan_series_terms(precision, x))) return false;
+    return axp_series_sumf(ctx, series, res, precision);
+}
+
+// res = m*x + n*y, `y` may be NULL when n is 0
+static bool axp__combinef(AXP_Ctx *ctx, int64_t m, const AXP_Float *x, int64_t n, const AXP_Float *y, AXP_Float *res, axp_size_t precision) {
+    AXP_Int m_int = { 0 };
+    AXP_Int n_int = { 0 };
+    AXP_Float mx = { 0 };
+    AXP_Float ny = { 0 };
+
+    if (!axp_initi_i64(ctx, &m_int, m)) return false;
+    AXP_Float m_view = { m_int.size, m_int.capacity, m_int.digits, m_int.sign, 0 };
+    if (!axp_mulf_ex(ctx, &m_view, x, n ? &mx : res, precision)) goto cleanup_error;
+    if (!n) {
+        axp_freei_ex(ctx, &m_int);
+        return true;
+    }
+
+    if (!axp_initi_i64(ctx, &n_int, n)) goto cleanup_error;
+    AXP_Float n_view = { n_int.size, n_int.capacity, n_int.digits, n_int.sign, 0 };
+    if (!axp_mulf_ex(ctx, &n_view, y, &ny, precision)) goto cleanup_error;
+    if (!axp_addf_ex(ctx, &mx, &ny, res, precision)) goto cleanup_error;
+
+    axp_freei_ex(ctx, &m_int);
+    axp_freei_ex(ctx, &n_int);
+    axp_freef_ex(ctx, &mx);
+    axp_freef_ex(ctx, &ny);
     return true;
 
 cleanup_error:
-    axp_freef(res);
-    axp_freef(&term);
-    axp_freef(&threshold);
-    axp_freef(&scratch);
+    axp__releasei(ctx, &m_int);
+    axp__releasei(ctx, &n_int);
+    axp__releasef(ctx, &mx);
+    axp__releasef(ctx, &ny);
     return false;
 }
 
+static bool axp__const_compute(AXP_Ctx *ctx, AXP_Constant constant, AXP_Float *res, axp_size_t precision) {
+    AXP_ConstCacheEntry *entry = &ctx->constants[constant];
+    AXP_Float s0 = { 0 };
+    AXP_Float s1 = { 0 };
+    bool ok = false;
+
+    switch (constant) {
+    case AXP_CONST_E:
+        if (!axp_series_extend(ctx, &entry->series[0], axp__e_term, NULL, axp__e_series_terms(precision))) return false;
+        return axp_series_sumf(ctx, &entry->series[0], res, precision);
+    case AXP_CONST_LN2:
+        // ln 2 = 2 atanh(1/3)
+        if (!axp__arctan_sumf(ctx, &entry->series[0], 3, false, &s0, precision)) return false;
+        ok = axp__combinef(ctx, 2, &s0, 0, NULL, res, precision);
+        break;
+    case AXP_CONST_LN10:
+        // ln 10 = 3 ln 2 + ln(5/4) = 3 ln 2 + 2 atanh(1/9)
+        if (!axp_constf_ex(ctx, AXP_CONST_LN2, &s0, precision)) return false;
+        if (!axp__arctan_sumf(ctx, &entry->series[0], 9, false, &s1, precision)) break;
+        ok = axp__combinef(ctx, 3, &s0, 2, &s1, res, precision);
+        break;
+    case AXP_CONST_PI: {
+        // Chudnovsky: pi = 426880 sqrt(10005) / S
+        AXP_Int radicand = { 0 };
+        if (!axp_series_extend(ctx, &entry->series[0], axp__chudnovsky_term, NULL, axp__chudnovsky_series_terms(precision))) return false;
+        if (!axp_series_sumf(ctx, &entry->series[0], &s0, precision)) return false;
+        if (!axp_initi_i64(ctx, &radicand, 10005)) break;
+        AXP_Float radicand_view = { radicand.size, radicand.capacity, radicand.digits, radicand.sign, 0 };
+        AXP_Float root = { 0 };
+        ok = axp_sqrtf_ex(ctx, &radicand_view, &root, precision);
+        axp_freei_ex(ctx, &radicand);
+        if (!ok) break;
+        ok = axp__combinef(ctx, 426880, &root, 0, NULL, &s1, precision);
+        axp_freef_ex(ctx, &root);
+        if (!ok) break;
+        ok = axp_divf_ex(ctx, &s1, &s0, res, precision);
+        break;
+    }
+    default:
+        UNREACHABLE("Unknown constant");
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Unknown constant %d", (int)constant);
+        return false;
+    }
+
+    axp__releasef(ctx, &s0);
+    axp__releasef(ctx, &s1);
+    return ok;
+}
+
+bool axp_constf_ex(AXP_Ctx *ctx, AXP_Constant constant, AXP_Float *res, axp_size_t precision) {
+    if ((unsigned)constant >= AXP_CONST_COUNT) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Unknown constant %d", (int)constant);
+        return false;
+    }
+    AXP_ConstCacheEntry *entry = &ctx->constants[constant];
+
+    if (entry->precision < precision + 1) {
+        axp_size_t guard = 0;
+        axp_size_t tmp_precision = precision;
+        while (tmp_precision) { guard++; tmp_precision /= 10; }
+
+        // The few ulps lost while assembling the constant are eaten by the last two digits
+        AXP_Float value = { 0 };
+        if (!axp__const_compute(ctx, constant, &value, precision + guard + 4)) return false;
+        axp__releasef(ctx, &entry->value);
+        entry->value = value;
+        entry->precision = precision + guard + 2;
+    }
+
+    *res = (AXP_Float){ 0 };
+    if (!axp_copyf_ex_round(ctx, res, &entry->value, precision)) return false;
+    axp_normalizef(res);
+    axp_error_reset(ctx);
+    return true;
+}
+
+void axp_const_cache_free(AXP_Ctx *ctx) {
+    for (size_t i = 0; i < AXP_CONST_COUNT; i++) {
+        AXP_ConstCacheEntry *entry = &ctx->constants[i];
+        axp_series_free(ctx, &entry->series[0]);
+        axp_series_free(ctx, &entry->series[1]);
+        axp__releasef(ctx, &entry->value);
+        entry->precision = 0;
+    }
+}
+
+bool axp_e(AXP_Ctx *ctx, AXP_Float *res) {
+    return axp_e_ex(ctx, res, ctx->precision);
+}
+
+bool axp_e_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision) {
+    return axp_constf_ex(ctx, AXP_CONST_E, res, precision);
+}
+
+bool axp_ln2(AXP_Ctx *ctx, AXP_Float *res) {
+    return axp_ln2_ex(ctx, res, ctx->precision);
+}
+
+bool axp_ln2_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision) {
+    return axp_constf_ex(ctx, AXP_CONST_LN2, res, precision);
+}
+
+bool axp_ln10(AXP_Ctx *ctx, AXP_Float *res) {
+    return axp_ln10_ex(ctx, res, ctx->precision);
+}
+
+bool axp_ln10_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision) {
+    return axp_constf_ex(ctx, AXP_CONST_LN10, res, precision);
+}
+
+bool axp_pi(AXP_Ctx *ctx, AXP_Float *res) {
+    return axp_pi_ex(ctx, res, ctx->precision);
+}
+
+bool axp_pi_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision) {
+    return axp_constf_ex(ctx, AXP_CONST_PI, res, precision);
+}
+
 bool axp_expf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
     return axp_expf_ex(ctx, x, res, ctx->precision);
 }
 
-static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, AXP_Float *out, bool *ambiguous) {
+// acc = acc * y rounded to `precision` digits
+static bool axp__mulf_into(AXP_Ctx *ctx, AXP_Float *acc, const AXP_Float *y, axp_size_t precision) {
+    AXP_Float tmp = { 0 };
+    if (!axp_mulf_ex(ctx, acc, y, &tmp, precision)) return false;
+    axp_freef_ex(ctx, acc);
+    *acc = tmp;
+    return true;
+}
+
+// acc = acc + y rounded to `precision` digits
+static bool axp__addf_into(AXP_Ctx *ctx, AXP_Float *acc, const AXP_Float *y, axp_size_t precision) {
+    AXP_Float tmp = { 0 };
+    if (!axp_addf_ex(ctx, acc, y, &tmp, precision)) return false;
+    axp_freef_ex(ctx, acc);
+    *acc = tmp;
+    return true;
+}
+
+// acc = acc / d rounded to `precision` digits, a single pass of scalar long division
+static bool axp__divf_small_into(AXP_Ctx *ctx, AXP_Float *acc, axp_size_t d, axp_size_t precision) {
+    // Ten extra digits keep `precision` significant digits for any 32-bit divisor
+    axp_size_t cap = precision + 10;
+    if (acc->size < cap && acc->capacity < cap && !axp_reallocf(ctx, acc, cap)) return false;
+
+    AXP_Float tmp = { 0 };
+    if (!axp_initf_ex(ctx, &tmp, acc->size > cap ? acc->size : cap)) return false;
+    tmp.size = axp__divf_uint(acc->digits, acc->size, acc->exponent, d, tmp.digits, cap, &tmp.exponent);
+    tmp.sign = acc->sign;
+    axp_normalizef(&tmp);
+    if (!axp_reallocf_round(ctx, &tmp, precision)) {
+        axp_freef_ex(ctx, &tmp);
+        return false;
+    }
+    axp_freef_ex(ctx, acc);
+    *acc = tmp;
+    return true;
+}
+
+// Raw tier for iterative algorithms that correct their own errors (Newton steps, the inner exp of
+// powff). Nothing is copied, rounded or tested for ambiguity: operands are read through truncating
+// views of precision + 2 digits and results are truncated. Each operation is faithful, the error is
+// below 10^-precision relative to the largest operand, which is all a Newton step or a single Ziv
+// attempt at the outermost level needs.
+
+// View of the leading `digits` digits of x, smaller in magnitude by less than one unit of its last place
+static inline AXP_Float axp__truncf_view(const AXP_Float *x, axp_size_t digits) {
+    AXP_Float view = *x;
+    if (view.size > digits) {
+        axp_size_t drop = view.size - digits;
+        view.digits += drop;
+        view.size = digits;
+        view.capacity = digits;
+        view.exponent += (axp_exp_t)drop;
+    }
+    return view;
+}
+
+static void axp__truncf(AXP_Float *x, axp_size_t digits) {
+    if (x->size <= digits) return;
+    axp_size_t drop = x->size - digits;
+    memmove(x->digits, x->digits + drop, digits * sizeof(axp_digit_t));
+    memset(x->digits + digits, 0, drop * sizeof(axp_digit_t));
+    x->size = digits;
+    x->exponent += (axp_exp_t)drop;
+}
+
+static bool axp__mulf_raw(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float *res, axp_size_t precision) {
+    axp_size_t digits = precision + 2;
+    AXP_Float x_view = axp__truncf_view(x, digits);
+    AXP_Float y_view = axp__truncf_view(y, digits);
+    if (axp__add_exp_overflow(x_view.exponent, y_view.exponent)) {
+        axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow (%lld + %lld)", (long long)x_view.exponent, (long long)y_view.exponent);
+        return false;
+    }
+
+    if (!axp_initf_ex(ctx, res, x_view.size + y_view.size + 1)) return false;
+    res->size = axp__mul_digits(x_view.digits, x_view.size, y_view.digits, y_view.size, res->digits);
+    res->exponent = x_view.exponent + y_view.exponent;
+    res->sign = x->sign ^ y->sign;
+    axp_normalizef(res);
+    axp__truncf(res, digits);
+    axp_error_reset(ctx);
+    return true;
+}
+
+static bool axp__subf_raw(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float *res, axp_size_t precision) {
+    AXP_Float x_view = axp__truncf_view(x, precision + 2);
+    AXP_Float y_view = axp__truncf_view(y, precision + 2);
+    return axp_subf_ex(ctx, &x_view, &y_view, res, precision + 2);
+}
+
+// res = x^n for n >= 1 by binary powering on the raw tier, the relative error grows to about
+// n * 10^-precision so callers add the digits of n to `precision`
+static bool axp__powf_raw(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t n, AXP_Float *res, axp_size_t precision) {
+    AXP_Float base = { 0 };
+    AXP_Float acc = { 0 };
+    AXP_Float tmp = { 0 };
+    if (!axp_copyf_ex_round(ctx, &base, x, precision + 2)) return false;
+
+    while (true) {
+        if (n & 1) {
+            if (!acc.digits) {
+                if (!axp_copyf_exact(ctx, &acc, &base)) goto cleanup_error;
+            } else {
+                if (!axp__mulf_raw(ctx, &acc, &base, &tmp, precision)) goto cleanup_error;
+                axp_freef_ex(ctx, &acc);
+                acc = tmp;
+                tmp = (AXP_Float){ 0 };
+            }
+        }
+        n >>= 1;
+        if (!n) break;
+        if (!axp__mulf_raw(ctx, &base, &base, &tmp, precision)) goto cleanup_error;
+        axp_freef_ex(ctx, &base);
+        base = tmp;
+        tmp = (AXP_Float){ 0 };
+    }
+
+    axp_freef_ex(ctx, &base);
+    *res = acc;
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &base);
+    axp__releasef(ctx, &acc);
+    axp__releasef(ctx, &tmp);
+    return false;
+}
+
+// x = x * m for a scalar m < 2^32
+static axp_size_t axp__mul_small_digits(axp_digit_t *x_digits, axp_size_t x_sz, uint32_t m) {
+    uint64_t carry = 0;
+    for (axp_size_t i = 0; i < x_sz; i++) {
+        uint64_t cur = (uint64_t)x_digits[i] * m + carry;
+        x_digits[i] = (axp_digit_t)(cur % BASE);
+        carry = cur / BASE;
+    }
+    while (carry) {
+        x_digits[x_sz++] = (axp_digit_t)(carry % BASE);
+        carry /= BASE;
+    }
+    return x_sz;
+}
+
+// res = |x| / 2^k = |x| * 5^k * 10^-k rounded to `precision` digits
+static bool axp__expf_reduce(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t k, AXP_Float *res, axp_size_t precision) {
+    // Each factor 5^13 adds at most 10 digits before rounding back to precision + 1
+    if (!axp_initf_ex(ctx, res, precision + 11)) return false;
+    AXP_Float src = { 0 };
+    if (!axp_copyf_ex_round(ctx, &src, x, precision + 1)) {
+        axp_freef_ex(ctx, res);
+        return false;
+    }
+    memcpy(res->digits, src.digits, src.size * sizeof(axp_digit_t));
+    res->size = src.size;
+    res->exponent = src.exponent - (axp_exp_t)k;
+    res->sign = 0;
+    axp_freef_ex(ctx, &src);
+
+    for (axp_size_t left = k; left > 0;) {
+        axp_size_t chunk = left < 13 ? left : 13;
+        uint32_t m = 1;
+        for (axp_size_t i = 0; i < chunk; i++) m *= 5;
+        res->size = axp__mul_small_digits(res->digits, res->size, m);
+        axp_roundf(res, precision + 1);
+        left -= chunk;
+    }
+    axp_normalizef(res);
+    if (!axp_reallocf_round(ctx, res, precision)) {
+        axp_freef_ex(ctx, res);
+        return false;
+    }
+    return true;
+}
+
+// Taylor series of e^r evaluated with rectangular splitting:
+//   e^r = sum_j r^(jm) / (jm)! * T_j,  T_j = 1 + r/(jm+1) + r^2/((jm+1)(jm+2)) + ...
+// The T_j only need scalar divisions by the precomputed powers r^1..r^(m-1), and the blocks are
+// combined with Horner's rule in r^m, so about 2*sqrt(N) full multiplications are done for N terms.
+static bool axp__expf_taylor(AXP_Ctx *ctx, const AXP_Float *r, axp_size_t terms, AXP_Float *res, axp_size_t precision) {
+    axp_size_t m = 1;
+    while (m * m < terms) m++;
+
+    AXP_Float *powers = axp__calloc(ctx, m + 1, sizeof(AXP_Float));
+    if (!powers) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp__expf_taylor`.", (m + 1) * sizeof(AXP_Float));
+        return false;
+    }
+    AXP_Float block = { 0 };
+    bool have_res = false;
+
+    if (!axp_initf_ex(ctx, &powers[0], 1)) goto cleanup_error;
+    powers[0].digits[0] = 1;
+    if (!axp_copyf_ex_round(ctx, &powers[1], r, precision)) goto cleanup_error;
+    for (axp_size_t i = 2; i <= m; i++) {
+        if (!axp_mulf_ex(ctx, &powers[i - 1], r, &powers[i], precision)) goto cleanup_error;
+    }
+
+    axp_size_t blocks = (terms + m - 1) / m;
+    for (axp_size_t j = blocks; j-- > 0;) {
+        axp_size_t base = j * m;
+        axp_size_t len = (terms - base < m) ? terms - base : m;
+
+        // T_j by Horner's rule on the scalar divisors
+        if (!axp_copyf_exact(ctx, &block, &powers[len - 1])) goto cleanup_error;
+        for (axp_size_t i = len - 1; i > 0; i--) {
+            if (!axp__divf_small_into(ctx, &block, (axp_size_t)(base + i), precision)) goto cleanup_error;
+            if (!axp__addf_into(ctx, &block, &powers[i - 1], precision)) goto cleanup_error;
+        }
+
+        if (have_res) {
+            // res = T_j + res * r^m / ((jm+1)...(jm+m))
+            if (!axp__mulf_into(ctx, res, &powers[m], precision)) goto cleanup_error;
+            for (axp_size_t i = m; i > 0; i--) {
+                if (!axp__divf_small_into(ctx, res, (axp_size_t)(base + i), precision)) goto cleanup_error;
+            }
+            if (!axp__addf_into(ctx, res, &block, precision)) goto cleanup_error;
+            axp_freef_ex(ctx, &block);
+        } else {
+            *res = block;
+            have_res = true;
+        }
+        block = (AXP_Float){ 0 };
+    }
+
+    for (axp_size_t i = 0; i <= m; i++) {
+        if (powers[i].digits) axp_freef_ex(ctx, &powers[i]);
+    }
+    axp__free(ctx, powers, (m + 1) * sizeof(AXP_Float));
+    return true;
+
+cleanup_error:
+    for (axp_size_t i = 0; i <= m; i++) {
+        if (powers[i].digits) axp_freef_ex(ctx, &powers[i]);
+    }
+    axp__free(ctx, powers, (m + 1) * sizeof(AXP_Float));
+    if (block.digits) axp_freef_ex(ctx, &block);
+    if (have_res) axp_freef_ex(ctx, res);
+    return false;
+}
+
+// Smallest N with r^N / N! below 10^-digits for r < 2^-k
+static axp_size_t axp__expf_taylor_terms(axp_size_t digits, axp_size_t k) {
+    double term_log10 = 0.0;
+    axp_size_t terms = 1;
+    while (term_log10 < (double)digits + 1.0) {
+        term_log10 += (double)k * 0.30102999566398120 + log10((double)terms);
+        terms++;
+    }
+    return terms;
+}
+
+// Picks the reduction k minimizing the rectangular splitting cost, in units of `digits`-digit scalar
+// passes: k squarings and ~2*sqrt(N) multiplications of `digits` passes each, plus N scalar divisions.
+static axp_size_t axp__expf_rect_cost(axp_size_t digits, double *cost) {
+    axp_size_t best_k = 1;
+    double best_cost = 0.0;
+    axp_size_t max_k = (axp_size_t)sqrt((double)digits * 3.3219280948873623) + 1;
+    for (axp_size_t k = 1; k <= max_k; k++) {
+        double terms = (double)axp__expf_taylor_terms(digits, k);
+        double c = ((double)k + 2.0 * sqrt(terms)) * (double)digits + 8.0 * terms;
+        if (k == 1 || c < best_cost) {
+            best_k = k;
+            best_cost = c;
+        }
+    }
+    if (cost) *cost = best_cost;
+    return best_k;
+}
+
+static bool axp__expf_attempt_direct(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, AXP_Float *out, bool *ambiguous) {
     axp_size_t guard = 0;
     axp_size_t tmp_precision = precision;
     while (tmp_precision) { guard++; tmp_precision /= 10; }
@@ -1385,7 +2929,7 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
 
     AXP_Int n_probe = { 0 };
     AXP_Float frac_probe = { 0 };
-    if (!axp_floorf(ctx, &x_probe, &n_probe, &frac_probe)) { axp_freef(&x_probe); return false; }
+    if (!axp_floorf(ctx, &x_probe, &n_probe, &frac_probe)) { axp_freef_ex(ctx, &x_probe); return false; }
 
     // TODO: Overflow check
     axp_exp_t n = 0;
@@ -1393,9 +2937,9 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
         n *= 10;
         n += n_probe.digits[i-1];
     }
-    axp_freef(&x_probe);
-    axp_freef(&frac_probe);
-    axp_freei(&n_probe);
+    axp_freef_ex(ctx, &x_probe);
+    axp_freef_ex(ctx, &frac_probe);
+    axp_freei_ex(ctx, &n_probe);
 
     axp_size_t pow_guard = 0;
     if (n != 0) {
@@ -1407,18 +2951,17 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
     axp_size_t workprec = precision + guard + extra + pow_guard;
 
     AXP_Float x_abs = { 0 };
-    if (!axp_copyf_ex(ctx, &x_abs, x, workprec)) return false;
-    x_abs.sign = 0;
-
     AXP_Float frac = { 0 };
     AXP_Int int_part = { 0 };
-    if (!axp_floorf(ctx, &x_abs, &int_part, &frac)) goto cleanup_error;
-
     AXP_Float res = { 0 };
     AXP_Float term = { 0 };
     AXP_Float scratch = { 0 };
     AXP_Float mul_buf  = { 0 };
     AXP_Float threshold = { 0 };
+    if (!axp_copyf_ex(ctx, &x_abs, x, workprec)) return false;
+    x_abs.sign = 0;
+    if (!axp_floorf(ctx, &x_abs, &int_part, &frac)) goto cleanup_error;
+
     if (!axp_initf_ex(ctx, &res, workprec)) goto cleanup_error;
     if (!axp_initf_ex(ctx, &term, workprec)) goto cleanup_error;
     if (!axp_initf_ex(ctx, &scratch, workprec)) goto cleanup_error;
@@ -1436,6 +2979,12 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
     term.digits[0] = 1;
     term.size = 1;
 
+    // When the partial sum is the result (0 <= x < 1) the summation stops as soon as the running error
+    // bound can no longer change the rounded digits. With r = frac/(k+1) <= 1/2 the tail after term k
+    // is below term k, the accumulated truncation errors stay below 10^-(workprec-3).
+    bool settle = ambiguous && n == 0 && !x->sign;
+    bool settled = false;
+
     axp_size_t k = 1;
     while (true) {
         axp_size_t prod_sz = axp__mul_digits(term.digits, term.size, frac.digits, frac.size, mul_buf.digits);
@@ -1468,6 +3017,15 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
         scratch.size = 1;
         scratch.exponent = 0;
         k++;
+
+        if (settle) {
+            axp_exp_t term_mag = term.exponent + (axp_exp_t)term.size;
+            axp_exp_t err_exp = (term_mag > 3 - (axp_exp_t)workprec) ? term_mag : 3 - (axp_exp_t)workprec;
+            if (axp__round_is_settled(&res, precision, err_exp + 1)) {
+                settled = true;
+                break;
+            }
+        }
     }
 
     if (n != 0) {
@@ -1477,20 +3035,20 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
 
         if (!axp_e_ex(ctx, &e_val, workprec)) goto cleanup_error;
 
-        if (!axp_initf_ex(ctx, &tmp, workprec * 2)) { axp_freef(&e_val); goto cleanup_error; }
-        if (!axp_initf_ex(ctx, &e_n, workprec)) { axp_freef(&e_val); axp_freef(&tmp); goto cleanup_error; }
+        if (!axp_initf_ex(ctx, &tmp, workprec * 2)) { axp_freef_ex(ctx, &e_val); goto cleanup_error; }
+        if (!axp_initf_ex(ctx, &e_n, workprec)) { axp_freef_ex(ctx, &e_val); axp_freef_ex(ctx, &tmp); goto cleanup_error; }
 
         axp_exp_t exp_adj;
-        axp_size_t prod_sz = axp__pow_digits_float(e_val.digits, e_val.size, (axp_size_t)n, tmp.digits, e_n.digits, workprec, &exp_adj);
-        e_n.size = prod_sz;
+        bool pow_ok = axp__pow_digits_float(ctx, e_val.digits, e_val.size, (axp_size_t)n, tmp.digits, e_n.digits, workprec, &e_n.size, &exp_adj);
         e_n.exponent = e_val.exponent * (axp_exp_t)n + exp_adj;
         e_n.sign = 0;
 
-        axp_freef(&e_val);
-        axp_freef(&tmp);
+        axp_freef_ex(ctx, &e_val);
+        axp_freef_ex(ctx, &tmp);
+        if (!pow_ok) { axp_freef_ex(ctx, &e_n); goto cleanup_error; }
 
         AXP_Float final = { 0 };
-        if (!axp_initf_ex(ctx, &final, workprec * 2)) { axp_freef(&e_n); goto cleanup_error; }
+        if (!axp_initf_ex(ctx, &final, workprec * 2)) { axp_freef_ex(ctx, &e_n); goto cleanup_error; }
 
         axp_size_t final_sz = axp__mul_digits(res.digits, res.size, e_n.digits, e_n.size, final.digits);
         axp_size_t shift = (final_sz > workprec) ? (final_sz - workprec) : 0;
@@ -1500,8 +3058,8 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
         final.exponent = res.exponent + e_n.exponent + (axp_exp_t)shift;
         final.sign = 0;
 
-        axp_freef(&e_n);
-        axp_freef(&res);
+        axp_freef_ex(ctx, &e_n);
+        axp_freef_ex(ctx, &res);
         res = final;
     }
 
@@ -1514,8 +3072,8 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
         one.digits[0] = 1;
         one.size = 1;
 
-        if (!axp_initf_ex(ctx, &recip, workprec)) { axp_freef(&one); goto cleanup_error; }
-        if (!axp_copyf_exact(ctx, &res_cpy, &res)) { axp_freef(&one); axp_freef(&recip); goto cleanup_error; }
+        if (!axp_initf_ex(ctx, &recip, workprec)) { axp_freef_ex(ctx, &one); goto cleanup_error; }
+        if (!axp_copyf_exact(ctx, &res_cpy, &res)) { axp_freef_ex(ctx, &one); axp_freef_ex(ctx, &recip); goto cleanup_error; }
 
         axp_exp_t div_exp_adj;
         axp_size_t recip_sz = axp__div_digits_float(one.digits, one.size, res_cpy.digits, res_cpy.size, recip.digits, workprec, &div_exp_adj);
@@ -1525,57 +3083,157 @@ static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t preci
 
         axp_normalizef(&recip);
 
-        axp_freef(&one);
-        axp_freef(&res_cpy);
-        axp_freef(&res);
+        axp_freef_ex(ctx, &one);
+        axp_freef_ex(ctx, &res_cpy);
+        axp_freef_ex(ctx, &res);
 
         res = recip;
     }
 
     axp_normalizef(&res);
 
-    axp_freef(&x_abs);
-    axp_freef(&frac);
-    axp_freei(&int_part);
-    axp_freef(&term);
-    axp_freef(&scratch);
-    axp_freef(&mul_buf);
-    axp_freef(&threshold);
+    axp_freef_ex(ctx, &x_abs);
+    axp_freef_ex(ctx, &frac);
+    axp_freei_ex(ctx, &int_part);
+    axp_freef_ex(ctx, &term);
+    axp_freef_ex(ctx, &scratch);
+    axp_freef_ex(ctx, &mul_buf);
+    axp_freef_ex(ctx, &threshold);
 
-    axp_size_t safety = (res.size > precision) ? (res.size - precision) : 0;
-    *ambiguous = !axp__round_is_unambiguous(res.digits, safety);
+    if (ambiguous) *ambiguous = !settled && axp__ziv_is_ambiguous(&res, precision, extra);
+    *out = res;
+
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp_freef_ex(ctx, &x_abs);
+    axp_freef_ex(ctx, &frac);
+    axp_freei_ex(ctx, &int_part);
+    axp_freef_ex(ctx, &term);
+    axp_freef_ex(ctx, &scratch);
+    axp_freef_ex(ctx, &mul_buf);
+    axp_freef_ex(ctx, &threshold);
+    axp_freef_ex(ctx, &res);
+    return false;
+}
+
+
+// A retry keeps the k of the first attempt, `state` holds r = |x| / 2^k to twice the digits that
+// attempt needed, which covers the next few doubled guard digits without reducing x again
+static bool axp__expf_attempt_rect(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, axp__ZivState *state, AXP_Float *out, bool *ambiguous) {
+    axp_size_t guard = 0;
+    axp_size_t tmp_precision = precision;
+    while (tmp_precision) { guard++; tmp_precision /= 10; }
+
+    // |x| < 10^mag
+    axp_exp_t mag = x->exponent + (axp_exp_t)x->size;
+
+    // Reduce to r = |x| / 2^k with r < 2^-k0, then e^|x| = (e^r)^(2^k). Every squaring doubles the
+    // relative error so k*log10(2) extra digits are carried through the whole computation.
+    axp_size_t base_prec = precision + guard + extra;
+    axp_size_t int_bits = (mag > 0) ? (axp_size_t)ceil((double)mag * 3.3219280948873623) : 0;
+    axp_size_t k = (state && state->value.digits) ? state->step : axp__expf_rect_cost(base_prec, NULL) + int_bits;
+    axp_size_t workprec = base_prec + (axp_size_t)((double)k * 0.30102999566398120) + 2;
+
+    AXP_Float r = { 0 };
+    AXP_Float res = { 0 };
+    if (state && state->value.digits && state->precision >= workprec) {
+        if (!axp_copyf_ex_round(ctx, &r, &state->value, workprec)) return false;
+    } else if (state) {
+        axp__ziv_state_free(ctx, state);
+        AXP_Float reduced = { 0 };
+        if (!axp__expf_reduce(ctx, x, k, &reduced, 2 * workprec)) return false;
+        state->value = reduced;
+        state->precision = 2 * workprec;
+        state->step = k;
+        if (!axp_copyf_ex_round(ctx, &r, &state->value, workprec)) return false;
+    } else if (!axp__expf_reduce(ctx, x, k, &r, workprec)) {
+        return false;
+    }
+
+    bool ok = axp__expf_taylor(ctx, &r, axp__expf_taylor_terms(workprec, k - int_bits), &res, workprec);
+    axp_freef_ex(ctx, &r);
+    if (!ok) return false;
+
+    for (axp_size_t i = 0; i < k; i++) {
+        if (!axp__mulf_into(ctx, &res, &res, workprec)) goto cleanup_error;
+    }
+
+    if (x->sign) {
+        AXP_Float one = { 0 };
+        AXP_Float recip = { 0 };
+        if (!axp_initf_ex(ctx, &one, 1)) goto cleanup_error;
+        one.digits[0] = 1;
+        ok = axp_divf_ex(ctx, &one, &res, &recip, workprec);
+        axp_freef_ex(ctx, &one);
+        if (!ok) goto cleanup_error;
+        axp_freef_ex(ctx, &res);
+        res = recip;
+    }
+
+    axp_normalizef(&res);
+    if (ambiguous) *ambiguous = axp__ziv_is_ambiguous(&res, precision, extra);
     *out = res;
 
     axp_error_reset(ctx);
     return true;
 
 cleanup_error:
-    axp_freef(&x_abs);
-    axp_freef(&frac);
-    axp_freei(&int_part);
-    axp_freef(&term);
-    axp_freef(&scratch);
-    axp_freef(&mul_buf);
-    axp_freef(&threshold);
-    axp_freef(&res);
+    axp_freef_ex(ctx, &res);
     return false;
 }
 
+#define AXP__EXPF_MAX_ARG (2.302585092994045684 * ((double)AXP_EXP_MAX - 4.0 * (double)UINT32_MAX))
+
+// `state` is only filled by the rectangular splitting, a retry stays on that path once it holds r
+static bool axp__expf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, axp__ZivState *state, AXP_Float *out, bool *ambiguous) {
+    // |x| < 10^mag. e^|x| = 10^(|x| / ln 10) needs its decimal exponent in axp_exp_t, less some room for the
+    // working digits, so |x| is bounded by about ln(10) * AXP_EXP_MAX ~ 2.1e19
+    axp_exp_t mag = x->exponent + (axp_exp_t)x->size;
+    if (mag > 18 && (mag > 20 || fabs(axp__float_to_double(x)) >= AXP__EXPF_MAX_ARG)) {
+        axp_throw(ctx, AXP_ERR_OVERFLOW, "Exponent overflow in `axp_expf`, |x| >= %.17g", AXP__EXPF_MAX_ARG);
+        return false;
+    }
+
+    // The direct series multiplies every term by the fractional digits of x only, which is cheap when
+    // x is short, e.g. a literal. Full length arguments go through reduction + rectangular splitting.
+    axp_size_t digits = precision + extra;
+    axp_size_t frac_len = (x->exponent < 0) ? (axp_size_t)((axp_exp_t)x->size < -x->exponent ? (axp_exp_t)x->size : -x->exponent) : 0;
+    double int_bits = (mag > 0) ? (double)mag * 3.3219280948873623 : 0.0;
+    double direct_cost = (double)axp__e_series_terms(digits) * (double)(frac_len + 8) + 2.0 * int_bits * (double)digits;
+    double rect_cost;
+    axp__expf_rect_cost(digits, &rect_cost);
+    rect_cost += int_bits * (double)digits;
+
+    // The direct series raises e to the integer part of x, which has to fit in axp_size_t
+    if (mag <= 9 && direct_cost <= rect_cost && !(state && state->value.digits)) return axp__expf_attempt_direct(ctx, x, precision, extra, out, ambiguous);
+    return axp__expf_attempt_rect(ctx, x, precision, extra, state, out, ambiguous);
+}
+
+// Raw tier exp, a single attempt without the Ziv test, relative error below 10^-precision. Attempts
+// take a NULL `ambiguous` as a raw call, they then neither test nor stop early on the rounding.
+static bool axp__expf_raw(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    return axp__expf_attempt(ctx, x, precision, 0, NULL, res, NULL);
+}
+
 bool axp_expf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
     axp_size_t extra = ctx->fast_rounding ? (axp_size_t)(5 + (x->sign ? 1 : 0)) : (ctx->ziv_safety_digits ? ctx->ziv_safety_digits : AXP_ZIV_DEFAULT_SAFETY_DIGITS);
     axp_size_t max_attempts = ctx->fast_rounding ? 1 : (ctx->ziv_max_retries ? ctx->ziv_max_retries : AXP_ZIV_DEFAULT_MAX_RETRIES);
 
+    axp__ZivState state = { 0 };
     for (axp_size_t attempt = 0; attempt < max_attempts; attempt++) {
         AXP_Float candidate = { 0 };
         bool ambiguous = false;
-        if (!axp__expf_attempt(ctx, x, precision, extra, &candidate, &ambiguous)) return false;
+        if (!axp__expf_attempt(ctx, x, precision, extra, &state, &candidate, &ambiguous)) { axp__ziv_state_free(ctx, &state); return false; }
         if (ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
+            axp__ziv_state_free(ctx, &state);
             *res = candidate;
             if (!axp_reallocf_round(ctx, res, precision)) return false;
             axp_error_reset(ctx);
             return true;
         }
-        axp_freef(&candidate);
+        axp_freef_ex(ctx, &candidate);
         extra *= 2;
     }
     UNREACHABLE("axp_expf_ex retry loop should always return");
@@ -1637,7 +3295,7 @@ bool axp_expf_no_splitting(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp
         if (cmp < 0) break;
 
         // TODO: This just keeps allocating scratch and its unecessary however i could not get the axp__add_digits to work for some reason...
-        axp_freef(&scratch);
+        axp_freef_ex(ctx, &scratch);
         axp_addf_ex(ctx, res, &term, &scratch, workprec);
         axp__swapf(res, &scratch);
         memset(scratch.digits, 0, scratch.capacity * sizeof(axp_digit_t));
@@ -1650,20 +3308,20 @@ bool axp_expf_no_splitting(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp
     axp_normalizef(res);
     if (!axp_reallocf_round(ctx, res, precision)) goto cleanup_error;
 
-    axp_freef(&x_abs);
-    axp_freef(&term);
-    axp_freef(&scratch);
-    axp_freef(&mul_buf);
-    axp_freef(&threshold);
+    axp_freef_ex(ctx, &x_abs);
+    axp_freef_ex(ctx, &term);
+    axp_freef_ex(ctx, &scratch);
+    axp_freef_ex(ctx, &mul_buf);
+    axp_freef_ex(ctx, &threshold);
     return true;
 
 cleanup_error:
-    axp_freef(&x_abs);
-    axp_freef(&term);
-    axp_freef(&scratch);
-    axp_freef(&mul_buf);
-    axp_freef(&threshold);
-    axp_freef(res);
+    axp_freef_ex(ctx, &x_abs);
+    axp_freef_ex(ctx, &term);
+    axp_freef_ex(ctx, &scratch);
+    axp_freef_ex(ctx, &mul_buf);
+    axp_freef_ex(ctx, &threshold);
+    axp_freef_ex(ctx, res);
     return false;
 }
 
@@ -1671,516 +3329,3463 @@ bool axp_lnf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
     return axp_lnf_ex(ctx, x, res, ctx->precision);
 }
 
-static bool axp__lnf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, AXP_Float *out, bool *ambiguous) {
-    axp_size_t guard = 0;
-    axp_size_t tmp_precision = precision;
-    while (tmp_precision) { guard++; tmp_precision /= 10; }
-    axp_size_t workprec = precision + guard + extra;
-
-    AXP_Float y = { 0 };
-    if (!axp__double_to_float(ctx, axp__lnf_seed(x), &y)) return false;
+#define AXP__NEWTON_SEED_DIGITS 14
+#define AXP__NEWTON_GUARD 3
 
-    axp_size_t cur_prec = (workprec < 18) ? workprec : 18;
-    if (!axp_reallocf_round(ctx, &y, cur_prec)) { axp_freef(&y); return false; }
+// Correct digits after each step of a Newton iteration from a double seed (trusted to AXP__NEWTON_SEED_DIGITS digits)
+// up to `target`, largest first. A step squares the relative error times a constant below 10^c_digits and is run
+// with AXP__NEWTON_GUARD extra digits for its own rounding, so it needs (target + c_digits + 1) / 2 + 1 digits going in
+static axp_size_t axp__newton_ladder(axp_size_t target, axp_size_t c_digits, axp_size_t steps[64]) {
+    axp_size_t count = 0;
+    for (axp_size_t q = target; q > AXP__NEWTON_SEED_DIGITS && count < 64; q = (q + c_digits + 1) / 2 + 1) steps[count++] = q;
+    return count;
+}
 
+// res = 1/sqrt(a) for a > 0 by the division free Newton iteration y += y*(1 - a*y^2)/2 from a double
+// seed, rounded to `precision` digits from a value good to precision + 2
+static bool axp__rsqrtf(AXP_Ctx *ctx, const AXP_Float *a, AXP_Float *res, axp_size_t precision) {
+    // a = a' * 10^(2q) with a' in [1, 100) keeps the seed inside the double range
+    axp_exp_t e10 = a->exponent + (axp_exp_t)a->size - 1;
+    axp_exp_t q = (e10 >= 0) ? e10 / 2 : -((1 - e10) / 2);
+    AXP_Float a_scaled = *a;
+    a_scaled.exponent -= 2 * q;
+
+    axp_digit_t five = 5;
+    const AXP_Float half = { 1, 1, &five, 0, -1 };
     AXP_Float one = { 0 };
-    if (!axp_initf_ex(ctx, &one, 1)) { axp_freef(&y); return false; }
+    AXP_Float y = { 0 };
+    AXP_Float t = { 0 };
+    if (!axp_initf_ex(ctx, &one, 1)) return false;
     one.digits[0] = 1;
-    one.size = 1;
-
-    while (cur_prec < workprec) {
-        cur_prec = (cur_prec * 2 < workprec) ? cur_prec * 2 : workprec;
-
-        AXP_Float neg_y = { 0 };
-        if (!axp_copyf_exact(ctx, &neg_y, &y)) goto cleanup_error;
-        neg_y.sign = 1 - neg_y.sign;
-
-        AXP_Float exp_neg_y = { 0 };
-        bool ok = axp_expf_ex(ctx, &neg_y, &exp_neg_y, cur_prec);
-        axp_freef(&neg_y);
-        if (!ok) goto cleanup_error;
-
-        AXP_Float term = { 0 };
-        ok = axp_mulf_ex(ctx, x, &exp_neg_y, &term, cur_prec);
-        axp_freef(&exp_neg_y);
-        if (!ok) goto cleanup_error;
-
-        AXP_Float correction = { 0 };
-        ok = axp_subf_ex(ctx, &term, &one, &correction, cur_prec);
-        axp_freef(&term);
+    if (!axp__double_to_float(ctx, 1.0 / sqrt(axp__float_to_double(&a_scaled)), &y)) goto cleanup_error;
+
+    axp_size_t steps[64];
+    for (axp_size_t left = axp__newton_ladder(precision + 2, 1, steps); left > 0; left--) {
+        axp_size_t cur_prec = steps[left - 1] + AXP__NEWTON_GUARD;
+        if (!axp_mulf_ex(ctx, &y, &y, &t, cur_prec)) goto cleanup_error;
+        if (!axp__mulf_into(ctx, &t, &a_scaled, cur_prec)) goto cleanup_error;
+
+        AXP_Float err = { 0 };
+        bool ok = axp_subf_ex(ctx, &one, &t, &err, cur_prec);
+        axp_freef_ex(ctx, &t);
+        t = (AXP_Float){ 0 };
         if (!ok) goto cleanup_error;
-
-        AXP_Float y_next = { 0 };
-        ok = axp_addf_ex(ctx, &y, &correction, &y_next, cur_prec);
-        axp_freef(&correction);
+        ok = axp__mulf_into(ctx, &err, &y, cur_prec) && axp__mulf_into(ctx, &err, &half, cur_prec) && axp__addf_into(ctx, &y, &err, cur_prec);
+        axp_freef_ex(ctx, &err);
         if (!ok) goto cleanup_error;
-
-        axp_freef(&y);
-        y = y_next;
     }
 
-    axp_freef(&one);
-
-    axp_size_t safety = (y.size > precision) ? (y.size - precision) : 0;
-    *ambiguous = !axp__round_is_unambiguous(y.digits, safety);
-    *out = y;
-    axp_error_reset(ctx);
-    return true;
+    y.exponent -= q;
+    if (!axp_reallocf_round(ctx, &y, precision)) goto cleanup_error;
+    axp_freef_ex(ctx, &one);
+    *res = y;
+    return true;
 
 cleanup_error:
-    axp_freef(&y);
-    axp_freef(&one);
+    axp__releasef(ctx, &one);
+    axp__releasef(ctx, &y);
+    axp__releasef(ctx, &t);
     return false;
 }
 
-bool axp_lnf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
-    bool x_zero;
-    if (!axp_is_zerof(ctx, x, &x_zero)) return false;
-    if (x_zero || x->sign) {
-        axp_throw(ctx, AXP_ERR_DIV_ZERO, "ln of a non-positive number is undefined.");
-        return false;
+// res = sqrt(a) for a >= 0. 1/sqrt(a) is only computed to half the digits, Karp's correction
+// s = s0 + y*(a - s0^2)/2 with s0 = a*y then recovers the full precision.
+static bool axp__sqrtf(AXP_Ctx *ctx, const AXP_Float *a, AXP_Float *res, axp_size_t precision) {
+    bool a_zero;
+    if (!axp_is_zerof(ctx, a, &a_zero)) return false;
+    if (a_zero) {
+        if (!axp_initf_ex(ctx, res, precision)) return false;
+        res->size = 1;
+        return true;
     }
 
-    axp_size_t extra = ctx->fast_rounding ? 5 : (ctx->ziv_safety_digits ? ctx->ziv_safety_digits : AXP_ZIV_DEFAULT_SAFETY_DIGITS);
-    axp_size_t max_attempts = ctx->fast_rounding ? 1 : (ctx->ziv_max_retries ? ctx->ziv_max_retries : AXP_ZIV_DEFAULT_MAX_RETRIES);
-
-    for (axp_size_t attempt = 0; attempt < max_attempts; attempt++) {
-        AXP_Float candidate = { 0 };
-        bool ambiguous = false;
-        if (!axp__lnf_attempt(ctx, x, precision, extra, &candidate, &ambiguous)) return false;
-        if (ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
-            *res = candidate;
-            if (!axp_reallocf_round(ctx, res, precision)) return false;
-            axp_error_reset(ctx);
-            return true;
-        }
-        axp_freef(&candidate);
-        extra *= 2;
+    axp_size_t half_prec = precision / 2 + 4;
+    axp_digit_t five = 5;
+    const AXP_Float half = { 1, 1, &five, 0, -1 };
+    AXP_Float y = { 0 };
+    AXP_Float s0 = { 0 };
+    AXP_Float t = { 0 };
+    AXP_Float d = { 0 };
+
+    if (!axp__rsqrtf(ctx, a, &y, half_prec)) return false;
+    if (!axp_mulf_ex(ctx, a, &y, &s0, half_prec)) goto cleanup_error;
+    if (!axp_mulf_ex(ctx, &s0, &s0, &t, precision + 2)) goto cleanup_error;
+    if (!axp_subf_ex(ctx, a, &t, &d, precision + 2)) goto cleanup_error;
+    if (axp__is_zero_digits(d.digits, d.size)) {
+        // s0 is exact, and adding a zero residual with exponent 0 would round s0 away when it is tiny
+        if (!axp_copyf_ex_round(ctx, res, &s0, precision)) goto cleanup_error;
+    } else {
+        if (!axp__mulf_into(ctx, &d, &y, half_prec)) goto cleanup_error;
+        if (!axp__mulf_into(ctx, &d, &half, half_prec)) goto cleanup_error;
+        if (!axp_addf_ex(ctx, &s0, &d, res, precision)) goto cleanup_error;
     }
-    UNREACHABLE("axp_lnf_ex retry loop should always return");
+
+    axp_freef_ex(ctx, &y);
+    axp_freef_ex(ctx, &s0);
+    axp_freef_ex(ctx, &t);
+    axp_freef_ex(ctx, &d);
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &y);
+    axp__releasef(ctx, &s0);
+    axp__releasef(ctx, &t);
+    axp__releasef(ctx, &d);
     return false;
 }
 
-bool axp_powff(AXP_Ctx *ctx, AXP_Float *x, const AXP_Float *y, AXP_Float *res) {
-    return axp_powff_ex(ctx, x, y, res, ctx->precision);
-}
+// res = a^(-1/n) for a > 0 and n >= 2 by Newton's iteration y += y (1 - a y^n) / n, which needs no
+// multiprecision division. a = a' * 10^(nq) with a' in [1, 10^n) keeps the double seed in range.
+// The error of a step is (n + 1) / 2 times the square of the previous one.
+static bool axp__rrootf(AXP_Ctx *ctx, const AXP_Float *a, axp_size_t n, AXP_Float *res, axp_size_t precision) {
+    if (n == 2) return axp__rsqrtf(ctx, a, res, precision);
 
-static bool axp__powff_attempt(AXP_Ctx *ctx, AXP_Float *x, const AXP_Float *y, axp_size_t precision, axp_size_t extra, AXP_Float *out, bool *ambiguous) {
-    axp_size_t guard = 0;
-    axp_size_t tmp_precision = precision;
-    while (tmp_precision) { guard++; tmp_precision /= 10; }
+    axp_exp_t e10 = a->exponent + (axp_exp_t)a->size - 1;
+    axp_exp_t q = e10 / (axp_exp_t)n;
+    if (e10 < 0 && e10 % (axp_exp_t)n) q--;
+    AXP_Float a_scaled = *a;
+    a_scaled.exponent -= q * (axp_exp_t)n;
+    a_scaled.sign = 0;
 
-    double exponent_est = axp__float_to_double(y) * axp__lnf_seed(x);
-    axp_size_t amp_guard = 1;
-    if (isfinite(exponent_est) && fabs(exponent_est) > 1.0) {
-        amp_guard += (axp_size_t)ceil(log10(fabs(exponent_est)));
+    axp_size_t n_digits = 0;
+    for (axp_size_t tmp_n = n; tmp_n; tmp_n /= 10) n_digits++;
+
+    AXP_Float one = { 0 };
+    AXP_Float y = { 0 };
+    AXP_Float t = { 0 };
+    AXP_Float err = { 0 };
+    if (!axp_initf_ex(ctx, &one, 1)) return false;
+    one.digits[0] = 1;
+    if (!axp__double_to_float(ctx, exp(-axp__lnf_seed(&a_scaled) / (double)n), &y)) goto cleanup_error;
+
+    axp_size_t c_digits = 0;
+    for (axp_size_t tmp_c = n / 2 + 1; tmp_c; tmp_c /= 10) c_digits++;
+    axp_size_t steps[64];
+    for (axp_size_t left = axp__newton_ladder(precision + 2, c_digits, steps); left > 0; left--) {
+        axp_size_t cur_prec = steps[left - 1] + AXP__NEWTON_GUARD;
+        if (!axp__powf_raw(ctx, &y, n, &t, cur_prec + n_digits)) goto cleanup_error;
+        if (!axp__mulf_into(ctx, &t, &a_scaled, cur_prec)) goto cleanup_error;
+        if (!axp__subf_raw(ctx, &one, &t, &err, cur_prec)) goto cleanup_error;
+        axp_freef_ex(ctx, &t);
+        t = (AXP_Float){ 0 };
+        if (!axp__mulf_into(ctx, &err, &y, cur_prec)) goto cleanup_error;
+        if (!axp__divf_small_into(ctx, &err, n, cur_prec)) goto cleanup_error;
+        if (!axp__addf_into(ctx, &y, &err, cur_prec)) goto cleanup_error;
+        axp_freef_ex(ctx, &err);
+        err = (AXP_Float){ 0 };
     }
 
-    axp_size_t workprec = precision + guard + extra + amp_guard;
+    y.exponent -= q;
+    if (!axp_reallocf_round(ctx, &y, precision)) goto cleanup_error;
+    axp_freef_ex(ctx, &one);
+    *res = y;
+    return true;
 
-    AXP_Float ln_x = { 0 };
-    if (!axp_lnf_ex(ctx, x, &ln_x, workprec)) return false;
+cleanup_error:
+    axp__releasef(ctx, &one);
+    axp__releasef(ctx, &y);
+    axp__releasef(ctx, &t);
+    axp__releasef(ctx, &err);
+    return false;
+}
 
-    AXP_Float exponent = { 0 };
-    bool ok = axp_mulf_ex(ctx, y, &ln_x, &exponent, workprec);
-    axp_freef(&ln_x);
+// res = |a|^(1/n) for n >= 1, relative error below 10^-precision. For n > 2 the root is a y^(n-1)
+// with y = a^(-1/n), the digits of n cover the error amplification of the power.
+static bool axp__rootf(AXP_Ctx *ctx, const AXP_Float *a, axp_size_t n, AXP_Float *res, axp_size_t precision) {
+    AXP_Float a_abs = *a;
+    a_abs.sign = 0;
+    if (n == 1) return axp_copyf_ex_round(ctx, res, &a_abs, precision);
+    if (n == 2) return axp__sqrtf(ctx, &a_abs, res, precision);
+
+    axp_size_t n_digits = 0;
+    for (axp_size_t tmp_n = n; tmp_n; tmp_n /= 10) n_digits++;
+
+    AXP_Float y = { 0 };
+    AXP_Float t = { 0 };
+    if (!axp__rrootf(ctx, &a_abs, n, &y, precision + n_digits + 2)) return false;
+    bool ok = axp__powf_raw(ctx, &y, n - 1, &t, precision + n_digits + 2);
+    axp_freef_ex(ctx, &y);
     if (!ok) return false;
+    ok = axp_mulf_ex(ctx, &a_abs, &t, res, precision + 2);
+    axp_freef_ex(ctx, &t);
+    return ok;
+}
 
-    AXP_Float result = { 0 };
-    ok = axp_expf_ex(ctx, &exponent, &result, workprec);
-    axp_freef(&exponent);
+// Sign of root - m for m > 0, root = |x|^(1/n) or x^(-1/2) when `inverse`, from exact powers of m
+static bool axp__root_cmp_exact(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t n, bool inverse, AXP_Float *m, int8_t *cmp) {
+    AXP_Float mn = { 0 };
+    AXP_Float tmp = { 0 };
+    if (inverse) {
+        // 1/sqrt(x) >= m <=> x m^2 <= 1
+        axp_digit_t one_digit = 1;
+        const AXP_Float one = { 1, 1, &one_digit, 0, 0 };
+        bool ok = axp_mulf_ex(ctx, m, m, &tmp, 2 * m->size + 2) && axp_mulf_ex(ctx, x, &tmp, &mn, x->size + tmp.size + 2);
+        axp__releasef(ctx, &tmp);
+        if (!ok) return false;
+        *cmp = (int8_t)-axp__abs_cmpf_exact(&mn, &one);
+    } else {
+        if (!axp_powf_ex(ctx, m, (axp_exp_t)n, &mn, n * m->size + 2)) return false;
+        *cmp = axp__abs_cmpf_exact(x, &mn);
+    }
+    axp_freef_ex(ctx, &mn);
+    return true;
+}
+
+// Bound on |s - root| as 10^err_exp measured from the residual of s itself: with s^n = |x| (1 + rho), or
+// x s^2 = 1 + rho when `inverse`, the relative error of s is below |rho| once |rho| < 1/2. Returns false in
+// *usable when the residual is too large to bound anything.
+static bool axp__root_error_exp(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t n, bool inverse, const AXP_Float *s,
+                                axp_size_t precision, axp_exp_t *err_exp, bool *usable) {
+    axp_size_t n_digits = 0;
+    for (axp_size_t tmp_n = n; tmp_n; tmp_n /= 10) n_digits++;
+    axp_size_t work = precision + 8;
+    AXP_Float s_abs = *s;
+    s_abs.sign = 0;
+    AXP_Float x_abs = *x;
+    x_abs.sign = 0;
+    axp_digit_t one_digit = 1;
+    const AXP_Float one = { 1, 1, &one_digit, 0, 0 };
+    const AXP_Float *ref = inverse ? &one : &x_abs;
+
+    AXP_Float t = { 0 };
+    AXP_Float d = { 0 };
+    bool ok = inverse ? axp_mulf_ex(ctx, &s_abs, &s_abs, &t, work) && axp__mulf_into(ctx, &t, &x_abs, work)
+                      : axp__powf_raw(ctx, &s_abs, n, &t, work + n_digits);
+    ok = ok && axp_subf_ex(ctx, &t, ref, &d, work);
+    axp__releasef(ctx, &t);
     if (!ok) return false;
 
-    axp_size_t safety = (result.size > precision) ? (result.size - precision) : 0;
-    *ambiguous = !axp__round_is_unambiguous(result.digits, safety);
-    *out = result;
+    // |rho| < 10^(mag(d) - mag(ref) + 1), and t and d are rounded with a relative error below 10^(3 - work)
+    bool d_zero = axp__is_zero_digits(d.digits, d.size);
+    axp_exp_t rho_exp = d_zero ? 3 - (axp_exp_t)work : (d.exponent + (axp_exp_t)d.size) - (ref->exponent + (axp_exp_t)ref->size) + 1;
+    if (rho_exp < 3 - (axp_exp_t)work) rho_exp = 3 - (axp_exp_t)work;
+    rho_exp++;
+    axp_freef_ex(ctx, &d);
+    *usable = rho_exp < 0;
+    *err_exp = s->exponent + (axp_exp_t)s->size + rho_exp;
+    return true;
+}
+
+// Correctly rounds s ~ x^(1/n), or x^(-1/2) when `inverse`, to `precision` digits. The error of s is bounded from
+// its residual, and when that bound leaves the rounding open the candidate is walked until the exact comparisons with
+// the midpoints to its neighbours bracket the root.
+static bool axp__rootf_round(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t n, bool inverse, const AXP_Float *s, AXP_Float *res, axp_size_t precision) {
+    axp_exp_t err_exp = 0;
+    bool usable = false;
+    bool s_zero = axp__is_zero_digits(s->digits, s->size);
+    if (!s_zero && !axp__root_error_exp(ctx, x, n, inverse, s, precision, &err_exp, &usable)) return false;
+    // The walk below only closes the last few units, a candidate further off is a bug upstream
+    axp_exp_t s_ulp_exp = s->exponent + (axp_exp_t)s->size - (axp_exp_t)precision;
+    if (s_zero || !usable || err_exp > s_ulp_exp + 1) {
+        axp_throw(ctx, AXP_ERR_ROUNDING, "Root candidate is too far off to be rounded.");
+        return false;
+    }
+    if (axp__round_is_settled(s, precision, err_exp)) {
+        if (!axp_copyf_ex_round(ctx, res, s, precision)) return false;
+        axp_error_reset(ctx);
+        return true;
+    }
+
+    AXP_Float r = { 0 };
+    AXP_Float m = { 0 };
+    AXP_Float next = { 0 };
+    AXP_Float s_abs = *s;
+    s_abs.sign = 0;
+    if (!axp_copyf_ex_round(ctx, &r, &s_abs, precision)) return false;
+    while (true) {
+        axp_normalizef(&r);
+        // ulp of r, and the one below it, which is ten times smaller when r is a power of ten
+        axp_exp_t ulp_exp = r.exponent + (axp_exp_t)r.size - (axp_exp_t)precision;
+        axp_exp_t ulp_lo_exp = (r.size == 1 && r.digits[0] == 1) ? ulp_exp - 1 : ulp_exp;
+        axp_digit_t five = 5;
+        axp_digit_t one_digit = 1;
+        int8_t cmp;
+
+        AXP_Float half_lo = { 1, 1, &five, 1, ulp_lo_exp - 1 };
+        if (!axp_addf_ex(ctx, &r, &half_lo, &m, precision + 2)) goto cleanup_error;
+        if (!axp__root_cmp_exact(ctx, x, n, inverse, &m, &cmp)) goto cleanup_error;
+        axp__releasef(ctx, &m);
+        if (cmp < 0) {
+            AXP_Float ulp = { 1, 1, &one_digit, 1, ulp_lo_exp };
+            if (!axp_addf_ex(ctx, &r, &ulp, &next, precision + 1)) goto cleanup_error;
+            axp_freef_ex(ctx, &r);
+            r = next;
+            next = (AXP_Float){ 0 };
+            continue;
+        }
+
+        AXP_Float half_hi = { 1, 1, &five, 0, ulp_exp - 1 };
+        if (!axp_addf_ex(ctx, &r, &half_hi, &m, precision + 2)) goto cleanup_error;
+        if (!axp__root_cmp_exact(ctx, x, n, inverse, &m, &cmp)) goto cleanup_error;
+        axp__releasef(ctx, &m);
+        if (cmp < 0) break;
+        AXP_Float ulp = { 1, 1, &one_digit, 0, ulp_exp };
+        if (!axp_addf_ex(ctx, &r, &ulp, &next, precision + 1)) goto cleanup_error;
+        axp_freef_ex(ctx, &r);
+        r = next;
+        next = (AXP_Float){ 0 };
+    }
+
+    if (!axp_copyf_ex_round(ctx, res, &r, precision)) goto cleanup_error;
+    axp_normalizef(res);
+    res->sign = s->sign;
+    axp_freef_ex(ctx, &r);
     axp_error_reset(ctx);
     return true;
+
+cleanup_error:
+    axp__releasef(ctx, &r);
+    axp__releasef(ctx, &m);
+    axp__releasef(ctx, &next);
+    return false;
 }
 
-bool axp_powff_ex(AXP_Ctx *ctx, AXP_Float *x, const AXP_Float *y, AXP_Float *res, axp_size_t precision) {
-    bool x_zero, y_zero;
+bool axp_sqrtf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
+    return axp_sqrtf_ex(ctx, x, res, ctx->precision);
+}
+
+bool axp_sqrtf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    return axp_rootf_ex(ctx, x, 2, res, precision);
+}
+
+bool axp_rsqrtf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
+    return axp_rsqrtf_ex(ctx, x, res, ctx->precision);
+}
+
+bool axp_rsqrtf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    bool x_zero;
     if (!axp_is_zerof(ctx, x, &x_zero)) return false;
-    if (!axp_is_zerof(ctx, y, &y_zero)) return false;
+    if (x_zero || x->sign) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "1/sqrt of a non-positive number is undefined.");
+        return false;
+    }
 
-    if (x_zero && y_zero) {
-        axp_throw(ctx, AXP_ERR_DIV_ZERO, "0^0 is undefined.");
+    AXP_Float s = { 0 };
+    if (!axp__rsqrtf(ctx, x, &s, precision + 3)) return false;
+    bool ok = axp__rootf_round(ctx, x, 2, true, &s, res, precision);
+    axp_freef_ex(ctx, &s);
+    return ok;
+}
+
+bool axp_rootf(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t n, AXP_Float *res) {
+    return axp_rootf_ex(ctx, x, n, res, ctx->precision);
+}
+
+bool axp_rootf_ex(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t n, AXP_Float *res, axp_size_t precision) {
+    bool x_zero;
+    if (!axp_is_zerof(ctx, x, &x_zero)) return false;
+    if (n == 0) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "0th root is undefined.");
+        return false;
+    }
+    if (x->sign && n % 2 == 0) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "Even root of a negative number is undefined.");
         return false;
     }
     if (x_zero) {
-        if (y->sign) {
-            axp_throw(ctx, AXP_ERR_DIV_ZERO, "0^negative is undefined.");
-            return false;
-        }
         if (!axp_initf_ex(ctx, res, precision)) return false;
         res->size = 1;
         return true;
     }
-    if (y_zero) {
-        if (!axp_initf_ex(ctx, res, precision)) return false;
-        res->digits[0] = 1;
+
+    AXP_Float s = { 0 };
+    if (!axp__rootf(ctx, x, n, &s, precision + 3)) return false;
+    s.sign = x->sign;
+    bool ok = axp__rootf_round(ctx, x, n, false, &s, res, precision);
+    axp_freef_ex(ctx, &s);
+    return ok;
+}
+
+bool axp_isqrti(AXP_Ctx *ctx, const AXP_Int *x, AXP_Int *res) {
+    bool x_zero;
+    if (!axp_is_zeroi(ctx, x, &x_zero)) return false;
+    if (x->sign && !x_zero) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "Integer square root of a negative number is undefined.");
+        return false;
+    }
+    if (x_zero) {
+        if (!axp_initi(ctx, res, 1)) return false;
         res->size = 1;
         return true;
     }
 
-    AXP_Int y_int_part = { 0 };
-    AXP_Float y_frac = { 0 };
-    if (!axp_floorf(ctx, y, &y_int_part, &y_frac)) return false;
-    bool y_frac_zero;
-    if (!axp_is_zerof(ctx, &y_frac, &y_frac_zero)) { axp_freei(&y_int_part); axp_freef(&y_frac); return false; }
-    axp_freef(&y_frac);
+    // The float root carries two fractional digits so floor(s) is normally off by at most one, the checks
+    // r^2 <= x < (r + 1)^2 are repeated until they both hold
+    AXP_Float x_view = { x->size, x->capacity, x->digits, 0, 0 };
+    AXP_Float s = { 0 };
+    AXP_Float frac = { 0 };
+    AXP_Int r = { 0 };
+    AXP_Int sq = { 0 };
+    AXP_Int next = { 0 };
+    AXP_Int one = { 0 };
+    if (!axp__sqrtf(ctx, &x_view, &s, (x->size + 1) / 2 + 2)) return false;
+    if (!axp_floorf(ctx, &s, &r, &frac)) goto cleanup_error;
+    if (!axp_initi_i64(ctx, &one, 1)) goto cleanup_error;
 
-    if (y_frac_zero) {
-        axp_exp_t y_int = 0;
-        bool overflow = false;
-        for (axp_size_t i = y_int_part.size; i > 0; i--) {
-            if (y_int > (AXP_TYPE_MAX_VALUE(axp_exp_t) - (axp_exp_t)y_int_part.digits[i-1]) / 10) { overflow = true; break; }
-            y_int = y_int * 10 + y_int_part.digits[i-1];
-        }
-        if (overflow) {
-            axp_freei(&y_int_part);
-            axp_throw(ctx, AXP_ERR_OVERFLOW, "Integer exponent too large to represent.");
-            return false;
-        }
-        if (y_int_part.sign) y_int = -y_int;
-        axp_freei(&y_int_part);
-        return axp_powf_ex(ctx, x, y_int, res, precision);
+    int8_t cmp;
+    while (true) {
+        if (!axp_muli(ctx, &r, &r, &sq)) goto cleanup_error;
+        if (!axp_abs_cmpi(ctx, &sq, x, &cmp)) goto cleanup_error;
+        axp_freei_ex(ctx, &sq);
+        sq = (AXP_Int){ 0 };
+        if (cmp <= 0) break;
+        if (!axp_subi(ctx, &r, &one, &next)) goto cleanup_error;
+        axp_freei_ex(ctx, &r);
+        r = next;
+        next = (AXP_Int){ 0 };
     }
-    axp_freei(&y_int_part);
-
-    if (x->sign) {
-        axp_throw(ctx, AXP_ERR_DIV_ZERO, "Negative base with non-integer exponent is undefined.");
-        return false;
+    while (true) {
+        if (!axp_addi(ctx, &r, &one, &next)) goto cleanup_error;
+        if (!axp_muli(ctx, &next, &next, &sq)) goto cleanup_error;
+        if (!axp_abs_cmpi(ctx, &sq, x, &cmp)) goto cleanup_error;
+        axp_freei_ex(ctx, &sq);
+        sq = (AXP_Int){ 0 };
+        if (cmp > 0) break;
+        axp_freei_ex(ctx, &r);
+        r = next;
+        next = (AXP_Int){ 0 };
     }
 
-    axp_size_t extra = ctx->fast_rounding ? 5 : (ctx->ziv_safety_digits ? ctx->ziv_safety_digits : AXP_ZIV_DEFAULT_SAFETY_DIGITS);
-    axp_size_t max_attempts = ctx->fast_rounding ? 1 : (ctx->ziv_max_retries ? ctx->ziv_max_retries : AXP_ZIV_DEFAULT_MAX_RETRIES);
+    axp_freef_ex(ctx, &s);
+    axp_freef_ex(ctx, &frac);
+    axp_freei_ex(ctx, &next);
+    axp_freei_ex(ctx, &one);
+    *res = r;
+    axp_error_reset(ctx);
+    return true;
 
-    for (axp_size_t attempt = 0; attempt < max_attempts; attempt++) {
-        AXP_Float candidate = { 0 };
-        bool ambiguous = false;
-        if (!axp__powff_attempt(ctx, x, y, precision, extra, &candidate, &ambiguous)) return false;
-        if (ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
-            *res = candidate;
-            if (!axp_reallocf_round(ctx, res, precision)) return false;
-            axp_error_reset(ctx);
-            return true;
-        }
-        axp_freef(&candidate);
-        extra *= 2;
-    }
-    UNREACHABLE("axp_powff_ex retry loop should always return");
+cleanup_error:
+    axp__releasef(ctx, &s);
+    axp__releasef(ctx, &frac);
+    axp__releasei(ctx, &r);
+    axp__releasei(ctx, &sq);
+    axp__releasei(ctx, &next);
+    axp__releasei(ctx, &one);
     return false;
 }
 
-size_t axp_itoa(AXP_Int *x, char *buf, size_t buf_sz) {
-    bool should_write = !(buf == NULL || buf_sz == 0);
-    size_t needed_space = x->size ? x->size : 1;
-    if (x->sign) needed_space++;
-    if (!should_write) return needed_space;
+bool axp_modi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *m, AXP_Int *res) {
+    AXP_Int q = { 0 };
+    AXP_Int r = { 0 };
+    if (!axp_divi(ctx, x, m, &q, &r)) return false;
+    axp_freei_ex(ctx, &q);
+    if (r.sign && !axp__is_zero_digits(r.digits, r.size)) {
+        // Truncated division leaves the sign of x, |m| - |r| is the least non-negative residue
+        AXP_Int m_abs = { m->size, m->capacity, m->digits, 0 };
+        r.sign = 0;
+        if (!axp_subi(ctx, &m_abs, &r, res)) { axp_freei_ex(ctx, &r); return false; }
+        axp_freei_ex(ctx, &r);
+    } else {
+        r.sign = 0;
+        *res = r;
+    }
+    axp_error_reset(ctx);
+    return true;
+}
 
-    if (x->sign) *buf++ = '-';
-    for (axp_size_t i = x->size; i > 0; i--) {
-        *buf++ = '0' + x->digits[i-1];
+// Barrett reduction modulo an n-digit m: with mu = floor(10^(2n) / m) a product of two residues reduces
+// with two multiplications and at most two subtractions of m instead of a long division
+typedef struct {
+    const axp_digit_t *m;
+    axp_size_t n;
+    axp_digit_t *mu;
+    axp_size_t mu_sz;
+    axp_digit_t *q;    // q1 * mu, 2n + 4 digits
+    axp_digit_t *low;  // Low n + 1 digits of q3 * m
+    axp_digit_t *prod; // Product of two residues, 2n + 2 digits
+} axp__Barrett;
+
+// Only the digits below limit of x*y, res must be zeroed up to limit
+static void axp__mul_digits_low(const axp_digit_t *x_digits, axp_size_t x_sz, const axp_digit_t *y_digits, axp_size_t y_sz, axp_digit_t *res, axp_size_t limit) {
+    for (axp_size_t i = 0; i < x_sz && i < limit; i++) {
+        axp_digit_t carry = 0;
+        for (axp_size_t j = 0; i + j < limit && (j < y_sz || carry); j++) {
+            // At most 9 + 9 * 9 + 9, fits in a digit
+            axp_digit_t product = (axp_digit_t)(res[i + j] + x_digits[i] * (j < y_sz ? y_digits[j] : 0) + carry);
+            res[i + j] = product % BASE;
+            carry = product / BASE;
+        }
     }
-    *buf = '\0';
-    return needed_space;
 }
 
-char *axp_itoa_alloc(AXP_Ctx *ctx, AXP_Int *x) {
-    size_t needed_space = axp_itoa(x, NULL, 0) + 1; // +1 for the null terminator
-    char *buf = malloc(needed_space * sizeof(char));
-    if (!buf) {
-        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_itoa_alloc`.", needed_space*sizeof(char));
-        return NULL;
+// x < 10^(2n) reduced into dst (n + 1 digits)
+static axp_size_t axp__barrett_reduce(axp__Barrett *b, const axp_digit_t *x, axp_size_t x_sz, axp_digit_t *dst) {
+    axp_size_t n = b->n;
+    axp_size_t sz;
+    if (x_sz < n) {
+        memcpy(dst, x, x_sz * sizeof(axp_digit_t));
+        sz = x_sz;
+    } else {
+        // q3 = floor(floor(x / 10^(n-1)) * mu / 10^(n+1)) undershoots x / m by at most 2
+        axp_size_t q1_sz = x_sz - (n - 1);
+        memset(b->q, 0, (q1_sz + b->mu_sz) * sizeof(axp_digit_t));
+        axp_size_t q2_sz = axp__mul_digits(x + n - 1, q1_sz, b->mu, b->mu_sz, b->q);
+        axp_size_t q3_sz = (q2_sz > n + 1) ? q2_sz - (n + 1) : 0;
+        memset(b->low, 0, (n + 1) * sizeof(axp_digit_t));
+        axp__mul_digits_low(b->q + n + 1, q3_sz, b->m, n, b->low, n + 1);
+
+        // x - q3*m < 3m < 10^(n+1), so the difference of the low digits is exact once the borrow is dropped
+        int borrow = 0;
+        for (axp_size_t i = 0; i < n + 1; i++) {
+            int diff = (i < x_sz ? x[i] : 0) - b->low[i] - borrow;
+            borrow = diff < 0;
+            dst[i] = (axp_digit_t)(diff + (borrow ? BASE : 0));
+        }
+        sz = n + 1;
     }
-    axp_itoa(x, buf, needed_space);
-    axp_error_reset(ctx);
-    return buf;
+    while (sz > 1 && dst[sz - 1] == 0) sz--;
+    if (sz == 0) dst[sz++] = 0;
+    while (axp__abs_cmpi_digits(dst, sz, (axp_digit_t *)b->m, n) >= 0) {
+        sz = axp__sub_digits(dst, sz, b->m, n, dst);
+        if (sz == 0) dst[sz++] = 0;
+    }
+    return sz;
 }
 
-bool axp_atoi(AXP_Ctx *ctx, const char *str, AXP_Int *x)
-{
-    if (!str || !*str) {
-        axp_throw(ctx, AXP_ERR_PARSE, "Could not parse empty string or null pointer as integer.");
+static axp_size_t axp__barrett_mul(axp__Barrett *b, const axp_digit_t *x, axp_size_t x_sz, const axp_digit_t *y, axp_size_t y_sz, axp_digit_t *dst) {
+    memset(b->prod, 0, (x_sz + y_sz) * sizeof(axp_digit_t));
+    axp_size_t prod_sz = axp__mul_digits(x, x_sz, y, y_sz, b->prod);
+    while (prod_sz > 1 && b->prod[prod_sz - 1] == 0) prod_sz--;
+    return axp__barrett_reduce(b, b->prod, prod_sz, dst);
+}
+
+bool axp_powmodi(AXP_Ctx *ctx, const AXP_Int *base, const AXP_Int *exp, const AXP_Int *mod, AXP_Int *res) {
+    bool mod_zero, exp_zero;
+    if (!axp_is_zeroi(ctx, mod, &mod_zero)) return false;
+    if (!axp_is_zeroi(ctx, exp, &exp_zero)) return false;
+    if (!base->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot raise an uninitalized integer.");
         return false;
     }
-    uint8_t sign = 0;
-    axp_size_t res_sz = 0;
-    axp_size_t allocated = 4;
-    axp_digit_t *res_digits = calloc(4, sizeof(axp_digit_t));
-    if (!res_digits) {
-        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `atoi`.", allocated*sizeof(axp_digit_t));
+    if (mod_zero) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "Division by zero in `axp_powmodi`");
+        return false;
+    }
+    if (exp->sign && !exp_zero) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "Negative exponent in `axp_powmodi` needs a modular inverse.");
         return false;
     }
 
-    while(isspace(*str)) str++;
-
-    if (*str == '-') {
-        sign = 1;
-        str++;
-    } else if (*str == '+') str++;
-
-    while (*str) {
-        const char chr = *str;
-        if (isspace(chr)) {
-            str++;
-            continue;
-        }
+    axp_size_t n = mod->size;
+    if (!axp_initi(ctx, res, n + 1)) return false;
+    if (n == 1 && mod->digits[0] == 1) {
+        axp_error_reset(ctx);
+        return true;
+    }
+    if (exp_zero) {
+        res->digits[0] = 1;
+        axp_error_reset(ctx);
+        return true;
+    }
 
-        if (!isdigit(chr)) {
-            axp_throw(ctx, AXP_ERR_PARSE, "String parsing failed, could not parse '%c' as a digit", chr);
-            free(res_digits);
-            return false;
-        }
+    AXP_Int b_mod = { 0 };
+    if (!axp_modi(ctx, base, mod, &b_mod)) { axp_freei_ex(ctx, res); return false; }
 
-        if (res_sz >= allocated) {
-            axp_digit_t *tmp = realloc(res_digits, allocated*2*sizeof(axp_digit_t));
-            if (!tmp) {
-                free(res_digits);
-                axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_atoi`.", allocated*sizeof(axp_digit_t));
-                return false;
-            }
-            res_digits = tmp;
-            allocated *= 2;
-        }
-        res_digits[res_sz++] = (axp_digit_t)(chr - '0');
-        str++;
+    // Residues, b^0..b^9 and the current power, take n + 1 digits each
+    axp_size_t slot = n + 1;
+    axp_size_t scratch_sz = 12 * slot + (n + 2) + (2 * n + 4) + (n + 1) + (2 * n + 2) + 2 * (2 * n + 1);
+    AXP_Int scratch;
+    if (!axp_initi(ctx, &scratch, scratch_sz)) {
+        axp_freei_ex(ctx, &b_mod);
+        axp_freei_ex(ctx, res);
+        return false;
+    }
+    axp_digit_t *table = scratch.digits;
+    axp_digit_t *acc = table + 10 * slot;
+    axp_digit_t *tmp = acc + slot;
+    axp__Barrett b = { mod->digits, n, tmp + slot, 0, NULL, NULL, NULL };
+    b.q = b.mu + (n + 2);
+    b.low = b.q + (2 * n + 4);
+    b.prod = b.low + (n + 1);
+    axp_digit_t *dividend = b.prod + (2 * n + 2);
+    axp_digit_t *divisor = dividend + (2 * n + 1);
+
+    dividend[2 * n] = 1;
+    memcpy(divisor, mod->digits, n * sizeof(axp_digit_t));
+    axp_size_t rem_sz;
+    b.mu_sz = axp__div_digits(dividend, 2 * n + 1, divisor, n, b.mu, &rem_sz);
+
+    axp_size_t table_sz[10];
+    table[0] = 1;
+    table_sz[0] = 1;
+    memcpy(table + slot, b_mod.digits, b_mod.size * sizeof(axp_digit_t));
+    table_sz[1] = b_mod.size;
+    axp_freei_ex(ctx, &b_mod);
+    for (axp_size_t d = 2; d < 10; d++) {
+        table_sz[d] = axp__barrett_mul(&b, table + (d - 1) * slot, table_sz[d - 1], table + slot, table_sz[1], table + d * slot);
     }
 
-    // Must be a better way to do this without reversing, but works for now
-    for (axp_size_t i = 0; i < res_sz / 2; ++i) {
-        axp_digit_t tmp = res_digits[i]; // Digit at index i from the left
-        res_digits[i] = res_digits[res_sz - 1 - i]; // Digit from index i from the right
-        res_digits[res_sz - 1 - i] = tmp; // Swap
+    // Decimal left-to-right powering, acc^10 = ((acc^2)^2 * acc)^2 per digit of the exponent
+    axp_size_t i = exp->size - 1;
+    axp_digit_t top = exp->digits[i];
+    memcpy(acc, table + top * slot, table_sz[top] * sizeof(axp_digit_t));
+    axp_size_t acc_sz = table_sz[top];
+    while (i-- > 0) {
+        axp_size_t tmp_sz = axp__barrett_mul(&b, acc, acc_sz, acc, acc_sz, tmp);
+        tmp_sz = axp__barrett_mul(&b, tmp, tmp_sz, tmp, tmp_sz, tmp);
+        tmp_sz = axp__barrett_mul(&b, tmp, tmp_sz, acc, acc_sz, tmp);
+        acc_sz = axp__barrett_mul(&b, tmp, tmp_sz, tmp, tmp_sz, acc);
+        axp_digit_t d = exp->digits[i];
+        if (d) acc_sz = axp__barrett_mul(&b, acc, acc_sz, table + d * slot, table_sz[d], acc);
     }
-    x->sign = sign;
-    x->digits = res_digits;
-    x->size = res_sz;
-    x->capacity = allocated;
+
+    memcpy(res->digits, acc, acc_sz * sizeof(axp_digit_t));
+    res->size = acc_sz;
+    axp_freei_ex(ctx, &scratch);
     axp_error_reset(ctx);
     return true;
 }
 
-static bool axp__ftoa_use_scientific(const AXP_Float *x) {
-    if (x->exponent >= 0) return x->exponent > AXP_FTOA_AUTO_PAD_THRESHOLD;
-    if (x->size + x->exponent <= 0) return llabs(x->size + x->exponent) > AXP_FTOA_AUTO_PAD_THRESHOLD;
-    return false;
+// x*a + y*b for single-precision cofactors whose combination is known to be non-negative
+static axp_size_t axp__lincomb_digits(const axp_digit_t *x, axp_size_t x_sz, int64_t a, const axp_digit_t *y, axp_size_t y_sz, int64_t b, axp_digit_t *res) {
+    axp_size_t n = (x_sz > y_sz) ? x_sz : y_sz;
+    int64_t carry = 0;
+    for (axp_size_t i = 0; i < n; i++) {
+        int64_t t = carry + a * (i < x_sz ? x[i] : 0) + b * (i < y_sz ? y[i] : 0);
+        int64_t d = t % BASE;
+        carry = t / BASE;
+        if (d < 0) { d += BASE; carry--; }
+        res[i] = (axp_digit_t)d;
+    }
+    AXP_ASSERT(carry >= 0);
+    while (carry > 0) {
+        res[n++] = (axp_digit_t)(carry % BASE);
+        carry /= BASE;
+    }
+    while (n > 1 && res[n - 1] == 0) n--;
+    return n;
 }
 
-size_t axp_ftoa_ex(AXP_Float *x, char *buf, size_t buf_sz, AXP_FtoaFormat format) {
-    bool should_write = !(buf == NULL || buf_sz == 0);
-    size_t needed_space = 0;
+static uint64_t axp__lead_digits(const axp_digit_t *x, axp_size_t x_sz, axp_size_t top, axp_size_t count) {
+    uint64_t v = 0;
+    for (axp_size_t i = top; i-- > top - count;) v = v * BASE + (i < x_sz ? x[i] : 0);
+    return v;
+}
 
-    if (x->size == 0 || ((x->size == 1) && (x->digits[0] == 0))) {
-        if (should_write) snprintf(buf, 4, "0.0");
-        needed_space = 3;
-        goto return_block;
-    } else if (format == AXP_FTOA_SCIENTIFIC || (format == AXP_FTOA_AUTO && axp__ftoa_use_scientific(x))) {
-        axp_exp_t top_exp = x->exponent + (axp_exp_t)(x->size - 1);
-        char exp_buf[32];
-        int exp_len = snprintf(exp_buf, sizeof(exp_buf), "%+lld", (long long)top_exp);
+// Euclid's cofactors alternate in sign, so they are kept as magnitudes and the combination of a step
+// matrix only ever adds: (s0, s1) <- (|a|*s0 + |b|*s1, |c|*s0 + |d|*s1)
+static void axp__cofactor_combine(AXP_Int *s0, AXP_Int *s1, AXP_Int *scratch, int64_t a, int64_t b, int64_t c, int64_t d) {
+    axp_size_t sz = axp__lincomb_digits(s0->digits, s0->size, a < 0 ? -a : a, s1->digits, s1->size, b < 0 ? -b : b, scratch->digits);
+    s1->size = axp__lincomb_digits(s0->digits, s0->size, c < 0 ? -c : c, s1->digits, s1->size, d < 0 ? -d : d, s1->digits);
+    AXP_Int swap = *s0; *s0 = *scratch; *scratch = swap;
+    s0->size = sz;
+}
+
+// (s0, s1) <- (s1, s0 + q*s1) for a full division step
+static void axp__cofactor_step(AXP_Int *s0, AXP_Int *s1, AXP_Int *scratch, const AXP_Int *q) {
+    memset(scratch->digits, 0, scratch->capacity * sizeof(axp_digit_t));
+    axp_size_t qs_sz = axp__mul_digits(q->digits, q->size, s1->digits, s1->size, scratch->digits);
+    axp_size_t next_sz = axp__add_digits(s0->digits, s0->size, scratch->digits, qs_sz, s0->digits);
+    while (next_sz > 1 && s0->digits[next_sz - 1] == 0) next_sz--;
+    s0->size = next_sz;
+    AXP_Int swap = *s0; *s0 = *s1; *s1 = swap;
+}
+
+// Lehmer's gcd of |x| and |y|: the Euclid quotients are run on the leading 17 digits with single-precision
+// cofactors for as long as they provably agree with the full ones, then applied in one linear pass.
+// With s and t the cofactors are tracked as well, gcd = s*|x| + t*|y|
+// There is no half-GCD layer on top. With Karatsuba products it costs some ten products per level over
+// log2 n levels, while these passes cost 31 products of the same size at 3000 digits and 135 at 10^5 digits,
+// so it would not pay below about 10^5 digits. It is deferred until products are faster than Karatsuba.
+static bool axp__gcd_core(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *g, AXP_Int *s, AXP_Int *t_out) {
+    axp_size_t cap = ((x->size > y->size) ? x->size : y->size) + 1;
+    AXP_Int a = { 0 };
+    AXP_Int b = { 0 };
+    AXP_Int t = { 0 };
+    AXP_Int q = { 0 };
+    AXP_Int s0 = { 0 };
+    AXP_Int s1 = { 0 };
+    AXP_Int t0 = { 0 };
+    AXP_Int t1 = { 0 };
+    AXP_Int sc = { 0 };
+    bool s_odd = false; // The cofactor of the current a is negative after an odd number of Euclid steps
+    if (!axp_copyi_ex(ctx, &a, x, cap)) return false;
+    if (!axp_copyi_ex(ctx, &b, y, cap)) goto cleanup_error;
+    if (!axp_initi(ctx, &t, cap)) goto cleanup_error;
+    if (!axp_initi(ctx, &q, cap)) goto cleanup_error;
+    a.sign = b.sign = 0;
+    if (s) {
+        if (!axp_initi(ctx, &s0, 2 * cap)) goto cleanup_error;
+        if (!axp_initi(ctx, &s1, 2 * cap)) goto cleanup_error;
+        if (!axp_initi(ctx, &t0, 2 * cap)) goto cleanup_error;
+        if (!axp_initi(ctx, &t1, 2 * cap)) goto cleanup_error;
+        if (!axp_initi(ctx, &sc, 2 * cap)) goto cleanup_error;
+        s0.digits[0] = 1;
+        t1.digits[0] = 1;
+    }
+    if (axp__abs_cmpi_digits(a.digits, a.size, b.digits, b.size) < 0) {
+        // A zero quotient step
+        AXP_Int swap = a; a = b; b = swap;
+        swap = s0; s0 = s1; s1 = swap;
+        swap = t0; t0 = t1; t1 = swap;
+        s_odd = true;
+    }
+
+    while (!axp__is_zero_digits(b.digits, b.size)) {
+        if (a.size <= 17) {
+            // Euclid finishes natively, with cofactors below 10^17 so that applying them cannot overflow
+            uint64_t u = axp__lead_digits(a.digits, a.size, a.size, a.size);
+            uint64_t v = axp__lead_digits(b.digits, b.size, a.size, a.size);
+            int64_t ca = 1, cb = 0, cc = 0, cd = 1;
+            while (v != 0) {
+                uint64_t qq = u / v;
+                uint64_t r = u - qq * v;
+                int64_t tmp = ca - (int64_t)qq * cc; ca = cc; cc = tmp;
+                tmp = cb - (int64_t)qq * cd; cb = cd; cd = tmp;
+                u = v; v = r;
+                s_odd = !s_odd;
+            }
+            if (s) {
+                axp__cofactor_combine(&s0, &s1, &sc, ca, cb, cc, cd);
+                axp__cofactor_combine(&t0, &t1, &sc, ca, cb, cc, cd);
+            }
+            a.size = 0;
+            do { a.digits[a.size++] = (axp_digit_t)(u % BASE); u /= BASE; } while (u);
+            b.size = 1;
+            b.digits[0] = 0;
+            break;
+        }
+
+        // Knuth's Algorithm L on the leading digits, the cofactors stay below 10^17
+        axp_size_t lead = 17;
+        int64_t u = (int64_t)axp__lead_digits(a.digits, a.size, a.size, lead);
+        int64_t v = (int64_t)axp__lead_digits(b.digits, b.size, a.size, lead);
+        int64_t ca = 1, cb = 0, cc = 0, cd = 1;
+        bool steps_odd = false;
+        while (v + cc > 0 && v + cd > 0) {
+            int64_t q1 = (u + ca) / (v + cc);
+            int64_t q2 = (u + cb) / (v + cd);
+            if (q1 != q2) break;
+            int64_t tmp = ca - q1 * cc; ca = cc; cc = tmp;
+            tmp = cb - q1 * cd; cb = cd; cd = tmp;
+            tmp = u - q1 * v; u = v; v = tmp;
+            steps_odd = !steps_odd;
+        }
+
+        if (cb == 0) {
+            // The leading digits cannot decide a single quotient, take one full division step
+            memset(q.digits, 0, q.capacity * sizeof(axp_digit_t));
+            axp_size_t rem_sz;
+            memcpy(t.digits, b.digits, b.size * sizeof(axp_digit_t));
+            q.size = axp__div_digits(a.digits, a.size, t.digits, b.size, q.digits, &rem_sz);
+            memset(t.digits, 0, t.capacity * sizeof(axp_digit_t));
+            a.size = rem_sz;
+            if (a.size == 0) a.digits[a.size++] = 0;
+            AXP_Int swap = a; a = b; b = swap;
+            if (s) {
+                axp__cofactor_step(&s0, &s1, &sc, &q);
+                axp__cofactor_step(&t0, &t1, &sc, &q);
+            }
+            s_odd = !s_odd;
+            continue;
+        }
+
+        axp_size_t a_sz = axp__lincomb_digits(a.digits, a.size, ca, b.digits, b.size, cb, t.digits);
+        axp_size_t b_sz = axp__lincomb_digits(a.digits, a.size, cc, b.digits, b.size, cd, q.digits);
+        AXP_Int swap = a; a = t; t = swap;
+        swap = b; b = q; q = swap;
+        a.size = a_sz;
+        b.size = b_sz;
+        if (s) {
+            axp__cofactor_combine(&s0, &s1, &sc, ca, cb, cc, cd);
+            axp__cofactor_combine(&t0, &t1, &sc, ca, cb, cc, cd);
+        }
+        if (steps_odd) s_odd = !s_odd;
+    }
+
+    axp_freei_ex(ctx, &b);
+    axp_freei_ex(ctx, &t);
+    axp_freei_ex(ctx, &q);
+    *g = a;
+    if (s) {
+        axp_freei_ex(ctx, &s1);
+        axp_freei_ex(ctx, &t1);
+        axp_freei_ex(ctx, &sc);
+        s0.sign = s_odd && !axp__is_zero_digits(s0.digits, s0.size);
+        t0.sign = !s_odd && !axp__is_zero_digits(t0.digits, t0.size);
+        *s = s0;
+        *t_out = t0;
+    }
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp__releasei(ctx, &a);
+    axp__releasei(ctx, &b);
+    axp__releasei(ctx, &t);
+    axp__releasei(ctx, &q);
+    axp__releasei(ctx, &s0);
+    axp__releasei(ctx, &s1);
+    axp__releasei(ctx, &t0);
+    axp__releasei(ctx, &t1);
+    axp__releasei(ctx, &sc);
+    return false;
+}
+
+bool axp_gcdi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *res) {
+    if (!x->digits || !y->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot take the gcd of uninitalized integers.");
+        return false;
+    }
+    return axp__gcd_core(ctx, x, y, res, NULL, NULL);
+}
+
+bool axp_lcmi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *res) {
+    bool x_zero, y_zero;
+    if (!(axp_is_zeroi(ctx, x, &x_zero) && axp_is_zeroi(ctx, y, &y_zero))) return false;
+    if (x_zero || y_zero) {
+        if (!axp_initi(ctx, res, 1)) return false;
+        return true;
+    }
+
+    // |x| / gcd * |y| keeps the intermediate below the result
+    AXP_Int g = { 0 };
+    AXP_Int q = { 0 };
+    AXP_Int r = { 0 };
+    AXP_Int x_abs = { x->size, x->capacity, x->digits, 0 };
+    AXP_Int y_abs = { y->size, y->capacity, y->digits, 0 };
+    if (!axp__gcd_core(ctx, x, y, &g, NULL, NULL)) return false;
+    if (!axp_divi(ctx, &x_abs, &g, &q, &r)) { axp_freei_ex(ctx, &g); return false; }
+    axp_freei_ex(ctx, &g);
+    axp_freei_ex(ctx, &r);
+    bool ok = axp_muli(ctx, &q, &y_abs, res);
+    axp_freei_ex(ctx, &q);
+    return ok;
+}
+
+bool axp_gcdexti(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *g, AXP_Int *s, AXP_Int *t) {
+    if (!x->digits || !y->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot take the gcd of uninitalized integers.");
+        return false;
+    }
+    if (!axp__gcd_core(ctx, x, y, g, s, t)) return false;
+    // The core works on |x| and |y|, their signs move onto the cofactors
+    if (x->sign && !axp__is_zero_digits(s->digits, s->size)) s->sign ^= 1;
+    if (y->sign && !axp__is_zero_digits(t->digits, t->size)) t->sign ^= 1;
+    return true;
+}
+
+// Binomials with k^2 below n / AXP__BINOMIAL_DIRECT_RATIO skip the sieve, both cost about as much at
+// k^2 ~ n / 4 (C(10^6, 500) takes 5 ms either way)
+#define AXP__BINOMIAL_DIRECT_RATIO 4
+
+// Small factors multiplied into uint64 leaves below 10^18 before they reach the product tree
+typedef struct {
+    uint64_t *leaves;
+    axp_size_t len;
+    uint64_t acc;
+} axp__Factors;
+
+static void axp__factors_push(axp__Factors *fs, uint64_t v) {
+    if (fs->acc > UINT64_C(999999999999999999) / v) {
+        fs->leaves[fs->len++] = fs->acc;
+        fs->acc = v;
+    } else fs->acc *= v;
+}
+
+static void axp__factors_flush(axp__Factors *fs) {
+    if (fs->acc > 1) fs->leaves[fs->len++] = fs->acc;
+    fs->acc = 1;
+}
+
+// Balanced product of the leaves, so every multiplication sees operands of similar length
+static bool axp__product_tree(AXP_Ctx *ctx, const uint64_t *leaves, axp_size_t len, AXP_Int *res) {
+    if (len <= 1) return axp_initi_i64(ctx, res, len ? (int64_t)leaves[0] : 1);
+    AXP_Int l = { 0 };
+    AXP_Int r = { 0 };
+    axp_size_t mid = len / 2;
+    if (!axp__product_tree(ctx, leaves, mid, &l)) return false;
+    if (!axp__product_tree(ctx, leaves + mid, len - mid, &r)) { axp_freei_ex(ctx, &l); return false; }
+    bool ok = axp_muli(ctx, &l, &r, res);
+    axp_freei_ex(ctx, &l);
+    axp_freei_ex(ctx, &r);
+    return ok;
+}
+
+// composite[i] != 0 for every non-prime i <= n
+static uint8_t *axp__sieve(AXP_Ctx *ctx, axp_size_t n) {
+    uint8_t *composite = axp__calloc(ctx, (size_t)n + 1, sizeof(uint8_t));
+    if (!composite) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate a sieve up to %u.", n);
+        return NULL;
+    }
+    composite[0] = 1;
+    if (n >= 1) composite[1] = 1;
+    for (uint64_t p = 2; p * p <= n; p++) {
+        if (composite[p]) continue;
+        for (uint64_t m = p * p; m <= n; m += p) composite[m] = 1;
+    }
+    return composite;
+}
+
+static bool axp__factors_init(AXP_Ctx *ctx, axp__Factors *fs, axp_size_t count) {
+    fs->leaves = axp__malloc(ctx, ((size_t)count + 1) * sizeof(uint64_t));
+    fs->len = 0;
+    fs->acc = 1;
+    if (!fs->leaves) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %u product leaves.", count + 1);
+        return false;
+    }
+    return true;
+}
+
+static inline void axp__factors_free(AXP_Ctx *ctx, axp__Factors *fs, axp_size_t count) {
+    axp__free(ctx, fs->leaves, ((size_t)count + 1) * sizeof(uint64_t));
+}
+
+// n! = (n/2)!^2 * swing(n), where the swing n!/(n/2)!^2 is a product of prime powers p^e <= n
+static bool axp__factorial_swing(AXP_Ctx *ctx, const uint8_t *composite, axp_size_t n, axp__Factors *fs, AXP_Int *res) {
+    if (n < 21) {
+        uint64_t f = 1;
+        for (axp_size_t i = 2; i <= n; i++) f *= i;
+        return axp_initi_i64(ctx, res, (int64_t)f);
+    }
+    AXP_Int half = { 0 };
+    AXP_Int sq = { 0 };
+    AXP_Int swing = { 0 };
+    if (!axp__factorial_swing(ctx, composite, n / 2, fs, &half)) return false;
+
+    fs->len = 0;
+    for (axp_size_t p = 2; p <= n; p++) {
+        if (composite[p]) continue;
+        axp_size_t q = n;
+        uint64_t pe = 1;
+        while (q >= p) {
+            q /= p;
+            if (q & 1) pe *= p;
+        }
+        if (pe > 1) axp__factors_push(fs, pe);
+    }
+    axp__factors_flush(fs);
+
+    bool ok = axp__product_tree(ctx, fs->leaves, fs->len, &swing);
+    if (ok) ok = axp_muli(ctx, &half, &half, &sq);
+    if (ok) ok = axp_muli(ctx, &sq, &swing, res);
+    axp_freei_ex(ctx, &half);
+    axp__releasei(ctx, &sq);
+    axp__releasei(ctx, &swing);
+    return ok;
+}
+
+bool axp_factoriali(AXP_Ctx *ctx, axp_size_t n, AXP_Int *res) {
+    if (n < 21) return axp__factorial_swing(ctx, NULL, n, NULL, res);
+    uint8_t *composite = axp__sieve(ctx, n);
+    if (!composite) return false;
+    axp__Factors fs;
+    if (!axp__factors_init(ctx, &fs, n / 2 + 1)) { axp__free(ctx, composite, (size_t)n + 1); return false; }
+    bool ok = axp__factorial_swing(ctx, composite, n, &fs, res);
+    axp__factors_free(ctx, &fs, n / 2 + 1);
+    axp__free(ctx, composite, (size_t)n + 1);
+    if (ok) axp_error_reset(ctx);
+    return ok;
+}
+
+// The sieve behind Kummer's exponents costs O(n) whatever k is. For small k the running product
+// C(n - k + i, i) = C(n - k + i - 1, i - 1) (n - k + i) / i, with exact scalar steps, costs O(k^2 log n).
+static inline bool axp__binomial_direct(axp_size_t n, axp_size_t k) {
+    return (uint64_t)k * k * AXP__BINOMIAL_DIRECT_RATIO <= n;
+}
+
+static bool axp__binomial_running(AXP_Ctx *ctx, axp_size_t n, axp_size_t k, AXP_Int *res) {
+    // Every factor n - k + i < 2^32 adds at most ten digits
+    if (!axp_initi(ctx, res, k * 10 + 1)) return false;
+    res->digits[0] = 1;
+    res->size = 1;
+    for (axp_size_t i = 1; i <= k; i++) {
+        res->size = axp__mul_small_digits(res->digits, res->size, n - k + i);
+        uint64_t rem = 0;
+        for (axp_size_t j = res->size; j-- > 0;) {
+            rem = rem * BASE + res->digits[j];
+            res->digits[j] = (axp_digit_t)(rem / i);
+            rem %= i;
+        }
+        while (res->size > 1 && res->digits[res->size - 1] == 0) res->size--;
+    }
+    axp_error_reset(ctx);
+    return true;
+}
+
+bool axp_binomiali(AXP_Ctx *ctx, axp_size_t n, axp_size_t k, AXP_Int *res) {
+    if (k > n) return axp_initi_i64(ctx, res, 0);
+    if (k > n - k) k = n - k;
+    if (k == 0) return axp_initi_i64(ctx, res, 1);
+    if (axp__binomial_direct(n, k)) return axp__binomial_running(ctx, n, k, res);
+
+    uint8_t *composite = axp__sieve(ctx, n);
+    if (!composite) return false;
+    axp__Factors fs;
+    if (!axp__factors_init(ctx, &fs, n / 2 + 1)) { axp__free(ctx, composite, (size_t)n + 1); return false; }
+    // Kummer: p divides C(n, k) once per borrow when subtracting k from n in base p
+    for (axp_size_t p = 2; p <= n; p++) {
+        if (composite[p]) continue;
+        uint64_t pe = 1;
+        for (uint64_t pj = p; pj <= n; pj *= p) {
+            if ((n / pj) - (k / pj) - ((n - k) / pj)) pe *= p;
+        }
+        if (pe > 1) axp__factors_push(&fs, pe);
+    }
+    axp__factors_flush(&fs);
+    bool ok = axp__product_tree(ctx, fs.leaves, fs.len, res);
+    axp__factors_free(ctx, &fs, n / 2 + 1);
+    axp__free(ctx, composite, (size_t)n + 1);
+    if (ok) axp_error_reset(ctx);
+    return ok;
+}
+
+bool axp_primoriali(AXP_Ctx *ctx, axp_size_t n, AXP_Int *res) {
+    if (n < 2) return axp_initi_i64(ctx, res, 1);
+    uint8_t *composite = axp__sieve(ctx, n);
+    if (!composite) return false;
+    axp__Factors fs;
+    if (!axp__factors_init(ctx, &fs, n / 2 + 1)) { axp__free(ctx, composite, (size_t)n + 1); return false; }
+    for (axp_size_t p = 2; p <= n; p++) {
+        if (!composite[p]) axp__factors_push(&fs, p);
+    }
+    axp__factors_flush(&fs);
+    bool ok = axp__product_tree(ctx, fs.leaves, fs.len, res);
+    axp__factors_free(ctx, &fs, n / 2 + 1);
+    axp__free(ctx, composite, (size_t)n + 1);
+    if (ok) axp_error_reset(ctx);
+    return ok;
+}
+
+// Product of x + lo .. x + hi - 1 for an x too large for the uint64 leaves
+static bool axp__rising_tree(AXP_Ctx *ctx, const AXP_Int *x, axp_size_t lo, axp_size_t hi, AXP_Int *res) {
+    if (hi - lo == 1) {
+        AXP_Int off = { 0 };
+        if (!axp_initi_i64(ctx, &off, lo)) return false;
+        bool ok = axp_addi(ctx, x, &off, res);
+        axp_freei_ex(ctx, &off);
+        return ok;
+    }
+    AXP_Int l = { 0 };
+    AXP_Int r = { 0 };
+    axp_size_t mid = lo + (hi - lo) / 2;
+    if (!axp__rising_tree(ctx, x, lo, mid, &l)) return false;
+    if (!axp__rising_tree(ctx, x, mid, hi, &r)) { axp_freei_ex(ctx, &l); return false; }
+    bool ok = axp_muli(ctx, &l, &r, res);
+    axp_freei_ex(ctx, &l);
+    axp_freei_ex(ctx, &r);
+    return ok;
+}
+
+bool axp_rising_factoriali(AXP_Ctx *ctx, const AXP_Int *x, axp_size_t n, AXP_Int *res) {
+    if (!x->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot take the rising factorial of an uninitalized integer.");
+        return false;
+    }
+    if (n == 0) return axp_initi_i64(ctx, res, 1);
+
+    if (!x->sign && x->size <= 17) {
+        uint64_t x0 = 0;
+        for (axp_size_t i = x->size; i-- > 0;) x0 = x0 * BASE + x->digits[i];
+        if (x0 == 0) return axp_initi_i64(ctx, res, 0);
+        if (x0 + n <= UINT64_C(100000000000000000)) {
+            axp__Factors fs;
+            if (!axp__factors_init(ctx, &fs, n)) return false;
+            for (axp_size_t i = 0; i < n; i++) axp__factors_push(&fs, x0 + i);
+            axp__factors_flush(&fs);
+            bool ok = axp__product_tree(ctx, fs.leaves, fs.len, res);
+            axp__factors_free(ctx, &fs, n);
+            if (ok) axp_error_reset(ctx);
+            return ok;
+        }
+    }
+    if (!axp__rising_tree(ctx, x, 0, n, res)) return false;
+    if (axp__is_zero_digits(res->digits, res->size)) res->sign = 0;
+    axp_error_reset(ctx);
+    return true;
+}
+
+// ln x = pi / (2 AGM(1, 4/s)) - j ln 10 with s = x * 10^j > 10^(workprec/2), the truncation error of the
+// AGM formula is then below 10^-workprec. By homogeneity AGM(1, 4/s) = AGM(s, 4) / s, so no division
+// by s is needed. ln s is large compared to ln x close to 1, the digits cancelled against j ln 10 are
+// added to the working precision up front.
+static bool axp__lnf_attempt_agm(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, AXP_Float *out, bool *ambiguous) {
+    axp_size_t guard = 0;
+    axp_size_t tmp_precision = precision;
+    while (tmp_precision) { guard++; tmp_precision /= 10; }
+
+    // Digits lost when ln x is much smaller than ln s, |ln x| ~ |x - 1| close to 1
+    axp_size_t cancel = 0;
+    double seed = fabs(axp__lnf_seed(x));
+    if (seed < 1e-8) {
+        AXP_Float one = { 0 };
+        AXP_Float diff = { 0 };
+        if (!axp_initf_ex(ctx, &one, 1)) return false;
+        one.digits[0] = 1;
+        bool ok = axp_subf_ex(ctx, x, &one, &diff, x->size + 1);
+        axp_freef_ex(ctx, &one);
+        if (!ok) return false;
+        bool diff_zero;
+        if (!axp_is_zerof(ctx, &diff, &diff_zero)) { axp_freef_ex(ctx, &diff); return false; }
+        axp_exp_t diff_mag = diff.exponent + (axp_exp_t)diff.size;
+        axp_freef_ex(ctx, &diff);
+        if (diff_zero) {
+            // ln 1 = 0 exactly
+            if (!axp_initf_ex(ctx, out, 1)) return false;
+            out->size = 1;
+            if (ambiguous) *ambiguous = false;
+            axp_error_reset(ctx);
+            return true;
+        }
+        cancel = (axp_size_t)(-diff_mag) + 1;
+    } else if (seed < 1.0) {
+        cancel = (axp_size_t)(-log10(seed)) + 1;
+    }
+
+    axp_size_t base_prec = precision + guard + extra;
+    axp_size_t workprec = base_prec + cancel + guard + 2;
+
+    axp_exp_t e10 = x->exponent + (axp_exp_t)x->size - 1;
+    axp_exp_t target = (axp_exp_t)(workprec / 2) + 2;
+    axp_exp_t j = (e10 < target) ? target - e10 : 0;
+
+    AXP_Float s = { 0 };
+    AXP_Float a = { 0 };
+    AXP_Float b = { 0 };
+    AXP_Float pi = { 0 };
+    AXP_Float ln10 = { 0 };
+    AXP_Float tmp = { 0 };
+    AXP_Float res = { 0 };
+
+    // a = s = x * 10^j, b = 4
+    if (!axp_copyf_ex_round(ctx, &s, x, workprec)) return false;
+    s.exponent += j;
+    if (!axp_copyf_exact(ctx, &a, &s)) goto cleanup_error;
+    if (!axp_initf_ex(ctx, &b, 1)) goto cleanup_error;
+    b.digits[0] = 4;
+
+    axp_digit_t five = 5;
+    const AXP_Float half = { 1, 1, &five, 0, -1 };
+    for (axp_size_t iter = 0; iter < 128; iter++) {
+        // Once a and b agree to half the digits, (a+b)/2 is the AGM to full precision
+        AXP_Float diff = { 0 };
+        if (!axp_subf_ex(ctx, &a, &b, &diff, workprec)) goto cleanup_error;
+        bool diff_zero;
+        bool zero_ok = axp_is_zerof(ctx, &diff, &diff_zero);
+        axp_exp_t diff_mag = diff.exponent + (axp_exp_t)diff.size;
+        axp_exp_t a_mag = a.exponent + (axp_exp_t)a.size;
+        axp_freef_ex(ctx, &diff);
+        if (!zero_ok) goto cleanup_error;
+        bool converged = diff_zero || a_mag - diff_mag > (axp_exp_t)(workprec / 2) + 1;
+
+        AXP_Float next_a = { 0 };
+        if (!axp_addf_ex(ctx, &a, &b, &next_a, workprec)) goto cleanup_error;
+        if (!axp__mulf_into(ctx, &next_a, &half, workprec)) { axp_freef_ex(ctx, &next_a); goto cleanup_error; }
+        if (converged) {
+            axp_freef_ex(ctx, &a);
+            a = next_a;
+            break;
+        }
+        if (!axp_mulf_ex(ctx, &a, &b, &tmp, workprec)) { axp_freef_ex(ctx, &next_a); goto cleanup_error; }
+        axp_freef_ex(ctx, &b);
+        b = (AXP_Float){ 0 };
+        bool ok = axp__sqrtf(ctx, &tmp, &b, workprec);
+        axp_freef_ex(ctx, &tmp);
+        tmp = (AXP_Float){ 0 };
+        if (!ok) { axp_freef_ex(ctx, &next_a); goto cleanup_error; }
+        axp_freef_ex(ctx, &a);
+        a = next_a;
+    }
+
+    // ln s = pi * s / (2 AGM(s, 4)), ln x = ln s - j ln 10
+    if (!axp_pi_ex(ctx, &pi, workprec)) goto cleanup_error;
+    if (!axp__mulf_into(ctx, &pi, &s, workprec)) goto cleanup_error;
+    if (!axp_divf_ex(ctx, &pi, &a, &res, workprec)) goto cleanup_error;
+    if (!axp__mulf_into(ctx, &res, &half, workprec)) goto cleanup_error;
+    if (j) {
+        if (!axp_ln10_ex(ctx, &ln10, workprec)) goto cleanup_error;
+        if (!axp__combinef(ctx, 1, &res, -(int64_t)j, &ln10, &tmp, workprec)) goto cleanup_error;
+        axp_freef_ex(ctx, &res);
+        res = tmp;
+        tmp = (AXP_Float){ 0 };
+    }
+
+    axp__releasef(ctx, &s);
+    axp__releasef(ctx, &a);
+    axp__releasef(ctx, &b);
+    axp__releasef(ctx, &pi);
+    axp__releasef(ctx, &ln10);
+
+    if (!axp_reallocf_round(ctx, &res, base_prec)) goto cleanup_error;
+    if (ambiguous) {
+        axp_size_t safety = (res.size > precision) ? (res.size - precision) : 0;
+        *ambiguous = !axp__round_is_unambiguous(res.digits, safety);
+    }
+    *out = res;
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &s);
+    axp__releasef(ctx, &a);
+    axp__releasef(ctx, &b);
+    axp__releasef(ctx, &pi);
+    axp__releasef(ctx, &ln10);
+    axp__releasef(ctx, &tmp);
+    axp__releasef(ctx, &res);
+    return false;
+}
+
+// A retry resumes from the iterate of the previous attempt, which is already correct to its working
+// precision, so the doubled guard digits cost a single Newton step. Unless the call is raw the ladder
+// first stops at settle_prec, short of the Ziv guard digits, and returns there when the error bound
+// of the iterate can no longer move the rounded digits.
+static bool axp__lnf_attempt_newton(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, axp__ZivState *state, AXP_Float *out, bool *ambiguous) {
+    axp_size_t guard = 0;
+    axp_size_t tmp_precision = precision;
+    while (tmp_precision) { guard++; tmp_precision /= 10; }
+    axp_size_t workprec = precision + guard + extra;
+
+    AXP_Float y = { 0 };
+    axp_size_t cur_prec;
+    if (state->value.digits && state->precision < workprec) {
+        y = state->value;
+        cur_prec = state->precision;
+        state->value = (AXP_Float){ 0 };
+        state->precision = 0;
+    } else {
+        axp__ziv_state_free(ctx, state);
+        if (!axp__double_to_float(ctx, axp__lnf_seed(x), &y)) return false;
+        cur_prec = (workprec < 18) ? workprec : 18;
+        if (!axp_reallocf_round(ctx, &y, cur_prec)) { axp_freef_ex(ctx, &y); return false; }
+    }
+
+    AXP_Float one = { 0 };
+    if (!axp_initf_ex(ctx, &one, 1)) { axp_freef_ex(ctx, &y); return false; }
+    one.digits[0] = 1;
+    one.size = 1;
+
+    axp_size_t settle_prec = (ambiguous && precision + guard + 2 < workprec) ? precision + guard + 2 : workprec;
+    bool settled = false;
+
+    while (cur_prec < workprec) {
+        axp_size_t target = (cur_prec < settle_prec) ? settle_prec : workprec;
+        cur_prec = (cur_prec * 2 < target) ? cur_prec * 2 : target;
+
+        // y += x e^-y - 1, the step corrects the errors of the raw tier along with those of y
+        AXP_Float neg_y = y;
+        neg_y.sign = 1 - neg_y.sign;
+
+        AXP_Float exp_neg_y = { 0 };
+        if (!axp__expf_raw(ctx, &neg_y, &exp_neg_y, cur_prec)) goto cleanup_error;
+
+        AXP_Float term = { 0 };
+        bool ok = axp__mulf_raw(ctx, x, &exp_neg_y, &term, cur_prec);
+        axp_freef_ex(ctx, &exp_neg_y);
+        if (!ok) goto cleanup_error;
+
+        AXP_Float correction = { 0 };
+        ok = axp__subf_raw(ctx, &term, &one, &correction, cur_prec);
+        axp_freef_ex(ctx, &term);
+        if (!ok) goto cleanup_error;
+
+        AXP_Float y_next = { 0 };
+        ok = axp_addf_ex(ctx, &y, &correction, &y_next, cur_prec);
+        if (!ok) { axp_freef_ex(ctx, &correction); goto cleanup_error; }
+
+        if (cur_prec == settle_prec && settle_prec < workprec) {
+            // The error of y_next is about correction^2 / 2 from the quadratic convergence, plus a few
+            // units of 10^-cur_prec from the raw tier and the rounding of y_next
+            axp_exp_t y_mag = y_next.exponent + (axp_exp_t)y_next.size;
+            axp_exp_t err_exp = 2 - (axp_exp_t)cur_prec + (y_mag > 0 ? y_mag : 0);
+            if (!axp__is_zero_digits(correction.digits, correction.size)) {
+                axp_exp_t corr_mag = correction.exponent + (axp_exp_t)correction.size;
+                if (2 * corr_mag > err_exp) err_exp = 2 * corr_mag;
+            }
+            settled = axp__round_is_settled(&y_next, precision, err_exp + 1);
+        }
+        axp_freef_ex(ctx, &correction);
+
+        axp_freef_ex(ctx, &y);
+        y = y_next;
+        if (settled) break;
+    }
+
+    axp_freef_ex(ctx, &one);
+
+    if (!axp_copyf_exact(ctx, &state->value, &y)) goto cleanup_error;
+    state->precision = cur_prec - guard;
+
+    if (ambiguous) {
+        axp_size_t safety = (y.size > precision) ? (y.size - precision) : 0;
+        *ambiguous = !settled && !axp__round_is_unambiguous(y.digits, safety);
+    }
+    *out = y;
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp_freef_ex(ctx, &y);
+    axp_freef_ex(ctx, &one);
+    return false;
+}
+
+// Decade k of x = m * 10^k with m in [1/sqrt(10), sqrt(10)), values close to 1 keep k = 0
+static axp_exp_t axp__lnf_decade(const AXP_Float *x) {
+    axp_size_t top = x->size;
+    while (top > 1 && x->digits[top - 1] == 0) top--;
+    double lead = 0.0;
+    for (axp_size_t i = 0; i < 8 && i < top; i++) {
+        lead = lead * 10.0 + (double)x->digits[top - 1 - i];
+    }
+    axp_size_t taken = top < 8 ? top : 8;
+    lead /= pow(10.0, (double)(taken - 1));
+    axp_exp_t k = x->exponent + (axp_exp_t)top - 1;
+    return (lead >= 3.16227766016838) ? k + 1 : k;
+}
+
+// Returns true and sets k when x is exactly 10^k
+static bool axp__float_is_pow10(const AXP_Float *x, axp_exp_t *k) {
+    if (x->sign) return false;
+    axp_size_t top = x->size;
+    while (top > 0 && x->digits[top - 1] == 0) top--;
+    if (top == 0 || x->digits[top - 1] != 1) return false;
+    for (axp_size_t i = 0; i + 1 < top; i++) {
+        if (x->digits[i]) return false;
+    }
+    *k = x->exponent + (axp_exp_t)top - 1;
+    return true;
+}
+
+static bool axp__lnf_attempt_reduced(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, axp__ZivState *state, AXP_Float *out, bool *ambiguous) {
+    axp_size_t agm_threshold = ctx->ln_agm_threshold ? ctx->ln_agm_threshold : AXP_LN_AGM_DEFAULT_THRESHOLD;
+    if (precision + extra >= agm_threshold) {
+        axp__ziv_state_free(ctx, state);
+        return axp__lnf_attempt_agm(ctx, x, precision, extra, out, ambiguous);
+    }
+    return axp__lnf_attempt_newton(ctx, x, precision, extra, state, out, ambiguous);
+}
+
+// ln x = ln m + k ln 10 with x = m * 10^k. |ln m| <= ln(10)/2 while |ln x| >= ln(10)/2 for k != 0, so
+// ln m to the working precision is enough and the sum cannot cancel. `state` resumes ln m.
+static bool axp__lnf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t precision, axp_size_t extra, axp__ZivState *state, AXP_Float *out, bool *ambiguous) {
+    axp_exp_t k = axp__lnf_decade(x);
+    if (!k) return axp__lnf_attempt_reduced(ctx, x, precision, extra, state, out, ambiguous);
+
+    AXP_Float m = *x;
+    m.exponent -= k;
+
+    axp_size_t guard = 0;
+    axp_size_t tmp_precision = precision;
+    while (tmp_precision) { guard++; tmp_precision /= 10; }
+    axp_size_t workprec = precision + guard + extra + 1;
+
+    AXP_Float ln_m = { 0 };
+    AXP_Float ln10 = { 0 };
+    AXP_Float res = { 0 };
+    // ln m is only an intermediate, it must not stop early on its own rounding
+    if (!axp__lnf_attempt_reduced(ctx, &m, precision, extra, state, &ln_m, NULL)) return false;
+    if (!axp_ln10_ex(ctx, &ln10, workprec)) goto cleanup_error;
+    if (!axp__combinef(ctx, 1, &ln_m, k, &ln10, &res, workprec)) goto cleanup_error;
+
+    axp_freef_ex(ctx, &ln_m);
+    axp_freef_ex(ctx, &ln10);
+
+    if (ambiguous) {
+        axp_size_t safety = (res.size > precision) ? (res.size - precision) : 0;
+        *ambiguous = !axp__round_is_unambiguous(res.digits, safety);
+    }
+    *out = res;
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &ln_m);
+    axp__releasef(ctx, &ln10);
+    axp__releasef(ctx, &res);
+    return false;
+}
+
+bool axp_lnf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    bool x_zero;
+    if (!axp_is_zerof(ctx, x, &x_zero)) return false;
+    if (x_zero || x->sign) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "ln of a non-positive number is undefined.");
+        return false;
+    }
+
+    axp_size_t extra = ctx->fast_rounding ? 5 : (ctx->ziv_safety_digits ? ctx->ziv_safety_digits : AXP_ZIV_DEFAULT_SAFETY_DIGITS);
+    axp_size_t max_attempts = ctx->fast_rounding ? 1 : (ctx->ziv_max_retries ? ctx->ziv_max_retries : AXP_ZIV_DEFAULT_MAX_RETRIES);
+
+    axp__ZivState state = { 0 };
+    for (axp_size_t attempt = 0; attempt < max_attempts; attempt++) {
+        AXP_Float candidate = { 0 };
+        bool ambiguous = false;
+        if (!axp__lnf_attempt(ctx, x, precision, extra, &state, &candidate, &ambiguous)) { axp__ziv_state_free(ctx, &state); return false; }
+        if (ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
+            axp__ziv_state_free(ctx, &state);
+            *res = candidate;
+            if (!axp_reallocf_round(ctx, res, precision)) return false;
+            axp_error_reset(ctx);
+            return true;
+        }
+        axp_freef_ex(ctx, &candidate);
+        extra *= 2;
+    }
+    UNREACHABLE("axp_lnf_ex retry loop should always return");
+    return false;
+}
+
+// log_b x = ln x / ln b, `base` NULL takes ln b from the constant cache entry `base_const`
+static bool axp__logf_attempt(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *base, AXP_Constant base_const, axp_size_t precision, axp_size_t extra, axp__ZivState *states, AXP_Float *out, bool *ambiguous) {
+    axp_size_t guard = 0;
+    axp_size_t tmp_precision = precision;
+    while (tmp_precision) { guard++; tmp_precision /= 10; }
+    axp_size_t workprec = precision + guard + extra;
+
+    AXP_Float ln_x = { 0 };
+    AXP_Float ln_b = { 0 };
+    AXP_Float res = { 0 };
+
+    if (!axp__lnf_attempt(ctx, x, precision + 2, extra, &states[0], &ln_x, NULL)) return false;
+    if (base) {
+        if (!axp__lnf_attempt(ctx, base, precision + 2, extra, &states[1], &ln_b, NULL)) goto cleanup_error;
+    } else {
+        if (!axp_constf_ex(ctx, base_const, &ln_b, workprec + 2)) goto cleanup_error;
+    }
+    if (!axp_divf_ex(ctx, &ln_x, &ln_b, &res, workprec)) goto cleanup_error;
+
+    axp_freef_ex(ctx, &ln_x);
+    axp_freef_ex(ctx, &ln_b);
+
+    axp_size_t safety = (res.size > precision) ? (res.size - precision) : 0;
+    *ambiguous = !axp__round_is_unambiguous(res.digits, safety);
+    *out = res;
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &ln_x);
+    axp__releasef(ctx, &ln_b);
+    axp__releasef(ctx, &res);
+    return false;
+}
+
+static bool axp__logf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *base, AXP_Constant base_const, AXP_Float *res, axp_size_t precision) {
+    bool x_zero;
+    if (!axp_is_zerof(ctx, x, &x_zero)) return false;
+    if (x_zero || x->sign) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "log of a non-positive number is undefined.");
+        return false;
+    }
+
+    // log 1 = 0 for every base, log_10 10^k = k
+    axp_exp_t k;
+    bool x_pow10 = axp__float_is_pow10(x, &k);
+    if (x_pow10 && (k == 0 || (!base && base_const == AXP_CONST_LN10))) {
+        AXP_Int k_int = { 0 };
+        if (!axp_initi_i64(ctx, &k_int, k)) return false;
+        AXP_Float k_view = { k_int.size, k_int.capacity, k_int.digits, k_int.sign, 0 };
+        bool ok = axp_copyf_ex_round(ctx, res, &k_view, precision);
+        axp_freei_ex(ctx, &k_int);
+        return ok;
+    }
+
+    axp_size_t extra = ctx->fast_rounding ? 5 : (ctx->ziv_safety_digits ? ctx->ziv_safety_digits : AXP_ZIV_DEFAULT_SAFETY_DIGITS);
+    axp_size_t max_attempts = ctx->fast_rounding ? 1 : (ctx->ziv_max_retries ? ctx->ziv_max_retries : AXP_ZIV_DEFAULT_MAX_RETRIES);
+
+    // ln x and ln b are resumed independently
+    axp__ZivState states[2] = { 0 };
+    for (axp_size_t attempt = 0; attempt < max_attempts; attempt++) {
+        AXP_Float candidate = { 0 };
+        bool ambiguous = false;
+        bool ok = axp__logf_attempt(ctx, x, base, base_const, precision, extra, states, &candidate, &ambiguous);
+        if (!ok || ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
+            axp__ziv_state_free(ctx, &states[0]);
+            axp__ziv_state_free(ctx, &states[1]);
+        }
+        if (!ok) return false;
+        if (ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
+            *res = candidate;
+            if (!axp_reallocf_round(ctx, res, precision)) return false;
+            axp_error_reset(ctx);
+            return true;
+        }
+        axp_freef_ex(ctx, &candidate);
+        extra *= 2;
+    }
+    UNREACHABLE("axp__logf_ex retry loop should always return");
+    return false;
+}
+
+bool axp_log10f(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
+    return axp_log10f_ex(ctx, x, res, ctx->precision);
+}
+
+bool axp_log10f_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    return axp__logf_ex(ctx, x, NULL, AXP_CONST_LN10, res, precision);
+}
+
+bool axp_log2f(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
+    return axp_log2f_ex(ctx, x, res, ctx->precision);
+}
+
+bool axp_log2f_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    return axp__logf_ex(ctx, x, NULL, AXP_CONST_LN2, res, precision);
+}
+
+bool axp_logbf(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *b, AXP_Float *res) {
+    return axp_logbf_ex(ctx, x, b, res, ctx->precision);
+}
+
+bool axp_logbf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *b, AXP_Float *res, axp_size_t precision) {
+    bool b_zero;
+    if (!axp_is_zerof(ctx, b, &b_zero)) return false;
+    axp_exp_t k;
+    if (b_zero || b->sign || (axp__float_is_pow10(b, &k) && k == 0)) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "log base must be positive and different from 1.");
+        return false;
+    }
+    return axp__logf_ex(ctx, x, b, AXP_CONST_LN10, res, precision);
+}
+
+bool axp_powff(AXP_Ctx *ctx, AXP_Float *x, const AXP_Float *y, AXP_Float *res) {
+    return axp_powff_ex(ctx, x, y, res, ctx->precision);
+}
+
+// y = p/q in lowest terms with q = 2 (half-integers) or p = +-1 (y = 1/q), those go through a root
+// instead of ln and exp. y has to be a short non-integer decimal for p and q to fit in 64 bits.
+static bool axp__powff_root_exponent(const AXP_Float *y, int64_t *p, axp_size_t *q) {
+    if (y->exponent >= 0 || y->size > 18 || -y->exponent > 18) return false;
+    uint64_t num = 0;
+    for (axp_size_t i = y->size; i > 0; i--) num = num * 10 + y->digits[i - 1];
+    uint64_t den = 1;
+    for (axp_exp_t i = 0; i < -y->exponent; i++) den *= 10;
+
+    uint64_t a = num, b = den;
+    while (b) { uint64_t r = a % b; a = b; b = r; }
+    num /= a;
+    den /= a;
+    if (den > AXP_POWFF_MAX_ROOT || num > UINT32_MAX) return false;
+
+    *p = y->sign ? -(int64_t)num : (int64_t)num;
+    *q = (axp_size_t)den;
+    return true;
+}
+
+// x^(p/q) when the q-th root of x is a short decimal: the candidate root rounded to the digits an
+// exact root could have is checked against x, the power of an exact root is then rounded once
+static bool axp__powff_root_exact(AXP_Ctx *ctx, AXP_Float *x, int64_t p, axp_size_t q, AXP_Float *res, axp_size_t precision, bool *exact) {
+    *exact = false;
+    // An exact root t * 10^f with t free of trailing zeros needs q to divide the exponent of x in the same form
+    axp_size_t zeros = 0;
+    while (zeros + 1 < x->size && x->digits[zeros] == 0) zeros++;
+    axp_exp_t e = x->exponent + (axp_exp_t)zeros;
+    if (e % (axp_exp_t)q != 0) return true;
+
+    axp_size_t digits = (x->size + q - 1) / q + 1;
+    AXP_Float approx = { 0 };
+    AXP_Float t = { 0 };
+    AXP_Float check = { 0 };
+    if (!axp__rootf(ctx, x, q, &approx, digits + 3)) return false;
+    bool ok = axp_copyf_ex_round(ctx, &t, &approx, digits);
+    axp_freef_ex(ctx, &approx);
+    if (!ok) return false;
+    axp_normalizef(&t);
+    t.sign = x->sign;
+
+    // The product has at most q * t.size digits, so the power is exact at that precision
+    if (!axp_powf_ex(ctx, &t, (axp_exp_t)q, &check, q * t.size + 1)) goto cleanup_error;
+    *exact = axp__abs_cmpf_exact(&check, x) == 0;
+    axp_freef_ex(ctx, &check);
+    if (*exact && !axp_powf_ex(ctx, &t, (axp_exp_t)p, res, precision)) goto cleanup_error;
+    axp_freef_ex(ctx, &t);
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &t);
+    axp__releasef(ctx, &check);
+    return false;
+}
+
+// x^(p/q) = root_q(x)^p, the digits of p cover the error amplification of the power
+static bool axp__powff_root_attempt(AXP_Ctx *ctx, const AXP_Float *x, int64_t p, axp_size_t q, axp_size_t precision, axp_size_t extra, AXP_Float *out, bool *ambiguous) {
+    axp_size_t abs_p = (axp_size_t)(p < 0 ? -p : p);
+    axp_size_t guard = 1;
+    for (axp_size_t tmp = precision; tmp; tmp /= 10) guard++;
+    axp_size_t pow_guard = 1;
+    for (axp_size_t tmp = abs_p; tmp > 1; tmp >>= 1) pow_guard++;
+    axp_size_t workprec = precision + guard + extra;
+
+    AXP_Float root = { 0 };
+    AXP_Float res = { 0 };
+    if (!axp__rootf(ctx, x, q, &root, workprec + pow_guard)) return false;
+    bool ok = axp__powf_attempt(ctx, &root, (axp_exp_t)p, abs_p, pow_guard, workprec, 0, NULL, &res, NULL);
+    axp_freef_ex(ctx, &root);
+    if (!ok) return false;
+    if (!axp_reallocf_round(ctx, &res, workprec)) { axp_freef_ex(ctx, &res); return false; }
+
+    axp_size_t safety = (res.size > precision) ? (res.size - precision) : 0;
+    *ambiguous = !axp__round_is_unambiguous(res.digits, safety);
+    *out = res;
+    axp_error_reset(ctx);
+    return true;
+}
+
+// `state` resumes ln x, only exp(y ln x) is recomputed from scratch on a retry
+static bool axp__powff_attempt(AXP_Ctx *ctx, AXP_Float *x, const AXP_Float *y, axp_size_t precision, axp_size_t extra, axp__ZivState *state, AXP_Float *out, bool *ambiguous) {
+    axp_size_t guard = 0;
+    axp_size_t tmp_precision = precision;
+    while (tmp_precision) { guard++; tmp_precision /= 10; }
+
+    double exponent_est = axp__float_to_double(y) * axp__lnf_seed(x);
+    axp_size_t amp_guard = 1;
+    if (isfinite(exponent_est) && fabs(exponent_est) > 1.0) {
+        amp_guard += (axp_size_t)ceil(log10(fabs(exponent_est)));
+    }
+
+    axp_size_t workprec = precision + guard + extra + amp_guard;
+
+    AXP_Float ln_x = { 0 };
+    if (!axp__lnf_attempt(ctx, x, workprec, 0, state, &ln_x, NULL)) return false;
+
+    AXP_Float exponent = { 0 };
+    bool ok = axp__mulf_raw(ctx, y, &ln_x, &exponent, workprec);
+    axp_freef_ex(ctx, &ln_x);
+    if (!ok) return false;
+
+    // Only the digits the raw exp guarantees may take part in the ambiguity test
+    AXP_Float result = { 0 };
+    ok = axp__expf_raw(ctx, &exponent, &result, workprec);
+    axp_freef_ex(ctx, &exponent);
+    if (!ok) return false;
+    if (!axp_reallocf_round(ctx, &result, workprec)) { axp_freef_ex(ctx, &result); return false; }
+
+    axp_size_t safety = (result.size > precision) ? (result.size - precision) : 0;
+    *ambiguous = !axp__round_is_unambiguous(result.digits, safety);
+    *out = result;
+    axp_error_reset(ctx);
+    return true;
+}
+
+bool axp_powff_ex(AXP_Ctx *ctx, AXP_Float *x, const AXP_Float *y, AXP_Float *res, axp_size_t precision) {
+    bool x_zero, y_zero;
+    if (!axp_is_zerof(ctx, x, &x_zero)) return false;
+    if (!axp_is_zerof(ctx, y, &y_zero)) return false;
+
+    if (x_zero && y_zero) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "0^0 is undefined.");
+        return false;
+    }
+    if (x_zero) {
+        if (y->sign) {
+            axp_throw(ctx, AXP_ERR_DIV_ZERO, "0^negative is undefined.");
+            return false;
+        }
+        if (!axp_initf_ex(ctx, res, precision)) return false;
+        res->size = 1;
+        return true;
+    }
+    if (y_zero) {
+        if (!axp_initf_ex(ctx, res, precision)) return false;
+        res->digits[0] = 1;
+        res->size = 1;
+        return true;
+    }
+    // x^0.5 skips the exponent analysis below
+    if (!y->sign && y->exponent == -1 && y->size == 1 && y->digits[0] == 5) {
+        if (x->sign) {
+            axp_throw(ctx, AXP_ERR_DIV_ZERO, "Negative base with non-integer exponent is undefined.");
+            return false;
+        }
+        return axp_sqrtf_ex(ctx, x, res, precision);
+    }
+
+    AXP_Int y_int_part = { 0 };
+    AXP_Float y_frac = { 0 };
+    if (!axp_floorf(ctx, y, &y_int_part, &y_frac)) return false;
+    bool y_frac_zero;
+    if (!axp_is_zerof(ctx, &y_frac, &y_frac_zero)) { axp_freei_ex(ctx, &y_int_part); axp_freef_ex(ctx, &y_frac); return false; }
+    axp_freef_ex(ctx, &y_frac);
+
+    if (y_frac_zero) {
+        axp_exp_t y_int = 0;
+        bool overflow = false;
+        for (axp_size_t i = y_int_part.size; i > 0; i--) {
+            if (y_int > (AXP_TYPE_MAX_VALUE(axp_exp_t) - (axp_exp_t)y_int_part.digits[i-1]) / 10) { overflow = true; break; }
+            y_int = y_int * 10 + y_int_part.digits[i-1];
+        }
+        if (overflow) {
+            axp_freei_ex(ctx, &y_int_part);
+            axp_throw(ctx, AXP_ERR_OVERFLOW, "Integer exponent too large to represent.");
+            return false;
+        }
+        if (y_int_part.sign) y_int = -y_int;
+        axp_freei_ex(ctx, &y_int_part);
+        return axp_powf_ex(ctx, x, y_int, res, precision);
+    }
+    axp_freei_ex(ctx, &y_int_part);
+
+    if (x->sign) {
+        axp_throw(ctx, AXP_ERR_DIV_ZERO, "Negative base with non-integer exponent is undefined.");
+        return false;
+    }
+
+    // Roots are correctly rounded on their own, other rational exponents p/q run the Ziv loop below
+    // unless the root is exact
+    int64_t root_p = 0;
+    axp_size_t root_q;
+    bool root_exponent = axp__powff_root_exponent(y, &root_p, &root_q);
+    if (root_exponent && root_p == 1) return axp_rootf_ex(ctx, x, root_q, res, precision);
+    if (root_exponent && root_p == -1 && root_q == 2) return axp_rsqrtf_ex(ctx, x, res, precision);
+    if (root_exponent) {
+        bool exact;
+        if (!axp__powff_root_exact(ctx, x, root_p, root_q, res, precision, &exact)) return false;
+        if (exact) return true;
+    }
+
+    axp_size_t extra = ctx->fast_rounding ? 5 : (ctx->ziv_safety_digits ? ctx->ziv_safety_digits : AXP_ZIV_DEFAULT_SAFETY_DIGITS);
+    axp_size_t max_attempts = ctx->fast_rounding ? 1 : (ctx->ziv_max_retries ? ctx->ziv_max_retries : AXP_ZIV_DEFAULT_MAX_RETRIES);
+
+    axp__ZivState state = { 0 };
+    for (axp_size_t attempt = 0; attempt < max_attempts; attempt++) {
+        AXP_Float candidate = { 0 };
+        bool ambiguous = false;
+        bool ok = root_exponent
+            ? axp__powff_root_attempt(ctx, x, root_p, root_q, precision, extra, &candidate, &ambiguous)
+            : axp__powff_attempt(ctx, x, y, precision, extra, &state, &candidate, &ambiguous);
+        if (!ok) { axp__ziv_state_free(ctx, &state); return false; }
+        if (ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
+            axp__ziv_state_free(ctx, &state);
+            *res = candidate;
+            if (!axp_reallocf_round(ctx, res, precision)) return false;
+            axp_error_reset(ctx);
+            return true;
+        }
+        axp_freef_ex(ctx, &candidate);
+        extra *= 2;
+    }
+    UNREACHABLE("axp_powff_ex retry loop should always return");
+    return false;
+}
+
+// Magnitude estimate log10|x|, also valid far outside the double range
+static double axp__log10_est(const AXP_Float *x) {
+    return axp__lnf_seed(x) / 2.302585092994046;
+}
+
+// res = |x| - k pi/2 with k the integer nearest to |x| / (pi/2), |res| <= pi/4 and `quadrant` = k mod 4.
+// pi is taken to enough digits that res keeps `precision` correct digits after the cancellation.
+static bool axp__trigf_reduce(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, unsigned *quadrant, axp_size_t precision) {
+    AXP_Float x_abs = *x;
+    x_abs.sign = 0;
+    *quadrant = 0;
+    if (fabs(axp__float_to_double(&x_abs)) < 0.78) {
+        *res = (AXP_Float){ 0 };
+        return axp_copyf_ex_round(ctx, res, &x_abs, precision);
+    }
+
+    // |x| < 10^mag, every pass checks that the absolute error of k pi/2 stays below 10^(rmag-precision-2)
+    axp_exp_t mag = x_abs.exponent + (axp_exp_t)x_abs.size;
+    if (mag < 0) mag = 0;
+    axp_digit_t five = 5;
+    const AXP_Float half = { 1, 1, &five, 0, -1 };
+    AXP_Float pi = { 0 };
+    AXP_Float half_pi = { 0 };
+    AXP_Float q = { 0 };
+    AXP_Float frac = { 0 };
+    AXP_Float kp = { 0 };
+    AXP_Float r = { 0 };
+    AXP_Int k = { 0 };
+
+    axp_size_t pi_prec = precision + (axp_size_t)mag + 6;
+    for (unsigned pass = 0; pass < 8; pass++) {
+        if (!axp_pi_ex(ctx, &pi, pi_prec)) goto cleanup_error;
+        if (!axp_mulf_ex(ctx, &pi, &half, &half_pi, pi_prec)) goto cleanup_error;
+        axp__releasef(ctx, &pi);
+
+        if (!k.digits) {
+            AXP_Float rounded = { 0 };
+            if (!axp_divf_ex(ctx, &x_abs, &half_pi, &q, (axp_size_t)mag + 4)) goto cleanup_error;
+            bool ok = axp_addf_ex(ctx, &q, &half, &rounded, (axp_size_t)mag + 4);
+            axp__releasef(ctx, &q);
+            if (!ok) goto cleanup_error;
+            ok = axp_floorf(ctx, &rounded, &k, &frac);
+            axp_freef_ex(ctx, &rounded);
+            if (!ok) goto cleanup_error;
+            axp__releasef(ctx, &frac);
+            if (k.size == 0 || (k.size == 1 && k.digits[0] == 0)) {
+                // pi/4 < |x| < 0.78 is not possible, but the estimate above may land on k = 0
+                axp__releasef(ctx, &half_pi);
+                axp_freei_ex(ctx, &k);
+                *res = (AXP_Float){ 0 };
+                return axp_copyf_ex_round(ctx, res, &x_abs, precision);
+            }
+            unsigned low = (k.size > 0 ? k.digits[0] : 0) + 10u * (k.size > 1 ? k.digits[1] : 0);
+            *quadrant = low % 4;
+        }
+
+        AXP_Float k_view = { k.size, k.capacity, k.digits, 0, 0 };
+        if (!axp_mulf_ex(ctx, &k_view, &half_pi, &kp, pi_prec)) goto cleanup_error;
+        axp__releasef(ctx, &half_pi);
+        if (!axp_subf_ex(ctx, &x_abs, &kp, &r, pi_prec)) goto cleanup_error;
+        axp__releasef(ctx, &kp);
+
+        bool r_zero;
+        if (!axp_is_zerof(ctx, &r, &r_zero)) goto cleanup_error;
+        axp_exp_t rmag = r.exponent + (axp_exp_t)r.size;
+        axp_size_t needed = precision + (axp_size_t)mag + 4 + (axp_size_t)(rmag < 0 ? -rmag : 0);
+        if (!r_zero && needed <= pi_prec) break;
+        pi_prec = r_zero ? pi_prec + precision : needed + 2;
+        if (pass + 1 == 8) {
+            axp_throw(ctx, AXP_ERR_OVERFLOW, "Could not reduce the argument of a trigonometric function.");
+            goto cleanup_error;
+        }
+        axp__releasef(ctx, &r);
+    }
+    axp_freei_ex(ctx, &k);
+
+    if (!axp_reallocf_round(ctx, &r, precision)) goto cleanup_error;
+    *res = r;
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &pi);
+    axp__releasef(ctx, &half_pi);
+    axp__releasef(ctx, &q);
+    axp__releasef(ctx, &frac);
+    axp__releasef(ctx, &kp);
+    axp__releasef(ctx, &r);
+    axp__releasei(ctx, &k);
+    return false;
+}
+
+// acc = acc / (a * b) for the series denominators, in one scalar pass while the long division
+// remainder times 10 still fits `axp_size_t`
+static bool axp__divf_small2_into(AXP_Ctx *ctx, AXP_Float *acc, axp_size_t a, axp_size_t b, axp_size_t precision) {
+    if (b && a <= (UINT32_MAX / BASE) / b) return axp__divf_small_into(ctx, acc, a * b, precision);
+    return axp__divf_small_into(ctx, acc, a, precision) && axp__divf_small_into(ctx, acc, b, precision);
+}
+
+// sin r for |r| <= pi/4: the Taylor series of y = r / 3^s followed by s triple angle steps
+// sin 3y = sin y (3 - 4 sin^2 y). A step never amplifies the relative error for |y| <= pi/12.
+static bool axp__sinf_reduced(AXP_Ctx *ctx, const AXP_Float *r, AXP_Float *res, axp_size_t precision) {
+    double target = -(sqrt((double)precision) / 4.0 + 1.0);
+    axp_size_t s = 0;
+    for (double est = axp__log10_est(r); est > target; est -= 0.47712125471966244) s++;
+    axp_size_t workprec = precision + 2;
+    for (axp_size_t tmp = s; tmp; tmp /= 10) workprec++;
+
+    axp_digit_t three_digit = 3;
+    axp_digit_t four_digit = 4;
+    const AXP_Float three = { 1, 1, &three_digit, 0, 0 };
+    const AXP_Float four = { 1, 1, &four_digit, 0, 0 };
+    AXP_Float y = { 0 };
+    AXP_Float y2 = { 0 };
+    AXP_Float term = { 0 };
+    AXP_Float sum = { 0 };
+    AXP_Float tmp = { 0 };
+    if (!axp_copyf_ex_round(ctx, &y, r, workprec)) return false;
+    for (axp_size_t left = s; left > 0;) {
+        axp_size_t chunk = left < 18 ? left : 18;
+        axp_size_t d = 1;
+        for (axp_size_t i = 0; i < chunk; i++) d *= 3;
+        if (!axp__divf_small_into(ctx, &y, d, workprec)) goto cleanup_error;
+        left -= chunk;
+    }
+
+    // sin y = y - y^3/3! + y^5/5! - ...
+    if (!axp_mulf_ex(ctx, &y, &y, &y2, workprec)) goto cleanup_error;
+    if (!axp_copyf_exact(ctx, &term, &y)) goto cleanup_error;
+    if (!axp_copyf_exact(ctx, &sum, &y)) goto cleanup_error;
+    // Terms only need the digits that still reach into the sum
+    axp_exp_t y_mag = y.exponent + (axp_exp_t)y.size;
+    axp_exp_t stop = y_mag - (axp_exp_t)workprec - 1;
+    for (axp_size_t k = 1;; k++) {
+        axp_size_t term_prec = (axp_size_t)((axp_exp_t)term.exponent + (axp_exp_t)term.size - stop) + 2;
+        if (!axp__mulf_into(ctx, &term, &y2, term_prec)) goto cleanup_error;
+        if (!axp__divf_small2_into(ctx, &term, 2 * k, 2 * k + 1, term_prec)) goto cleanup_error;
+        term.sign = !term.sign;
+        if (term.exponent + (axp_exp_t)term.size < stop) break;
+        if (!axp__addf_into(ctx, &sum, &term, workprec)) goto cleanup_error;
+    }
+    axp_freef_ex(ctx, &term);
+    axp_freef_ex(ctx, &y2);
+    axp_freef_ex(ctx, &y);
+    term = (AXP_Float){ 0 };
+    y2 = (AXP_Float){ 0 };
+    y = (AXP_Float){ 0 };
+
+    for (axp_size_t i = 0; i < s; i++) {
+        if (!axp_mulf_ex(ctx, &sum, &sum, &y2, workprec)) goto cleanup_error;
+        if (!axp__mulf_into(ctx, &y2, &four, workprec)) goto cleanup_error;
+        if (!axp_subf_ex(ctx, &three, &y2, &tmp, workprec)) goto cleanup_error;
+        if (!axp__mulf_into(ctx, &sum, &tmp, workprec)) goto cleanup_error;
+        axp_freef_ex(ctx, &y2);
+        axp_freef_ex(ctx, &tmp);
+        y2 = (AXP_Float){ 0 };
+        tmp = (AXP_Float){ 0 };
+    }
+
+    if (!axp_reallocf_round(ctx, &sum, precision)) goto cleanup_error;
+    *res = sum;
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &y);
+    axp__releasef(ctx, &y2);
+    axp__releasef(ctx, &term);
+    axp__releasef(ctx, &sum);
+    axp__releasef(ctx, &tmp);
+    return false;
+}
+
+// cos r = sqrt(1 - sin^2 r), well conditioned since cos r >= 1/sqrt(2) for |r| <= pi/4
+static bool axp__cosf_from_sin(AXP_Ctx *ctx, const AXP_Float *sin_r, AXP_Float *res, axp_size_t precision) {
+    axp_digit_t one_digit = 1;
+    const AXP_Float one = { 1, 1, &one_digit, 0, 0 };
+    AXP_Float sq = { 0 };
+    AXP_Float diff = { 0 };
+    if (!axp_mulf_ex(ctx, sin_r, sin_r, &sq, precision + 2)) return false;
+    bool ok = axp_subf_ex(ctx, &one, &sq, &diff, precision + 2);
+    axp_freef_ex(ctx, &sq);
+    if (!ok) return false;
+    ok = axp__sqrtf(ctx, &diff, res, precision);
+    axp_freef_ex(ctx, &diff);
+    return ok;
+}
+
+// atan x = 2^h atan(x_h) with x_(i+1) = x_i / (1 + sqrt(1 + x_i^2)) until |x_h| < 1/10. A halving
+// costs a division and a square root, worth more series terms than it saves beyond that point.
+// For |x| > 1, atan x = pi/2 - atan(1/x).
+static bool axp__atanf_abs(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    axp_digit_t one_digit = 1;
+    const AXP_Float one = { 1, 1, &one_digit, 0, 0 };
+    axp_size_t workprec = precision + 4;
+
+    AXP_Float a = { 0 };
+    AXP_Float a2 = { 0 };
+    AXP_Float term = { 0 };
+    AXP_Float power = { 0 };
+    AXP_Float sum = { 0 };
+    AXP_Float tmp = { 0 };
+    AXP_Float pi = { 0 };
+
+    AXP_Float x_abs = *x;
+    x_abs.sign = 0;
+    bool invert = axp__abs_cmpf_exact(&x_abs, &one) > 0;
+    if (invert) {
+        if (!axp_divf_ex(ctx, &one, &x_abs, &a, workprec)) return false;
+    } else {
+        if (!axp_copyf_ex_round(ctx, &a, &x_abs, workprec)) return false;
+    }
+
+    axp_size_t h = 0;
+    while (axp__log10_est(&a) > -1.0) {
+        if (!axp_mulf_ex(ctx, &a, &a, &a2, workprec)) goto cleanup_error;
+        if (!axp_addf_ex(ctx, &a2, &one, &tmp, workprec)) goto cleanup_error;
+        axp_freef_ex(ctx, &a2);
+        a2 = (AXP_Float){ 0 };
+        if (!axp__sqrtf(ctx, &tmp, &a2, workprec)) goto cleanup_error;
+        axp_freef_ex(ctx, &tmp);
+        tmp = (AXP_Float){ 0 };
+        if (!axp__addf_into(ctx, &a2, &one, workprec)) goto cleanup_error;
+        if (!axp_divf_ex(ctx, &a, &a2, &tmp, workprec)) goto cleanup_error;
+        axp_freef_ex(ctx, &a);
+        axp_freef_ex(ctx, &a2);
+        a = tmp;
+        a2 = (AXP_Float){ 0 };
+        tmp = (AXP_Float){ 0 };
+        h++;
+    }
+
+    // atan a = a - a^3/3 + a^5/5 - ...
+    if (!axp_mulf_ex(ctx, &a, &a, &a2, workprec)) goto cleanup_error;
+    if (!axp_copyf_exact(ctx, &power, &a)) goto cleanup_error;
+    if (!axp_copyf_exact(ctx, &sum, &a)) goto cleanup_error;
+    axp_exp_t stop = a.exponent + (axp_exp_t)a.size - (axp_exp_t)workprec - 1;
+    for (axp_size_t k = 1;; k++) {
+        axp_size_t term_prec = (axp_size_t)(power.exponent + (axp_exp_t)power.size - stop) + 2;
+        if (!axp__mulf_into(ctx, &power, &a2, term_prec)) goto cleanup_error;
+        power.sign = !power.sign;
+        if (!axp_copyf_exact(ctx, &term, &power)) goto cleanup_error;
+        if (!axp__divf_small_into(ctx, &term, 2 * k + 1, term_prec)) goto cleanup_error;
+        bool done = term.exponent + (axp_exp_t)term.size < stop;
+        if (!done && !axp__addf_into(ctx, &sum, &term, workprec)) goto cleanup_error;
+        axp_freef_ex(ctx, &term);
+        term = (AXP_Float){ 0 };
+        if (done) break;
+    }
+    axp_freef_ex(ctx, &power);
+    axp_freef_ex(ctx, &a2);
+    axp_freef_ex(ctx, &a);
+    power = (AXP_Float){ 0 };
+    a2 = (AXP_Float){ 0 };
+    a = (AXP_Float){ 0 };
+
+    for (axp_size_t left = h; left > 0;) {
+        axp_size_t chunk = left < 60 ? left : 60;
+        if (!axp__combinef(ctx, (int64_t)1 << chunk, &sum, 0, NULL, &tmp, workprec)) goto cleanup_error;
+        axp_freef_ex(ctx, &sum);
+        sum = tmp;
+        tmp = (AXP_Float){ 0 };
+        left -= chunk;
+    }
+
+    if (invert) {
+        axp_digit_t five = 5;
+        const AXP_Float half = { 1, 1, &five, 0, -1 };
+        if (!axp_pi_ex(ctx, &pi, workprec)) goto cleanup_error;
+        if (!axp__mulf_into(ctx, &pi, &half, workprec)) goto cleanup_error;
+        if (!axp_subf_ex(ctx, &pi, &sum, &tmp, workprec)) goto cleanup_error;
+        axp_freef_ex(ctx, &pi);
+        axp_freef_ex(ctx, &sum);
+        pi = (AXP_Float){ 0 };
+        sum = tmp;
+        tmp = (AXP_Float){ 0 };
+    }
+
+    if (!axp_reallocf_round(ctx, &sum, precision)) goto cleanup_error;
+    *res = sum;
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &a);
+    axp__releasef(ctx, &a2);
+    axp__releasef(ctx, &term);
+    axp__releasef(ctx, &power);
+    axp__releasef(ctx, &sum);
+    axp__releasef(ctx, &tmp);
+    axp__releasef(ctx, &pi);
+    return false;
+}
+
+typedef enum {
+    AXP__TRIG_SIN,
+    AXP__TRIG_COS,
+    AXP__TRIG_TAN,
+    AXP__TRIG_ATAN,
+} axp__TrigFn;
+
+static bool axp__trigf_attempt(AXP_Ctx *ctx, const AXP_Float *x, axp__TrigFn fn, axp_size_t precision, axp_size_t extra, AXP_Float *out, bool *ambiguous) {
+    axp_size_t guard = 1;
+    for (axp_size_t tmp = precision; tmp; tmp /= 10) guard++;
+    axp_size_t workprec = precision + guard + extra;
+
+    AXP_Float r = { 0 };
+    AXP_Float sin_r = { 0 };
+    AXP_Float cos_r = { 0 };
+    AXP_Float res = { 0 };
+
+    if (fn == AXP__TRIG_ATAN) {
+        if (!axp__atanf_abs(ctx, x, &res, workprec)) return false;
+        res.sign = x->sign;
+    } else {
+        unsigned quadrant;
+        if (!axp__trigf_reduce(ctx, x, &r, &quadrant, workprec + 2)) return false;
+        if (!axp__sinf_reduced(ctx, &r, &sin_r, workprec + 1)) goto cleanup_error;
+        axp_freef_ex(ctx, &r);
+        r = (AXP_Float){ 0 };
+
+        // sin and tan are odd, cos is even; the quadrant of |x| picks +-sin r or +-cos r
+        bool odd = quadrant % 2;
+        bool need_cos = fn == AXP__TRIG_TAN || (fn == AXP__TRIG_SIN) == odd;
+        bool need_sin = fn == AXP__TRIG_TAN || !need_cos;
+        if (need_cos && !axp__cosf_from_sin(ctx, &sin_r, &cos_r, workprec + 1)) goto cleanup_error;
+        if (fn == AXP__TRIG_TAN) {
+            if (!odd && !axp_divf_ex(ctx, &sin_r, &cos_r, &res, workprec)) goto cleanup_error;
+            if (odd && !axp_divf_ex(ctx, &cos_r, &sin_r, &res, workprec)) goto cleanup_error;
+            if (odd) res.sign = !res.sign;
+        } else if (need_sin) {
+            res = sin_r;
+            sin_r = (AXP_Float){ 0 };
+        } else {
+            res = cos_r;
+            cos_r = (AXP_Float){ 0 };
+        }
+        axp__releasef(ctx, &sin_r);
+        axp__releasef(ctx, &cos_r);
+
+        bool negate = (fn == AXP__TRIG_SIN) ? quadrant >= 2 : (fn == AXP__TRIG_COS) ? (quadrant == 1 || quadrant == 2) : false;
+        if (negate) res.sign = !res.sign;
+        if (fn != AXP__TRIG_COS && x->sign) res.sign = !res.sign;
+    }
+
+    axp_normalizef(&res);
+    if (!axp_reallocf_round(ctx, &res, workprec)) goto cleanup_error;
+    axp_size_t safety = (res.size > precision) ? (res.size - precision) : 0;
+    *ambiguous = !axp__round_is_unambiguous(res.digits, safety);
+    *out = res;
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp__releasef(ctx, &r);
+    axp__releasef(ctx, &sin_r);
+    axp__releasef(ctx, &cos_r);
+    axp__releasef(ctx, &res);
+    return false;
+}
+
+static bool axp__trigf_ex(AXP_Ctx *ctx, const AXP_Float *x, axp__TrigFn fn, AXP_Float *res, axp_size_t precision) {
+    bool x_zero;
+    if (!axp_is_zerof(ctx, x, &x_zero)) return false;
+    if (x_zero) {
+        if (!axp_initf_ex(ctx, res, precision)) return false;
+        res->digits[0] = (fn == AXP__TRIG_COS) ? 1 : 0;
+        res->size = 1;
+        return true;
+    }
+
+    axp_size_t extra = ctx->fast_rounding ? 5 : (ctx->ziv_safety_digits ? ctx->ziv_safety_digits : AXP_ZIV_DEFAULT_SAFETY_DIGITS);
+    axp_size_t max_attempts = ctx->fast_rounding ? 1 : (ctx->ziv_max_retries ? ctx->ziv_max_retries : AXP_ZIV_DEFAULT_MAX_RETRIES);
+
+    for (axp_size_t attempt = 0; attempt < max_attempts; attempt++) {
+        AXP_Float candidate = { 0 };
+        bool ambiguous = false;
+        if (!axp__trigf_attempt(ctx, x, fn, precision, extra, &candidate, &ambiguous)) return false;
+        if (ctx->fast_rounding || !ambiguous || attempt + 1 == max_attempts) {
+            *res = candidate;
+            if (!axp_reallocf_round(ctx, res, precision)) return false;
+            axp_error_reset(ctx);
+            return true;
+        }
+        axp_freef_ex(ctx, &candidate);
+        extra *= 2;
+    }
+    UNREACHABLE("axp__trigf_ex retry loop should always return");
+    return false;
+}
+
+bool axp_sinf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
+    return axp_sinf_ex(ctx, x, res, ctx->precision);
+}
+
+bool axp_sinf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    return axp__trigf_ex(ctx, x, AXP__TRIG_SIN, res, precision);
+}
+
+bool axp_cosf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
+    return axp_cosf_ex(ctx, x, res, ctx->precision);
+}
+
+bool axp_cosf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    return axp__trigf_ex(ctx, x, AXP__TRIG_COS, res, precision);
+}
+
+bool axp_tanf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
+    return axp_tanf_ex(ctx, x, res, ctx->precision);
+}
+
+bool axp_tanf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    return axp__trigf_ex(ctx, x, AXP__TRIG_TAN, res, precision);
+}
+
+bool axp_atanf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res) {
+    return axp_atanf_ex(ctx, x, res, ctx->precision);
+}
+
+bool axp_atanf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision) {
+    return axp__trigf_ex(ctx, x, AXP__TRIG_ATAN, res, precision);
+}
+
+// Writes the n little-endian digits at src most significant first: dst[i] = '0' + src[n-1-i]
+static void axp__ascii_from_digits(const axp_digit_t *src, size_t n, char *dst) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i zero32 = _mm256_set1_epi8('0');
+    const __m256i rev32 = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                           15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)(src + n - i - 32));
+        v = _mm256_shuffle_epi8(_mm256_add_epi8(v, zero32), rev32);
+        _mm256_storeu_si256((__m256i *)(void *)(dst + i), _mm256_permute2x128_si256(v, v, 1));
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i zero16 = _mm_set1_epi8('0');
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_add_epi8(_mm_loadu_si128((const __m128i *)(const void *)(src + n - i - 16)), zero16);
+        v = _mm_shuffle_epi32(v, 0x1B);
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128((__m128i *)(void *)(dst + i), v);
+    }
+#endif
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, src + n - i - 8, 8);
+        w += 0x3030303030303030ULL;
+        w = ((w & 0x00FF00FF00FF00FFULL) << 8) | ((w >> 8) & 0x00FF00FF00FF00FFULL);
+        w = ((w & 0x0000FFFF0000FFFFULL) << 16) | ((w >> 16) & 0x0000FFFF0000FFFFULL);
+        w = (w << 32) | (w >> 32);
+        memcpy(dst + i, &w, 8);
+    }
+    for (; i < n; i++) dst[i] = (char)('0' + src[n - 1 - i]);
+}
+
+// Formats an exponent like "%+lld" and returns its length (at most 20 characters)
+static size_t axp__format_exp(axp_exp_t exp, char *buf) {
+    static const char pairs[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    char tmp[20];
+    char *end = tmp + sizeof(tmp), *p = end;
+    uint64_t mag = exp < 0 ? 0 - (uint64_t)exp : (uint64_t)exp;
+
+    while (mag >= 100) {
+        uint64_t pair = (mag % 100) * 2;
+        mag /= 100;
+        *--p = pairs[pair + 1];
+        *--p = pairs[pair];
+    }
+    if (mag >= 10) {
+        *--p = pairs[mag * 2 + 1];
+        *--p = pairs[mag * 2];
+    } else {
+        *--p = (char)('0' + mag);
+    }
+    *buf = exp < 0 ? '-' : '+';
+    size_t len = (size_t)(end - p);
+    memcpy(buf + 1, p, len);
+    return len + 1;
+}
+
+static bool axp__ftoa_use_scientific(const AXP_Float *x) {
+    if (x->exponent >= 0) return x->exponent > AXP_FTOA_AUTO_PAD_THRESHOLD;
+    if (x->size + x->exponent <= 0) return llabs(x->size + x->exponent) > AXP_FTOA_AUTO_PAD_THRESHOLD;
+    return false;
+}
+
+typedef struct {
+    AXP_Ctx *ctx;
+    axp__print_writer_fn write_fn;
+    void *dest;
+    int *curr_pos;
+    size_t len;
+    bool failed;
+    char buf[AXP_WRITE_CHUNK_SIZE];
+} axp__ChunkWriter;
+
+static void axp__chunk_flush(axp__ChunkWriter *cw) {
+    if (!cw->len || cw->failed) return;
+    if (cw->write_fn(cw->ctx, cw->dest, cw->buf, cw->len, cw->curr_pos) < 0) cw->failed = true;
+    cw->len = 0;
+}
+
+static void axp__chunk_put(axp__ChunkWriter *cw, const char *txt, size_t n) {
+    while (n && !cw->failed) {
+        size_t m = AXP_WRITE_CHUNK_SIZE - cw->len < n ? AXP_WRITE_CHUNK_SIZE - cw->len : n;
+        memcpy(cw->buf + cw->len, txt, m);
+        cw->len += m;
+        txt += m;
+        n -= m;
+        if (cw->len == AXP_WRITE_CHUNK_SIZE) axp__chunk_flush(cw);
+    }
+}
+
+static void axp__chunk_zeros(axp__ChunkWriter *cw, size_t n) {
+    while (n && !cw->failed) {
+        size_t m = AXP_WRITE_CHUNK_SIZE - cw->len < n ? AXP_WRITE_CHUNK_SIZE - cw->len : n;
+        memset(cw->buf + cw->len, '0', m);
+        cw->len += m;
+        n -= m;
+        if (cw->len == AXP_WRITE_CHUNK_SIZE) axp__chunk_flush(cw);
+    }
+}
+
+// Emits the n little-endian digits at src most significant first, one chunk at a time
+static void axp__chunk_digits(axp__ChunkWriter *cw, const axp_digit_t *src, size_t n) {
+    while (n && !cw->failed) {
+        size_t m = AXP_WRITE_CHUNK_SIZE - cw->len < n ? AXP_WRITE_CHUNK_SIZE - cw->len : n;
+        axp__ascii_from_digits(src + n - m, m, cw->buf + cw->len);
+        cw->len += m;
+        n -= m;
+        if (cw->len == AXP_WRITE_CHUNK_SIZE) axp__chunk_flush(cw);
+    }
+}
+
+static int axp__itoa_emit(AXP_Ctx *ctx, const AXP_Int *x, axp__print_writer_fn write_fn, void *dest, int *curr_pos) {
+    axp__ChunkWriter cw = { .ctx = ctx, .write_fn = write_fn, .dest = dest, .curr_pos = curr_pos };
+    if (x->sign) axp__chunk_put(&cw, "-", 1);
+    axp__chunk_digits(&cw, x->digits, x->size);
+    axp__chunk_flush(&cw);
+    return cw.failed ? -1 : 0;
+}
+
+// Same layouts as `axp_ftoa_ex`, written through the chunk buffer instead of one string
+static int axp__ftoa_emit(AXP_Ctx *ctx, const AXP_Float *x, AXP_FtoaFormat format, axp__print_writer_fn write_fn, void *dest, int *curr_pos) {
+    axp__ChunkWriter cw = { .ctx = ctx, .write_fn = write_fn, .dest = dest, .curr_pos = curr_pos };
+
+    if (x->size == 0 || ((x->size == 1) && (x->digits[0] == 0))) {
+        axp__chunk_put(&cw, "0.0", 3);
+    } else if (format == AXP_FTOA_SCIENTIFIC || (format == AXP_FTOA_AUTO && axp__ftoa_use_scientific(x))) {
+        char exp_buf[24] = { 'e' };
+        size_t exp_len = axp__format_exp(x->exponent + (axp_exp_t)(x->size - 1), exp_buf + 1) + 1;
+        if (x->sign) axp__chunk_put(&cw, "-", 1);
+        axp__chunk_digits(&cw, x->digits + x->size - 1, 1);
+        axp__chunk_put(&cw, ".", 1);
+        if (x->size > 1) axp__chunk_digits(&cw, x->digits, x->size - 1);
+        else axp__chunk_put(&cw, "0", 1);
+        axp__chunk_put(&cw, exp_buf, exp_len);
+    } else if (x->exponent >= 0) {
+        if (x->sign) axp__chunk_put(&cw, "-", 1);
+        axp__chunk_digits(&cw, x->digits, x->size);
+        axp__chunk_zeros(&cw, (size_t)x->exponent);
+        axp__chunk_put(&cw, ".0", 2);
+    } else if (x->size + x->exponent <= 0) {
+        axp__chunk_put(&cw, x->sign ? "-0." : "0.", x->sign ? 3 : 2);
+        axp__chunk_zeros(&cw, (size_t)llabs(x->size + x->exponent));
+        axp__chunk_digits(&cw, x->digits, x->size);
+    } else {
+        axp_size_t decimal_index = (axp_size_t)-x->exponent;
+        if (x->sign) axp__chunk_put(&cw, "-", 1);
+        axp__chunk_digits(&cw, x->digits + decimal_index, x->size - decimal_index);
+        axp__chunk_put(&cw, ".", 1);
+        axp__chunk_digits(&cw, x->digits, decimal_index);
+    }
+    axp__chunk_flush(&cw);
+    return cw.failed ? -1 : 0;
+}
+
+size_t axp_itoa(const AXP_Int *x, char *buf, size_t buf_sz) {
+    bool should_write = !(buf == NULL || buf_sz == 0);
+    size_t needed_space = x->size ? x->size : 1;
+    if (x->sign) needed_space++;
+    if (!should_write) return needed_space;
+
+    if (x->sign) *buf++ = '-';
+    axp__ascii_from_digits(x->digits, x->size, buf);
+    buf[x->size] = '\0';
+    return needed_space;
+}
+
+char *axp_itoa_alloc(AXP_Ctx *ctx, const AXP_Int *x) {
+    size_t needed_space = axp_itoa(x, NULL, 0) + 1; // +1 for the null terminator
+    char *buf = malloc(needed_space * sizeof(char));
+    if (!buf) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_itoa_alloc`.", needed_space*sizeof(char));
+        return NULL;
+    }
+    ctx->stats.alloc_count++; // Ownership moves to the caller (released with `free`), so it is not counted as live
+    axp_itoa(x, buf, needed_space);
+    axp_error_reset(ctx);
+    return buf;
+}
+
+// Length of the run of ASCII digits at the start of s[0..n), checking a whole vector per step
+static size_t axp__digit_run(const char *s, size_t n) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i zero32 = _mm256_set1_epi8('0'), nine32 = _mm256_set1_epi8(9);
+    for (; i + 32 <= n; i += 32) {
+        __m256i t = _mm256_sub_epi8(_mm256_loadu_si256((const __m256i *)(const void *)(s + i)), zero32);
+        uint32_t bad = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(t, nine32), t));
+        if (bad) return i + (size_t)__builtin_ctz(bad);
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i zero16 = _mm_set1_epi8('0'), nine16 = _mm_set1_epi8(9);
+    for (; i + 16 <= n; i += 16) {
+        __m128i t = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(const void *)(s + i)), zero16);
+        uint32_t bad = ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(t, nine16), t)) & 0xFFFFu;
+        if (bad) return i + (size_t)__builtin_ctz(bad);
+    }
+#else
+    // Eight bytes are all digits when every high nibble is 3 both before and after adding 6
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, s + i, 8);
+        if ((w & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL) break;
+        if (((w + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL) break;
+    }
+#endif
+    while (i < n && s[i] >= '0' && s[i] <= '9') i++;
+    return i;
+}
+
+// Converts the n ASCII digits at s into little-endian digits: dst[j] = s[n-1-j] - '0'
+static void axp__digits_from_ascii(const char *s, size_t n, axp_digit_t *dst) {
+    size_t j = 0;
+#if defined(__AVX2__)
+    const __m256i zero32 = _mm256_set1_epi8('0');
+    const __m256i rev32 = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                           15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (; j + 32 <= n; j += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)(s + n - j - 32));
+        v = _mm256_shuffle_epi8(_mm256_sub_epi8(v, zero32), rev32);
+        _mm256_storeu_si256((__m256i *)(void *)(dst + j), _mm256_permute2x128_si256(v, v, 1));
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i zero16 = _mm_set1_epi8('0');
+    for (; j + 16 <= n; j += 16) {
+        __m128i v = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(const void *)(s + n - j - 16)), zero16);
+        v = _mm_shuffle_epi32(v, 0x1B);
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128((__m128i *)(void *)(dst + j), v);
+    }
+#endif
+    for (; j + 8 <= n; j += 8) {
+        uint64_t w;
+        memcpy(&w, s + n - j - 8, 8);
+        w -= 0x3030303030303030ULL;
+        w = ((w & 0x00FF00FF00FF00FFULL) << 8) | ((w >> 8) & 0x00FF00FF00FF00FFULL);
+        w = ((w & 0x0000FFFF0000FFFFULL) << 16) | ((w >> 16) & 0x0000FFFF0000FFFFULL);
+        w = (w << 32) | (w >> 32);
+        memcpy(dst + j, &w, 8);
+    }
+    for (; j < n; j++) dst[j] = (axp_digit_t)(s[n - 1 - j] - '0');
+}
+
+int axp_itoa_write(AXP_Ctx *ctx, const AXP_Int *x, axp__print_writer_fn write_fn, void *dest) {
+    int written = 0;
+    if (axp__itoa_emit(ctx, x, write_fn, dest, &written) < 0) return -1;
+    axp_error_reset(ctx);
+    return written;
+}
+
+bool axp_atoi(AXP_Ctx *ctx, const char *str, AXP_Int *x)
+{
+    if (!str || !*str) {
+        axp_throw(ctx, AXP_ERR_PARSE, "Could not parse empty string or null pointer as integer.");
+        return false;
+    }
+    uint8_t sign = 0;
+
+    while(isspace(*str)) str++;
+
+    if (*str == '-') {
+        sign = 1;
+        str++;
+    } else if (*str == '+') str++;
+
+    const char *end = str + strlen(str);
+    while (end > str && isspace(end[-1])) end--;
+
+    // Validate and count the digits first so the result is allocated exactly once
+    size_t res_sz = 0;
+    bool spaced = false;
+    for (const char *scan = str; scan < end; scan++) {
+        size_t run = axp__digit_run(scan, (size_t)(end - scan));
+        res_sz += run;
+        scan += run;
+        if (scan == end) break;
+        if (!isspace(*scan)) {
+            axp_throw(ctx, AXP_ERR_PARSE, "String parsing failed, could not parse '%c' as a digit", *scan);
+            return false;
+        }
+        spaced = true;
+    }
+
+    axp_size_t allocated = res_sz ? (axp_size_t)res_sz : 1;
+    axp_digit_t *res_digits = axp__malloc(ctx, allocated * sizeof(axp_digit_t));
+    if (!res_digits) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `atoi`.", allocated*sizeof(axp_digit_t));
+        return false;
+    }
+    res_digits[0] = 0;
+
+    // The last character is the least significant digit, so digits are filled in place from the end
+    if (!spaced) axp__digits_from_ascii(str, res_sz, res_digits);
+    else {
+        axp_size_t i = 0;
+        for (const char *scan = end; scan > str; ) {
+            const char chr = *--scan;
+            if (!isspace(chr)) res_digits[i++] = (axp_digit_t)(chr - '0');
+        }
+    }
+    x->sign = sign;
+    x->digits = res_digits;
+    x->size = (axp_size_t)res_sz;
+    x->capacity = allocated;
+    axp_error_reset(ctx);
+    return true;
+}
+
+size_t axp_ftoa_ex(const AXP_Float *x, char *buf, size_t buf_sz, AXP_FtoaFormat format) {
+    bool should_write = !(buf == NULL || buf_sz == 0);
+    size_t needed_space = 0;
+
+    if (x->size == 0 || ((x->size == 1) && (x->digits[0] == 0))) {
+        if (should_write) snprintf(buf, 4, "0.0");
+        needed_space = 3;
+        goto return_block;
+    } else if (format == AXP_FTOA_SCIENTIFIC || (format == AXP_FTOA_AUTO && axp__ftoa_use_scientific(x))) {
+        axp_exp_t top_exp = x->exponent + (axp_exp_t)(x->size - 1);
+        char exp_buf[24];
+        size_t exp_len = axp__format_exp(top_exp, exp_buf);
         size_t frac_len = (x->size > 1) ? (x->size - 1) : 1;
 
-        needed_space = frac_len + (size_t)exp_len + 3; // digit + '.' + 'e'
-        if (x->sign) needed_space++;
-        if (!should_write) return needed_space;
+        needed_space = frac_len + exp_len + 3; // digit + '.' + 'e'
+        if (x->sign) needed_space++;
+        if (!should_write) return needed_space;
+
+        if (x->sign) *buf++ = '-';
+        *buf++ = '0' + x->digits[x->size - 1];
+        *buf++ = '.';
+        if (x->size > 1) {
+            axp__ascii_from_digits(x->digits, x->size - 1, buf);
+            buf += x->size - 1;
+        } else {
+            *buf++ = '0';
+        }
+        *buf++ = 'e';
+        memcpy(buf, exp_buf, exp_len);
+        buf += exp_len;
+        *buf = '\0';
+        goto return_block;
+    } else if (x->exponent >= 0) {
+        needed_space = (size_t)x->exponent + 2; // space for .0
+        if (x->sign) needed_space++;
+        needed_space += x->size;
+        if (!should_write) return needed_space;
+        if (x->sign) *buf++ = '-';
+
+        axp__ascii_from_digits(x->digits, x->size, buf);
+        buf += x->size;
+        memset(buf, '0', (size_t)x->exponent * sizeof(char));
+        buf += x->exponent;
+        *buf++ = '.';
+        *buf++ = '0';
+        *buf = '\0';
+        goto return_block;
+
+    } else if (x->size + x->exponent <= 0) {
+        size_t leading_zeroes = (size_t)llabs(x->size + x->exponent);
+        needed_space = leading_zeroes + 2; // 0. ...
+        if (x->sign) needed_space++;
+        needed_space += x->size;
+
+        if (!should_write) return needed_space;
+        if (x->sign) *buf++ = '-';
+        *buf++ = '0';
+        *buf++ = '.';
+
+        memset(buf, '0', leading_zeroes * sizeof(char));
+        buf += leading_zeroes;
+        axp__ascii_from_digits(x->digits, x->size, buf);
+        buf += x->size;
+        *buf = '\0';
+        goto return_block;
+
+    } else {
+        needed_space = 1; // ... . ...
+        if (x->sign) needed_space++;
+        needed_space += x->size;
+
+        if (!should_write) return needed_space;
+        if(x->sign) *buf++ = '-';
+
+        axp_size_t decimal_index = (axp_size_t)-x->exponent;
+
+        axp__ascii_from_digits(x->digits + decimal_index, x->size - decimal_index, buf);
+        buf += x->size - decimal_index;
+        *buf++ = '.';
+        axp__ascii_from_digits(x->digits, decimal_index, buf);
+        buf += decimal_index;
+        *buf = '\0';
+        goto return_block;
+    }
+return_block:
+    return needed_space;
+}
+
+size_t axp_ftoa(const AXP_Float *x, char *buf, size_t buf_sz) {
+    return axp_ftoa_ex(x, buf, buf_sz, AXP_FTOA_AUTO);
+}
+
+char *axp_ftoa_alloc(AXP_Ctx *ctx, const AXP_Float *x) {
+    size_t needed_space = axp_ftoa(x, NULL, 0) + 1; // +1 for the null terminator
+    char *buf = malloc(needed_space * sizeof(char));
+    if (!buf) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_ftoa_alloc`.", needed_space*sizeof(char));
+        return NULL;
+    }
+    ctx->stats.alloc_count++; // Ownership moves to the caller (released with `free`), so it is not counted as live
+    axp_ftoa(x, buf, needed_space);
+    axp_error_reset(ctx);
+    return buf;
+}
+
+int axp_ftoa_write(AXP_Ctx *ctx, const AXP_Float *x, AXP_FtoaFormat format, axp__print_writer_fn write_fn, void *dest) {
+    int written = 0;
+    if (axp__ftoa_emit(ctx, x, format, write_fn, dest, &written) < 0) return -1;
+    axp_error_reset(ctx);
+    return written;
+}
+
+// Stores the res_sz parsed digits of x, rounding half up on the first dropped digit when round_up is set
+static void axp__atof_finish(AXP_Float *x, uint8_t sign, axp_size_t res_sz, axp_exp_t exponent, bool round_up) {
+    if (round_up) {
+        axp_size_t i = 0;
+        axp_digit_t carry = 1;
+        while (i < res_sz) {
+            axp_digit_t sum = x->digits[i] + carry;
+            x->digits[i] = sum % 10;
+            carry = sum / 10;
+            if (!carry) break;
+            i++;
+        }
+        if (carry) {
+            memset(x->digits, 0, res_sz * sizeof(axp_digit_t));
+            x->digits[0] = 1;
+            exponent += res_sz;
+            res_sz = 1;
+        }
+    }
+
+    x->sign = sign;
+    x->size = res_sz;
+    x->exponent = exponent;
+    axp_normalizef(x);
+}
 
-        if (x->sign) *buf++ = '-';
-        *buf++ = '0' + x->digits[x->size - 1];
-        *buf++ = '.';
-        if (x->size > 1) {
-            for (axp_size_t i = x->size - 1; i > 0; i--) *buf++ = '0' + x->digits[i-1];
+// Parses [str, end) into the digit buffer of x, keeping at most x->capacity digits. Nothing is allocated or freed,
+// so the digits may point into a shared slab
+static bool axp__atof_parse(AXP_Ctx *ctx, const char *str, const char *end, AXP_Float *x) {
+    axp_size_t precision = x->capacity;
+
+    while (str < end && isspace(*str)) str++;
+
+    uint8_t sign = 0;
+    if (str < end && *str == '-') {
+        sign = 1; 
+        str++; 
+    } else if (str < end && *str == '+') str++;
+
+    // One validating pass over the mantissa: `sig` is the first non-zero digit, runs of digits after it
+    // are skipped a whole vector at a time
+    const char *scan = str;
+    const char *sig = NULL;
+    const char *dot = NULL;
+    bool saw_digit = false;
+
+    int64_t sig_count = 0;
+    int64_t frac_count = 0;
+    size_t sig_spaces = 0;
+
+    while (scan < end && *scan != 'e' && *scan != 'E') {
+        const char chr = *scan;
+        if (sig && isdigit(chr)) {
+            size_t run = axp__digit_run(scan, (size_t)(end - scan));
+            sig_count += (int64_t)run;
+            if (dot) frac_count += (int64_t)run;
+            scan += run;
+            continue;
+        }
+        if (chr == '.') {
+            if (dot) {
+                axp_throw(ctx, AXP_ERR_PARSE, "Multiple decimal points in float string.");
+                return false;
+            }
+            dot = scan;
+        } else if (isdigit(chr)) {
+            saw_digit = true;
+            if (dot) frac_count++;
+            if (chr != '0') {
+                sig = scan;
+                sig_count = 1;
+            }
+        } else if (isspace(chr)) {
+            if (sig) sig_spaces++;
         } else {
-            *buf++ = '0';
+            axp_throw(ctx, AXP_ERR_PARSE, "String parsing failed, could not parse '%c' as a digit", chr);
+            return false;
         }
-        *buf++ = 'e';
-        memcpy(buf, exp_buf, (size_t)exp_len);
-        buf += exp_len;
-        *buf = '\0';
-        goto return_block;
-    } else if (x->exponent >= 0) {
-        needed_space = (size_t)x->exponent + 2; // space for .0
-        if (x->sign) needed_space++;
-        needed_space += x->size;
-        if (!should_write) return needed_space;
-        if (x->sign) *buf++ = '-';
+        scan++;
+    }
+    if (!saw_digit) {
+        axp_throw(ctx, AXP_ERR_PARSE, "No digits found in float string.");
+        return false;
+    }
+    if (sig) {
+        // Trailing whitespace does not interrupt the digits
+        for (const char *tail = scan; tail > sig && isspace(tail[-1]); tail--) sig_spaces--;
+    }
+
+    axp_exp_t str_exp = 0;
+    if (scan < end) {
+        scan++;
+        int8_t exp_sign = 1;
+        if (scan < end && *scan == '-') {
+            exp_sign = -1;
+            scan++;
+        } else if (scan < end && *scan == '+') scan++;
 
-        for (axp_size_t i = x->size; i > 0; i--) {
-            *buf++ = '0' + x->digits[i-1];
+        if (scan == end || !isdigit(*scan)) {
+            axp_throw(ctx, AXP_ERR_PARSE, "Expected exponent digits after 'e'/'E'.");
+            return false;
         }
-        memset(buf, '0', (size_t)x->exponent * sizeof(char));
-        buf += x->exponent;
-        *buf++ = '.';
-        *buf++ = '0';
-        *buf = '\0';
-        goto return_block;
+        while (scan < end && isdigit(*scan)) str_exp = str_exp * 10 + (*scan++ - '0');
+        str_exp *= exp_sign;
+    }
 
-    } else if (x->size + x->exponent <= 0) {
-        size_t leading_zeroes = (size_t)llabs(x->size + x->exponent);
-        needed_space = leading_zeroes + 2; // 0. ...
-        if (x->sign) needed_space++;
-        needed_space += x->size;
+    if (!sig) {
+        x->sign = sign;
+        x->digits[0] = 0;
+        x->size = 1;
+        x->exponent = 0;
+        return true;
+    }
 
-        if (!should_write) return needed_space;
-        if (x->sign) *buf++ = '-';
-        *buf++ = '0';
-        *buf++ = '.';
+    bool truncated = sig_count > (int64_t)precision;
+    axp_size_t res_sz = truncated ? precision : (axp_size_t)sig_count;
+    axp_digit_t first_dropped = 0;
 
-        for (size_t i = 0; i < leading_zeroes; i++) *buf++ = '0';
-        for (axp_size_t i = x->size; i > 0; i--) *buf++ = '0' + x->digits[i-1];
-        *buf = '\0';
-        goto return_block;
+    // Only the kept digits (and the first dropped one) are converted, straight into their final slots
+    if (!sig_spaces) {
+        const char *next;
+        if (dot > sig && (size_t)(dot - sig) < res_sz) {
+            size_t high = (size_t)(dot - sig);
+            axp__digits_from_ascii(sig, high, x->digits + (res_sz - high));
+            axp__digits_from_ascii(dot + 1, res_sz - high, x->digits);
+            next = dot + 1 + (res_sz - high);
+        } else {
+            axp__digits_from_ascii(sig, res_sz, x->digits);
+            next = sig + res_sz;
+            if (next == dot) next++;
+        }
+        if (truncated) first_dropped = (axp_digit_t)(*next - '0');
+    } else {
+        const char *next = sig;
+        for (axp_size_t k = 0; k < res_sz; next++) {
+            if (isdigit(*next)) x->digits[res_sz - 1 - k++] = (axp_digit_t)(*next - '0');
+        }
+        if (truncated) {
+            while (!isdigit(*next)) next++;
+            first_dropped = (axp_digit_t)(*next - '0');
+        }
+    }
+
+    axp__atof_finish(x, sign, res_sz, str_exp - frac_count + (sig_count - (int64_t)res_sz), truncated && first_dropped >= 5);
+    return true;
+}
+
+bool axp_atof(AXP_Ctx *ctx, const char *str, AXP_Float *x) {
+    if (!str || !*str) {
+        axp_throw(ctx, AXP_ERR_PARSE, "Could not parse empty string or null pointer as float.");
+        return false;
+    }
+
+    if (!axp_initf(ctx, x)) return false;
+    if (!axp__atof_parse(ctx, str, str + strlen(str), x)) {
+        axp_freef_ex(ctx, x);
+        x->digits = NULL;
+        x->size = 0;
+        x->capacity = 0;
+        return false;
+    }
+    axp_error_reset(ctx);
+    return true;
+}
+
+static size_t axp__float_array_meta_bytes(size_t count) {
+    return count * (sizeof(axp_exp_t) + sizeof(size_t) + sizeof(axp_size_t) + sizeof(uint8_t));
+}
+
+// One block for the per-value arrays (widest first so each stays aligned) and one slab for the digits
+static bool axp__float_array_alloc(AXP_Ctx *ctx, AXP_FloatArray *arr, size_t count, size_t digits_capacity) {
+    *arr = (AXP_FloatArray){ 0 };
+    if (!count) return true;
+    size_t meta_bytes = axp__float_array_meta_bytes(count);
+    uint8_t *meta = axp__malloc(ctx, meta_bytes);
+    axp_digit_t *digits = axp__malloc(ctx, digits_capacity ? digits_capacity * sizeof(axp_digit_t) : 1);
+    if (!meta || !digits) {
+        axp__free(ctx, meta, meta_bytes);
+        axp__free(ctx, digits, digits_capacity ? digits_capacity * sizeof(axp_digit_t) : 1);
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes for a float array.", meta_bytes + digits_capacity);
+        return false;
+    }
+    arr->count = count;
+    arr->exponents = (axp_exp_t *)meta;
+    arr->offsets = (size_t *)(arr->exponents + count);
+    arr->sizes = (axp_size_t *)(arr->offsets + count);
+    arr->signs = (uint8_t *)(arr->sizes + count);
+    arr->digits = digits;
+    arr->digits_capacity = digits_capacity;
+    return true;
+}
+
+void axp_float_array_free(AXP_Ctx *ctx, AXP_FloatArray *arr) {
+    if (arr->count) {
+        axp__free(ctx, arr->exponents, axp__float_array_meta_bytes(arr->count));
+        axp__free(ctx, arr->digits, arr->digits_capacity ? arr->digits_capacity * sizeof(axp_digit_t) : 1);
+    }
+    *arr = (AXP_FloatArray){ 0 };
+}
+
+
+bool axp_atof_batch(AXP_Ctx *ctx, const char *buf, size_t len, char delim, AXP_FloatArray *out) {
+    if (!buf && len) {
+        axp_throw(ctx, AXP_ERR_PARSE, "Could not parse null pointer as a batch of floats.");
+        return false;
+    }
+    axp_size_t precision = ctx->precision;
+    const char *end = buf + len;
+
+    // A value never keeps more digits than its field has characters, so the input length bounds the slab
+    size_t count = 0;
+    for (size_t i = 0; i < len; i++) count += buf[i] == delim;
+    if (len && buf[len - 1] != delim) count++;
+    size_t digits_bound = (count * precision < len) ? count * precision : len;
+
+    if (!axp__float_array_alloc(ctx, out, count, digits_bound)) return false;
+
+    size_t used = 0;
+    const char *field = buf;
+    for (size_t i = 0; i < count; i++) {
+        const char *next = memchr(field, delim, (size_t)(end - field));
+        const char *field_end = next ? next : end;
+        AXP_Float x = { 1, precision, out->digits + used, 0, 0 };
+        if (!axp__atof_parse(ctx, field, field_end, &x)) {
+            char reason[sizeof(ctx->err_str)];
+            memcpy(reason, ctx->err_str, sizeof(reason));
+            axp_throw(ctx, AXP_ERR_PARSE, "Could not parse value %zu of the batch: %s", i, reason);
+            axp_float_array_free(ctx, out);
+            return false;
+        }
+        out->offsets[i] = used;
+        out->sizes[i] = x.size;
+        out->exponents[i] = x.exponent;
+        out->signs[i] = x.sign;
+        used += x.size;
+        field = field_end + 1;
+    }
+    axp_error_reset(ctx);
+    return true;
+}
+
+static inline AXP_Float axp__float_array_get(const AXP_FloatArray *arr, size_t i) {
+    axp_size_t sz = arr->sizes[i];
+    return (AXP_Float){ sz, sz, arr->digits + arr->offsets[i], arr->signs[i], arr->exponents[i] };
+}
+
+AXP_FloatView axp_float_array_at(const AXP_FloatArray *arr, size_t i) {
+    AXP_ASSERT(i < arr->count);
+    return (AXP_FloatView){ axp__float_array_get(arr, i) };
+}
+
+static axp_size_t axp__float_array_max_size(const AXP_FloatArray *arr) {
+    axp_size_t max_sz = 1;
+    for (size_t i = 0; i < arr->count; i++) if (arr->sizes[i] > max_sz) max_sz = arr->sizes[i];
+    return max_sz;
+}
+
+// Rounds `x` half-up to `precision` digits and stores it as value i, packed right after value i - 1
+static void axp__float_array_put(AXP_FloatArray *arr, size_t i, AXP_Float *x, axp_size_t precision) {
+    axp_normalizef(x);
+    axp_roundf(x, precision);
+    axp_normalizef(x);
+    size_t offset = i ? arr->offsets[i - 1] + arr->sizes[i - 1] : 0;
+    AXP_ASSERT(offset + x->size <= arr->digits_capacity);
+    memcpy(arr->digits + offset, x->digits, x->size * sizeof(axp_digit_t));
+    arr->offsets[i] = offset;
+    arr->sizes[i] = x->size;
+    arr->exponents[i] = x->exponent;
+    arr->signs[i] = axp__is_zero_digits(x->digits, x->size) ? 0 : x->sign;
+}
 
+// x + y rounded half-up to `precision` digits into *res, whose digits live in `acc`. acc needs room for
+// x->size + y->size + precision + 5 digits. An operand lying entirely below the rounding position of the other is
+// replaced by a single digit further down, which rounds the same way and keeps the exact sum narrow
+static void axp__add_round_digits(const AXP_Float *x, const AXP_Float *y, axp_size_t precision, axp_digit_t *acc, AXP_Float *res) {
+    const AXP_Float *a = x;
+    const AXP_Float *b = y;
+    axp_size_t a_sz = a->size, b_sz = b->size;
+    while (a_sz > 1 && a->digits[a_sz - 1] == 0) a_sz--;
+    while (b_sz > 1 && b->digits[b_sz - 1] == 0) b_sz--;
+    bool a_zero = axp__is_zero_digits(a->digits, a_sz), b_zero = axp__is_zero_digits(b->digits, b_sz);
+    if (a_zero || b_zero) {
+        const AXP_Float *src = a_zero ? b : a;
+        axp_size_t src_sz = a_zero ? b_sz : a_sz;
+        memcpy(acc, src->digits, src_sz * sizeof(axp_digit_t));
+        *res = (AXP_Float){ src_sz, src_sz, acc, src->sign, src->exponent };
+        return;
+    }
+
+    axp_exp_t a_top = a->exponent + (axp_exp_t)a_sz, b_top = b->exponent + (axp_exp_t)b_sz;
+    if (b_top > a_top || (b_top == a_top && axp__abs_cmpf_digits(a, b) < 0)) {
+        const AXP_Float *tmp = a; a = b; b = tmp;
+        axp_size_t tmp_sz = a_sz; a_sz = b_sz; b_sz = tmp_sz;
+        axp_exp_t tmp_top = a_top; a_top = b_top; b_top = tmp_top;
+    }
+    axp_exp_t first_dropped = a_top - (axp_exp_t)precision - 1;
+    axp_exp_t sticky = ((a->exponent < first_dropped) ? a->exponent : first_dropped) - 3;
+    axp_digit_t one = 1;
+    AXP_Float tiny = { 1, 1, &one, b->sign, sticky };
+    if (b_top <= sticky + 1) {
+        b = &tiny;
+        b_sz = 1;
+    }
+
+    axp_exp_t low = (a->exponent < b->exponent) ? a->exponent : b->exponent;
+    axp_size_t width = (axp_size_t)(a_top - low) + 1;
+    memset(acc, 0, width * sizeof(axp_digit_t));
+    memcpy(acc + (a->exponent - low), a->digits, a_sz * sizeof(axp_digit_t));
+    axp_digit_t *dst = acc + (b->exponent - low);
+    if (a->sign == b->sign) {
+        axp_digit_t carry = 0;
+        axp_size_t i = 0;
+        for (; i < b_sz || carry; i++) {
+            axp_digit_t sum = (axp_digit_t)(dst[i] + (i < b_sz ? b->digits[i] : 0) + carry);
+            carry = sum >= 10;
+            dst[i] = carry ? (axp_digit_t)(sum - 10) : sum;
+        }
     } else {
-        needed_space = 1; // ... . ...
-        if (x->sign) needed_space++;
-        needed_space += x->size;
+        // |a| >= |b| so the borrow always stops inside a
+        axp_digit_t borrow = 0;
+        for (axp_size_t i = 0; i < b_sz || borrow; i++) {
+            int diff = dst[i] - (i < b_sz ? b->digits[i] : 0) - borrow;
+            borrow = diff < 0;
+            dst[i] = (axp_digit_t)(borrow ? diff + 10 : diff);
+        }
+    }
+    *res = (AXP_Float){ width, width, acc, a->sign, low };
+}
 
-        if (!should_write) return needed_space;
-        if(x->sign) *buf++ = '-';
+static bool axp__float_array_check(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_FloatArray *y, const char *fn_name) {
+    if (y && x->count != y->count) {
+        axp_throw(ctx, AXP_ERR_SIZE, "Arrays of %zu and %zu values passed to `%s`.", x->count, y->count, fn_name);
+        return false;
+    }
+    return true;
+}
 
-        axp_size_t decimal_index = (axp_size_t)-x->exponent;
+bool axp_float_array_init(AXP_Ctx *ctx, AXP_FloatArray *arr, const AXP_Float *values, size_t count) {
+    axp_size_t precision = ctx->precision;
+    size_t digits = 0;
+    for (size_t i = 0; i < count; i++) digits += values[i].size < precision ? values[i].size : precision;
+    if (!axp__float_array_alloc(ctx, arr, count, digits)) return false;
+    for (size_t i = 0; i < count; i++) {
+        AXP_Float x = values[i];
+        // Rounding a copy in place would write to the caller's digits, so round the leading digits directly
+        axp_size_t sz = x.size;
+        while (sz > 1 && x.digits[sz - 1] == 0) sz--;
+        size_t offset = i ? arr->offsets[i - 1] + arr->sizes[i - 1] : 0;
+        axp_size_t keep = sz < precision ? sz : precision;
+        memcpy(arr->digits + offset, x.digits + (sz - keep), keep * sizeof(axp_digit_t));
+        AXP_Float kept = { keep, keep, arr->digits + offset, x.sign, x.exponent + (axp_exp_t)(sz - keep) };
+        if (keep < sz && x.digits[sz - keep - 1] >= 5) axp__atof_finish(&kept, x.sign, keep, kept.exponent, true);
+        else axp_normalizef(&kept);
+        arr->offsets[i] = offset;
+        arr->sizes[i] = kept.size;
+        arr->exponents[i] = kept.exponent;
+        arr->signs[i] = axp__is_zero_digits(kept.digits, kept.size) ? 0 : kept.sign;
+    }
+    axp_error_reset(ctx);
+    return true;
+}
+
+bool axp_float_array_addf(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_FloatArray *y, AXP_FloatArray *res) {
+    if (!axp__float_array_check(ctx, x, y, "axp_float_array_addf")) return false;
+    axp_size_t precision = ctx->precision;
+    size_t acc_cap = (size_t)axp__float_array_max_size(x) + axp__float_array_max_size(y) + precision + 5;
+    axp_digit_t *acc = axp__malloc(ctx, acc_cap * sizeof(axp_digit_t));
+    if (!acc) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_float_array_addf`.", acc_cap);
+        return false;
+    }
+    if (!axp__float_array_alloc(ctx, res, x->count, x->count * precision)) {
+        axp__free(ctx, acc, acc_cap * sizeof(axp_digit_t));
+        return false;
+    }
+    for (size_t i = 0; i < x->count; i++) {
+        AXP_Float xi = axp__float_array_get(x, i), yi = axp__float_array_get(y, i), sum;
+        axp__add_round_digits(&xi, &yi, precision, acc, &sum);
+        axp__float_array_put(res, i, &sum, precision);
+    }
+    axp__free(ctx, acc, acc_cap * sizeof(axp_digit_t));
+    axp_error_reset(ctx);
+    return true;
+}
+
+bool axp_float_array_addf_scalar(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_Float *s, AXP_FloatArray *res) {
+    if (!s->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot use an uninitialized float in `axp_float_array_addf_scalar`.");
+        return false;
+    }
+    axp_size_t precision = ctx->precision;
+    size_t acc_cap = (size_t)axp__float_array_max_size(x) + s->size + precision + 5;
+    axp_digit_t *acc = axp__malloc(ctx, acc_cap * sizeof(axp_digit_t));
+    if (!acc) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_float_array_addf_scalar`.", acc_cap);
+        return false;
+    }
+    if (!axp__float_array_alloc(ctx, res, x->count, x->count * precision)) {
+        axp__free(ctx, acc, acc_cap * sizeof(axp_digit_t));
+        return false;
+    }
+    for (size_t i = 0; i < x->count; i++) {
+        AXP_Float xi = axp__float_array_get(x, i), sum;
+        axp__add_round_digits(&xi, s, precision, acc, &sum);
+        axp__float_array_put(res, i, &sum, precision);
+    }
+    axp__free(ctx, acc, acc_cap * sizeof(axp_digit_t));
+    axp_error_reset(ctx);
+    return true;
+}
+
+bool axp_float_array_mulf_scalar(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_Float *s, AXP_FloatArray *res) {
+    if (!s->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot use an uninitialized float in `axp_float_array_mulf_scalar`.");
+        return false;
+    }
+    axp_size_t precision = ctx->precision;
+    size_t acc_cap = (size_t)axp__float_array_max_size(x) + s->size + 1;
+    axp_digit_t *acc = axp__calloc(ctx, acc_cap, sizeof(axp_digit_t));
+    if (!acc) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_float_array_mulf_scalar`.", acc_cap);
+        return false;
+    }
+    if (!axp__float_array_alloc(ctx, res, x->count, x->count * precision)) {
+        axp__free(ctx, acc, acc_cap * sizeof(axp_digit_t));
+        return false;
+    }
+    for (size_t i = 0; i < x->count; i++) {
+        AXP_Float xi = axp__float_array_get(x, i);
+        // The exact product is rounded once, the acc slab is cleared again for the next value
+        axp_size_t sz = axp__mul_digits(xi.digits, xi.size, s->digits, s->size, acc);
+        AXP_Float prod = { sz, sz, acc, (uint8_t)(xi.sign ^ s->sign), xi.exponent + s->exponent };
+        axp__float_array_put(res, i, &prod, precision);
+        memset(acc, 0, acc_cap * sizeof(axp_digit_t));
+    }
+    axp__free(ctx, acc, acc_cap * sizeof(axp_digit_t));
+    axp_error_reset(ctx);
+    return true;
+}
+
+typedef struct {
+    axp_exp_t top;
+    size_t idx;
+} axp__SumTerm;
+
+static int axp__sum_term_cmp(const void *a, const void *b) {
+    axp_exp_t x = ((const axp__SumTerm *)a)->top, y = ((const axp__SumTerm *)b)->top;
+    return (x < y) - (x > y);
+}
+
+// Carries signed column sums so every column but the last holds a digit, the last one keeps the signed rest
+static void axp__sum_carry(int32_t *cols, size_t span) {
+    int64_t carry = 0;
+    for (size_t k = 0; k + 1 < span; k++) {
+        int64_t v = cols[k] + carry;
+        int64_t d = v % 10;
+        if (d < 0) d += 10;
+        carry = (v - d) / 10;
+        cols[k] = (int32_t)d;
+    }
+    cols[span - 1] += (int32_t)carry;
+}
+
+// acc += y exactly, ping-ponging between the two halves of *buf and growing it when the sum gets wider
+static bool axp__sum_exact_add(AXP_Ctx *ctx, axp_digit_t **buf, size_t *half, AXP_Float *acc, const AXP_Float *y) {
+    axp_exp_t top = y->exponent + (axp_exp_t)y->size, low = y->exponent;
+    if (!axp__is_zero_digits(acc->digits, acc->size)) {
+        axp_exp_t acc_top = acc->exponent + (axp_exp_t)acc->size;
+        if (acc_top > top) top = acc_top;
+        if (acc->exponent < low) low = acc->exponent;
+    }
+    size_t need = (size_t)(top - low) + 2;
+    if (need > *half) {
+        size_t grown = need > 2 * *half ? need : 2 * *half;
+        axp_digit_t *tmp = axp__malloc(ctx, 2 * grown * sizeof(axp_digit_t));
+        if (!tmp) {
+            axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_float_array_sumf`.", 2 * grown);
+            return false;
+        }
+        memcpy(tmp, acc->digits, acc->size * sizeof(axp_digit_t));
+        acc->digits = tmp;
+        axp__free(ctx, *buf, 2 * *half * sizeof(axp_digit_t));
+        *buf = tmp;
+        *half = grown;
+    }
+    // No operand lies below UINT32_MAX digits of the other, so nothing is replaced by a sticky digit
+    AXP_Float sum;
+    axp__add_round_digits(acc, y, UINT32_MAX, acc->digits == *buf ? *buf + *half : *buf, &sum);
+    axp_normalizef(&sum);
+    *acc = sum;
+    return true;
+}
+
+// Adds order[*next..count) to acc by decreasing magnitude. Stops at the first value where everything left is below
+// 10^(top + guard), which lies under both the lowest digit of acc and its rounding position: the rest can then only
+// decide which way acc rounds, and the sign of acc alone says which way the rest points
+static bool axp__sum_sorted(AXP_Ctx *ctx, const AXP_FloatArray *x, const axp__SumTerm *order, size_t count, size_t *next,
+                            axp_exp_t guard, axp_size_t precision, axp_digit_t **buf, size_t *half, AXP_Float *acc) {
+    for (; *next < count; (*next)++) {
+        axp_exp_t rest_top = order[*next].top + guard;
+        bool acc_zero = acc->size == 1 && acc->digits[0] == 0;
+        if (!acc_zero && rest_top < acc->exponent && rest_top + (axp_exp_t)precision + 4 <= acc->exponent + (axp_exp_t)acc->size) break;
+        AXP_Float xi = axp__float_array_get(x, order[*next].idx);
+        if (!axp__sum_exact_add(ctx, buf, half, acc, &xi)) return false;
+    }
+    return true;
+}
+
+bool axp_float_array_sumf(AXP_Ctx *ctx, const AXP_FloatArray *x, AXP_Float *res) {
+    // The exact sum is rounded once. It is usually accumulated column-wise in one buffer spanning every value
+    axp_size_t precision = ctx->precision;
+    axp_exp_t guard = 1;
+    for (size_t n = x->count; n >= 10; n /= 10) guard++;
+    axp_exp_t low = 0, top = 0;
+    size_t total = 0, nonzero = 0;
+    for (size_t i = 0; i < x->count; i++) {
+        AXP_Float xi = axp__float_array_get(x, i);
+        if (axp__is_zero_digits(xi.digits, xi.size)) continue;
+        axp_exp_t xi_top = xi.exponent + (axp_exp_t)xi.size;
+        if (!nonzero || xi.exponent < low) low = xi.exponent;
+        if (!nonzero || xi_top > top) top = xi_top;
+        total += xi.size;
+        nonzero++;
+    }
+
+    axp_digit_t zero = 0;
+    AXP_Float sum = { 1, 1, &zero, 0, 0 };
+    void *block = NULL;
+    size_t block_size = 0;
+    axp_digit_t *buf = NULL;
+    size_t half = 0;
+    if (nonzero && top - low <= (axp_exp_t)(total + precision) + guard + 8) {
+        // Columns take signed digits and are carried once per INT32_MAX / 10 values, which cannot overflow them
+        size_t span = (size_t)(top - low + guard) + 2;
+        block_size = span * (sizeof(int32_t) + sizeof(axp_digit_t));
+        block = axp__calloc(ctx, 1, block_size);
+        if (!block) {
+            axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_float_array_sumf`.", block_size);
+            return false;
+        }
+        int32_t *cols = block;
+        axp_digit_t *out = (axp_digit_t *)(cols + span);
+        size_t since_carry = 0;
+        for (size_t i = 0; i < x->count; i++) {
+            AXP_Float xi = axp__float_array_get(x, i);
+            if (axp__is_zero_digits(xi.digits, xi.size)) continue;
+            int32_t *col = cols + (xi.exponent - low);
+            if (xi.sign) for (axp_size_t k = 0; k < xi.size; k++) col[k] -= xi.digits[k];
+            else for (axp_size_t k = 0; k < xi.size; k++) col[k] += xi.digits[k];
+            if (++since_carry == INT32_MAX / 10) {
+                axp__sum_carry(cols, span);
+                since_carry = 0;
+            }
+        }
+        axp__sum_carry(cols, span);
+        // The top column is -1 for a negative sum, whose magnitude is then the ten's complement of the digits
+        bool negative = cols[span - 1] < 0;
+        axp_digit_t carry = negative;
+        for (size_t k = 0; k + 1 < span; k++) {
+            axp_digit_t d = (axp_digit_t)(negative ? 9 - cols[k] + carry : cols[k]);
+            carry = negative && d == 10;
+            out[k] = carry ? 0 : d;
+        }
+        sum = (AXP_Float){ (axp_size_t)(span - 1), (axp_size_t)(span - 1), out, negative, low };
+        axp_normalizef(&sum);
+    } else if (nonzero) {
+        // Values too far apart for one buffer: add them by decreasing magnitude until the rest cannot reach the
+        // rounding position, then add a single digit below it carrying the sign of the rest
+        block_size = nonzero * sizeof(axp__SumTerm);
+        axp__SumTerm *order = axp__malloc(ctx, block_size);
+        if (!order) {
+            axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_float_array_sumf`.", block_size);
+            return false;
+        }
+        block = order;
+        for (size_t i = 0, j = 0; i < x->count; i++) {
+            if (axp__is_zero_digits(x->digits + x->offsets[i], x->sizes[i])) continue;
+            order[j++] = (axp__SumTerm){ x->exponents[i] + (axp_exp_t)x->sizes[i], i };
+        }
+        qsort(order, nonzero, sizeof(axp__SumTerm), axp__sum_term_cmp);
+        size_t next = 0;
+        if (!axp__sum_sorted(ctx, x, order, nonzero, &next, guard, precision, &buf, &half, &sum)) goto cleanup_error;
+        if (next < nonzero) {
+            axp_digit_t rest_zero = 0;
+            AXP_Float rest = { 1, 1, &rest_zero, 0, 0 };
+            axp_digit_t *rest_buf = NULL;
+            size_t rest_half = 0;
+            bool ok = axp__sum_sorted(ctx, x, order, nonzero, &next, guard, precision, &rest_buf, &rest_half, &rest);
+            bool rest_nonzero = ok && !(rest.size == 1 && rest.digits[0] == 0);
+            uint8_t rest_sign = rest.sign;
+            axp__free(ctx, rest_buf, 2 * rest_half * sizeof(axp_digit_t));
+            if (!ok) goto cleanup_error;
+            if (rest_nonzero) {
+                axp_exp_t sum_top = sum.exponent + (axp_exp_t)sum.size;
+                axp_exp_t below = sum_top - (axp_exp_t)precision - 4;
+                axp_digit_t one = 1;
+                AXP_Float sticky = { 1, 1, &one, rest_sign, (sum.exponent < below ? sum.exponent : below) - 2 };
+                if (!axp__sum_exact_add(ctx, &buf, &half, &sum, &sticky)) goto cleanup_error;
+            }
+        }
+    }
+    axp_roundf(&sum, precision);
+    axp_normalizef(&sum);
+    if (!axp_initf(ctx, res)) goto cleanup_error;
+    memcpy(res->digits, sum.digits, sum.size * sizeof(axp_digit_t));
+    res->size = sum.size;
+    res->exponent = sum.exponent;
+    res->sign = axp__is_zero_digits(sum.digits, sum.size) ? 0 : sum.sign;
+    axp__free(ctx, buf, 2 * half * sizeof(axp_digit_t));
+    axp__free(ctx, block, block_size);
+    axp_error_reset(ctx);
+    return true;
+
+cleanup_error:
+    axp__free(ctx, buf, 2 * half * sizeof(axp_digit_t));
+    axp__free(ctx, block, block_size);
+    return false;
+}
+
+bool axp_float_array_minmaxf(AXP_Ctx *ctx, const AXP_FloatArray *x, size_t *min_idx, size_t *max_idx) {
+    if (!x->count) {
+        axp_throw(ctx, AXP_ERR_SIZE, "Cannot take the minimum or maximum of an empty array.");
+        return false;
+    }
+    size_t lo = 0, hi = 0;
+    AXP_Float lo_val = axp__float_array_get(x, 0), hi_val = lo_val;
+    for (size_t i = 1; i < x->count; i++) {
+        AXP_Float xi = axp__float_array_get(x, i);
+        if (axp__cmpf_digits(&xi, &lo_val) < 0) {
+            lo = i;
+            lo_val = xi;
+        } else if (axp__cmpf_digits(&xi, &hi_val) > 0) {
+            hi = i;
+            hi_val = xi;
+        }
+    }
+    if (min_idx) *min_idx = lo;
+    if (max_idx) *max_idx = hi;
+    axp_error_reset(ctx);
+    return true;
+}
+
+bool axp_float_array_cmpf(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_FloatArray *y, int8_t *res) {
+    if (!axp__float_array_check(ctx, x, y, "axp_float_array_cmpf")) return false;
+    for (size_t i = 0; i < x->count; i++) {
+        AXP_Float xi = axp__float_array_get(x, i), yi = axp__float_array_get(y, i);
+        res[i] = axp__cmpf_digits(&xi, &yi);
+    }
+    axp_error_reset(ctx);
+    return true;
+}
+
+bool axp_float_array_cmpf_scalar(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_Float *s, int8_t *res) {
+    if (!s->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot use an uninitialized float in `axp_float_array_cmpf_scalar`.");
+        return false;
+    }
+    for (size_t i = 0; i < x->count; i++) {
+        AXP_Float xi = axp__float_array_get(x, i);
+        res[i] = axp__cmpf_digits(&xi, s);
+    }
+    axp_error_reset(ctx);
+    return true;
+}
 
-        for (axp_size_t i = x->size; i > 0; i--) {
-            if (i == decimal_index) *buf++ = '.';
-            *buf++ = '0' + x->digits[i-1];
+typedef struct {
+    FILE *stream;   // Read with fread when set, otherwise with read(2) on fd
+    int fd;
+    char *buf;
+    size_t pos;
+    size_t len;
+    bool failed;
+} axp__Reader;
+
+// Refills the reader buffer, returns false at the end of input or on a read error (which also sets `failed`)
+static bool axp__reader_fill(AXP_Ctx *ctx, axp__Reader *r) {
+    r->pos = 0;
+    r->len = 0;
+    if (r->stream) {
+        r->len = fread(r->buf, 1, AXP_STREAM_CHUNK_SIZE, r->stream);
+        if (!r->len && ferror(r->stream)) {
+            axp_throw(ctx, AXP_ERR_READ, "Could not read from stream: %s", strerror(errno));
+            r->failed = true;
         }
-        *buf = '\0';
-        goto return_block;
+        return r->len > 0;
     }
-return_block:
-    return needed_space;
+    ssize_t got;
+    do got = read(r->fd, r->buf, AXP_STREAM_CHUNK_SIZE);
+    while (got < 0 && errno == EINTR);
+    if (got < 0) {
+        axp_throw(ctx, AXP_ERR_READ, "Could not read from file descriptor %d: %s", r->fd, strerror(errno));
+        r->failed = true;
+        return false;
+    }
+    r->len = (size_t)got;
+    return got > 0;
 }
 
-size_t axp_ftoa(AXP_Float *x, char *buf, size_t buf_sz) {
-    return axp_ftoa_ex(x, buf, buf_sz, AXP_FTOA_AUTO);
+static int axp__reader_getc(AXP_Ctx *ctx, axp__Reader *r) {
+    if (r->pos == r->len && !axp__reader_fill(ctx, r)) return EOF;
+    return (unsigned char)r->buf[r->pos++];
 }
 
-char *axp_ftoa_alloc(AXP_Ctx *ctx, AXP_Float *x) {
-    size_t needed_space = axp_ftoa(x, NULL, 0) + 1; // +1 for the null terminator
-    char *buf = malloc(needed_space * sizeof(char));
-    if (!buf) {
-        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_ftoa_alloc`.", needed_space*sizeof(char));
-        return NULL;
+static bool axp__reader_open(AXP_Ctx *ctx, axp__Reader *r, FILE *stream, int fd) {
+    r->stream = stream;
+    r->fd = fd;
+    r->pos = 0;
+    r->len = 0;
+    r->failed = false;
+    r->buf = axp__malloc(ctx, AXP_STREAM_CHUNK_SIZE);
+    if (!r->buf) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %d bytes for the read buffer.", AXP_STREAM_CHUNK_SIZE);
+        return false;
     }
-    axp_ftoa(x, buf, needed_space);
-    axp_error_reset(ctx);
-    return buf;
+    return true;
 }
 
-bool axp_atof(AXP_Ctx *ctx, const char *str, AXP_Float *x) {
-    if (!str || !*str) {
-        axp_throw(ctx, AXP_ERR_PARSE, "Could not parse empty string or null pointer as float.");
+static void axp__reader_close(AXP_Ctx *ctx, axp__Reader *r) {
+    axp__free(ctx, r->buf, AXP_STREAM_CHUNK_SIZE);
+    r->buf = NULL;
+}
+
+// Digits are appended in reading order to a geometrically growing array and reversed once at the end
+static bool axp__atoi_reader(AXP_Ctx *ctx, axp__Reader *r, AXP_Int *x) {
+    const axp_size_t max_sz = (axp_size_t)-1;
+    uint8_t sign = 0;
+    axp_size_t res_sz = 0;
+    axp_size_t allocated = 64;
+    axp_digit_t *res_digits = NULL;
+
+    int chr = axp__reader_getc(ctx, r);
+    while (chr != EOF && isspace(chr)) chr = axp__reader_getc(ctx, r);
+    if (chr == EOF) goto no_digits;
+    if (chr == '-' || chr == '+') sign = chr == '-';
+    else r->pos--;
+
+    res_digits = axp__malloc(ctx, allocated * sizeof(axp_digit_t));
+    if (!res_digits) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_atoi_stream`.", allocated*sizeof(axp_digit_t));
         return false;
     }
 
-    if (!axp_initf(ctx, x)) return false;
-
-    axp_size_t precision = x->capacity;
+    while (r->pos < r->len || axp__reader_fill(ctx, r)) {
+        const char *chunk = r->buf + r->pos;
+        size_t run = axp__digit_run(chunk, r->len - r->pos);
+        if (run > (size_t)(max_sz - res_sz)) {
+            axp_throw(ctx, AXP_ERR_OVERFLOW, "Integer in stream has more digits than `axp_size_t` can count.");
+            goto cleanup_error;
+        }
+        if (res_sz + run > allocated) {
+            axp_size_t grown = allocated;
+            while (grown < res_sz + run) grown = grown > max_sz / 2 ? max_sz : grown * 2;
+            axp_digit_t *tmp = axp__realloc(ctx, res_digits, allocated*sizeof(axp_digit_t), grown*sizeof(axp_digit_t));
+            if (!tmp) {
+                axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_atoi_stream`.", grown*sizeof(axp_digit_t));
+                goto cleanup_error;
+            }
+            res_digits = tmp;
+            allocated = grown;
+        }
+        for (size_t k = 0; k < run; k++) res_digits[res_sz + k] = (axp_digit_t)(chunk[k] - '0');
+        res_sz += (axp_size_t)run;
+        r->pos += run;
+        if (r->pos == r->len) continue;
 
-    while (isspace(*str)) str++;
+        chr = (unsigned char)r->buf[r->pos++];
+        if (!isspace(chr)) {
+            axp_throw(ctx, AXP_ERR_PARSE, "String parsing failed, could not parse '%c' as a digit", chr);
+            goto cleanup_error;
+        }
+    }
+    if (r->failed) goto cleanup_error;
+    if (!res_sz) goto no_digits;
 
-    uint8_t sign = 0;
-    if (*str == '-') { 
-        sign = 1; 
-        str++; 
-    } else if (*str == '+') str++;
+    for (axp_size_t i = 0; i < res_sz / 2; i++) {
+        axp_digit_t tmp = res_digits[i];
+        res_digits[i] = res_digits[res_sz - 1 - i];
+        res_digits[res_sz - 1 - i] = tmp;
+    }
+    if (allocated > res_sz) {
+        axp_digit_t *tmp = axp__realloc(ctx, res_digits, allocated*sizeof(axp_digit_t), res_sz*sizeof(axp_digit_t));
+        if (tmp) {
+            res_digits = tmp;
+            allocated = res_sz;
+        }
+    }
+    x->sign = sign;
+    x->digits = res_digits;
+    x->size = res_sz;
+    x->capacity = allocated;
+    axp_error_reset(ctx);
+    return true;
 
-    const char *scan = str;
-    const char *start = NULL;
-    bool leading = true;
-    bool truncated = false;
-    bool saw_digit = false;
+no_digits:
+    if (!r->failed) axp_throw(ctx, AXP_ERR_PARSE, "No digits found in integer stream.");
+cleanup_error:
+    if (res_digits) axp__free(ctx, res_digits, allocated*sizeof(axp_digit_t));
+    return false;
+}
 
-    int64_t digit_count = 0;
-    int64_t dot_pos = -1;
-    int64_t zeroes_after_dot = 0;
+// Only the leading `precision` significant digits are kept, the rest of the mantissa is counted and skipped
+static bool axp__atof_reader(AXP_Ctx *ctx, axp__Reader *r, AXP_Float *x) {
+    if (!axp_initf(ctx, x)) return false;
 
+    axp_size_t precision = x->capacity;
+    uint8_t sign = 0;
+    bool saw_digit = false, sig = false, dot = false, truncated = false;
+    int64_t sig_count = 0;
+    int64_t frac_count = 0;
     axp_size_t res_sz = 0;
     axp_digit_t first_dropped = 0;
 
-    while (*scan && *scan != 'e' && *scan != 'E') {
-        if (*scan == '.') {
-            if (dot_pos != -1) {
+    int chr = axp__reader_getc(ctx, r);
+    while (chr != EOF && isspace(chr)) chr = axp__reader_getc(ctx, r);
+    if (chr == '-' || chr == '+') {
+        sign = chr == '-';
+        chr = axp__reader_getc(ctx, r);
+    }
+
+    while (chr != EOF && chr != 'e' && chr != 'E') {
+        if (chr == '.') {
+            if (dot) {
                 axp_throw(ctx, AXP_ERR_PARSE, "Multiple decimal points in float string.");
                 goto cleanup_error;
             }
-            if (!start) start = scan;
-            dot_pos = digit_count;
-        } else if (!start) {
-            if (*scan == '0') { saw_digit = true; scan++; }
-            else if(isdigit(*scan)) {
-                start = scan;
-                saw_digit = true;
-                digit_count++;
-                scan++;
-            } else if (isspace(*scan)) scan++;
-            else {
-                axp_throw(ctx, AXP_ERR_PARSE, "String parsing failed, could not parse '%c' as a digit", *scan);
-                goto cleanup_error;
+            dot = true;
+        } else if (isdigit(chr)) {
+            saw_digit = true;
+            if (dot) frac_count++;
+            if (sig || chr != '0') {
+                sig = true;
+                sig_count++;
+                if (res_sz < precision) {
+                    x->digits[res_sz++] = (axp_digit_t)(chr - '0');
+                } else {
+                    if (!truncated) first_dropped = (axp_digit_t)(chr - '0');
+                    truncated = true;
+                    size_t run = axp__digit_run(r->buf + r->pos, r->len - r->pos);
+                    sig_count += (int64_t)run;
+                    if (dot) frac_count += (int64_t)run;
+                    r->pos += run;
+                }
             }
-            continue;
-        } else if (isdigit(*scan)) { saw_digit = true; digit_count++; }
-        else if (!isspace(*scan)) {
-            axp_throw(ctx, AXP_ERR_PARSE, "String parsing failed, could not parse '%c' as a digit", *scan);
+        } else if (!isspace(chr)) {
+            axp_throw(ctx, AXP_ERR_PARSE, "String parsing failed, could not parse '%c' as a digit", chr);
             goto cleanup_error;
         }
-        scan++;
+        chr = axp__reader_getc(ctx, r);
     }
+    if (r->failed) goto cleanup_error;
     if (!saw_digit) {
         axp_throw(ctx, AXP_ERR_PARSE, "No digits found in float string.");
         goto cleanup_error;
     }
-    if (dot_pos == -1) dot_pos = digit_count;
 
     axp_exp_t str_exp = 0;
-    if (*scan == 'e' || *scan == 'E') {
-        scan++;
+    if (chr == 'e' || chr == 'E') {
         int8_t exp_sign = 1;
-        if (*scan == '-') {
-            exp_sign = -1;
-            scan++;
-        } else if (*scan == '+') scan++;
-
-        if (!isdigit(*scan)) {
-            axp_throw(ctx, AXP_ERR_PARSE, "Expected exponent digits after 'e'/'E'.");
+        chr = axp__reader_getc(ctx, r);
+        if (chr == '-' || chr == '+') {
+            if (chr == '-') exp_sign = -1;
+            chr = axp__reader_getc(ctx, r);
+        }
+        if (chr == EOF || !isdigit(chr)) {
+            if (!r->failed) axp_throw(ctx, AXP_ERR_PARSE, "Expected exponent digits after 'e'/'E'.");
             goto cleanup_error;
         }
-        while (isdigit(*scan)) str_exp = str_exp * 10 + (*scan++ - '0');
-        str_exp *= exp_sign;
-    }
-
-    if (start) {
-        while (*start && *start != 'e' && *start != 'E') {
-            const char chr = *start++;
-
-            if (isspace(chr)) continue;
-            if (chr == '.')  continue;
-            if (!isdigit(chr)) {
-                axp_throw(ctx, AXP_ERR_PARSE, "String parsing failed, could not parse '%c' as a digit", chr);
-                goto cleanup_error;
-            }
-            axp_digit_t d = (axp_digit_t)(chr - '0');
-            if (leading && d == 0) {
-                zeroes_after_dot += 1;
-                continue;
-            }
-            leading = false;
-
-            if (res_sz < precision) {
-                x->digits[precision - res_sz - 1] = d;
-                res_sz++;
-            } else {
-                if (!truncated) {
-                    first_dropped = d;
-                    truncated = true;
-                }
-            }
+        while (chr != EOF && isdigit(chr)) {
+            str_exp = str_exp * 10 + (chr - '0');
+            chr = axp__reader_getc(ctx, r);
         }
+        if (r->failed) goto cleanup_error;
+        str_exp *= exp_sign;
     }
 
-    if (res_sz == 0) {
+    if (!sig) {
         x->sign = sign;
         x->digits[0] = 0;
         x->size = 1;
@@ -2189,42 +6794,493 @@ bool axp_atof(AXP_Ctx *ctx, const char *str, AXP_Float *x) {
         return true;
     }
 
-    if (res_sz < precision) memmove(x->digits, x->digits + (precision - res_sz), res_sz * sizeof(axp_digit_t));
-
-    if (truncated && first_dropped >= 5 && res_sz > 0) {
-        axp_size_t i = 0;
-        axp_digit_t carry = 1;
-        while (i < res_sz) {
-            axp_digit_t sum = x->digits[i] + carry;
-            x->digits[i] = sum % 10;
-            carry = sum / 10;
-            if (!carry) break;
-            i++;
-        }
-        if (carry) {
-            memset(x->digits, 0, precision * sizeof(axp_digit_t));
-            x->digits[0] = 1;
-            dot_pos++;
-            res_sz = 1;
-        }
+    for (axp_size_t i = 0; i < res_sz / 2; i++) {
+        axp_digit_t tmp = x->digits[i];
+        x->digits[i] = x->digits[res_sz - 1 - i];
+        x->digits[res_sz - 1 - i] = tmp;
     }
-
-    x->sign = sign;
-    x->size = res_sz;
-    x->exponent = -digit_count + dot_pos + str_exp;
-    if (truncated) x->exponent += (digit_count - res_sz) - zeroes_after_dot;
-    axp_normalizef(x);
+    axp__atof_finish(x, sign, res_sz, str_exp - frac_count + (sig_count - (int64_t)res_sz), truncated && first_dropped >= 5);
     axp_error_reset(ctx);
     return true;
 
 cleanup_error:
-    axp_freef(x);
+    axp_freef_ex(ctx, x);
     x->digits = NULL;
     x->size = 0;
     x->capacity = 0;
     return false;
 }
 
+bool axp_atoi_stream(AXP_Ctx *ctx, FILE *stream, AXP_Int *x) {
+    axp__Reader r;
+    if (!stream) {
+        axp_throw(ctx, AXP_ERR_READ, "Cannot read from null stream");
+        return false;
+    }
+    if (!axp__reader_open(ctx, &r, stream, -1)) return false;
+    bool ok = axp__atoi_reader(ctx, &r, x);
+    axp__reader_close(ctx, &r);
+    return ok;
+}
+
+bool axp_atoi_fd(AXP_Ctx *ctx, int fd, AXP_Int *x) {
+    axp__Reader r;
+    if (!axp__reader_open(ctx, &r, NULL, fd)) return false;
+    bool ok = axp__atoi_reader(ctx, &r, x);
+    axp__reader_close(ctx, &r);
+    return ok;
+}
+
+bool axp_atof_stream(AXP_Ctx *ctx, FILE *stream, AXP_Float *x) {
+    axp__Reader r;
+    if (!stream) {
+        axp_throw(ctx, AXP_ERR_READ, "Cannot read from null stream");
+        return false;
+    }
+    if (!axp__reader_open(ctx, &r, stream, -1)) return false;
+    bool ok = axp__atof_reader(ctx, &r, x);
+    axp__reader_close(ctx, &r);
+    return ok;
+}
+
+bool axp_atof_fd(AXP_Ctx *ctx, int fd, AXP_Float *x) {
+    axp__Reader r;
+    if (!axp__reader_open(ctx, &r, NULL, fd)) return false;
+    bool ok = axp__atof_reader(ctx, &r, x);
+    axp__reader_close(ctx, &r);
+    return ok;
+}
+
+// Sign of |x| - h * 2^p, exact on the digits
+static bool axp__cmp_pow2_scaled(AXP_Ctx *ctx, const AXP_Float *x, uint64_t h, int p, int8_t *res) {
+    axp_size_t e = (axp_size_t)(p < 0 ? -p : p);
+    axp_size_t pow_cap = 2 * (e * 30103 / 100000 + 2);
+    axp_digit_t h_digits[20];
+    axp_size_t h_sz = axp__u64_to_digits(h, h_digits);
+    const axp_digit_t *scaled = (p < 0) ? x->digits : h_digits;
+    axp_size_t scaled_sz = (p < 0) ? x->size : h_sz;
+    axp_size_t total = 2 * pow_cap + scaled_sz + pow_cap;
+    axp_digit_t *buf = axp__calloc(ctx, total, sizeof(axp_digit_t));
+    if (!buf) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_ftod`.", total*sizeof(axp_digit_t));
+        return false;
+    }
+    axp_digit_t two = 2;
+    axp_digit_t *prod = buf + 2 * pow_cap;
+    axp_size_t pow_sz = axp__pow_digits(&two, 1, e, buf + pow_cap, buf);
+    axp_size_t prod_sz = axp__mul_digits(scaled, scaled_sz, buf, pow_sz, prod);
+
+    AXP_Float lhs = { x->size, x->capacity, x->digits, 0, x->exponent };
+    AXP_Float rhs = { prod_sz, scaled_sz + pow_cap, prod, 0, 0 };
+    if (p < 0) {
+        lhs = (AXP_Float){ prod_sz, scaled_sz + pow_cap, prod, 0, x->exponent };
+        rhs = (AXP_Float){ h_sz, 20, h_digits, 0, 0 };
+    }
+    *res = axp__abs_cmpf_exact(&lhs, &rhs);
+    axp__free(ctx, buf, total * sizeof(axp_digit_t));
+    return true;
+}
+
+// Moves an estimate within an ulp of |x| onto the correctly rounded double, comparing |x| with the exact
+// halfway points to its neighbours (ties to even)
+static bool axp__ftod_refine(AXP_Ctx *ctx, const AXP_Float *x, double *val) {
+    uint64_t bits = axp__double_bits(*val);
+    int8_t cmp;
+    for (;;) {
+        uint64_t biased = bits >> 52;
+        if (biased == 0x7FF) {
+            // Above DBL_MAX + ulp / 2 everything rounds to infinity
+            if (!axp__cmp_pow2_scaled(ctx, x, (1ULL << 54) - 1, 970, &cmp)) return false;
+            if (cmp < 0) {
+                bits--;
+                continue;
+            }
+            break;
+        }
+        uint64_t m = bits & (AXP__DBL_C_MIN - 1);
+        int e = AXP__DBL_Q_MIN;
+        if (biased) {
+            m |= AXP__DBL_C_MIN;
+            e = (int)biased - 1075;
+        }
+        if (!axp__cmp_pow2_scaled(ctx, x, 2 * m + 1, e - 1, &cmp)) return false;
+        if (cmp > 0 || (cmp == 0 && (m & 1))) {
+            bits++;
+            if (cmp == 0) break;
+            continue;
+        }
+        if (!bits) break;
+        // The gap below a power of two is half as wide
+        bool narrow = m == AXP__DBL_C_MIN && biased > 1;
+        if (!axp__cmp_pow2_scaled(ctx, x, narrow ? 4 * m - 1 : 2 * m - 1, narrow ? e - 2 : e - 1, &cmp)) return false;
+        if (cmp < 0 || (cmp == 0 && (m & 1))) {
+            bits--;
+            if (cmp == 0) break;
+            continue;
+        }
+        break;
+    }
+    *val = axp__bits_double(bits);
+    return true;
+}
+
+bool axp_ftod(AXP_Ctx *ctx, const AXP_Float *x, double *res) {
+    if (!x->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot convert uninitialized float.");
+        return false;
+    }
+    bool exact;
+    double val = axp__ftod_estimate(x, &exact);
+    if (!exact && !axp__ftod_refine(ctx, x, &val)) return false;
+    *res = x->sign ? -val : val;
+    if (isinf(val)) {
+        axp_throw(ctx, AXP_ERR_OVERFLOW, "Float is too large to be represented as a double.");
+        return false;
+    }
+    axp_error_reset(ctx);
+    return true;
+}
+
+// Rounds the digits in `tmp` to the context precision and stores them in the freshly initialized x
+static bool axp__store_roundedf(AXP_Ctx *ctx, AXP_Float *tmp, AXP_Float *x) {
+    axp_normalizef(tmp);
+    axp_roundf(tmp, ctx->precision);
+    axp_normalizef(tmp);
+    if (!axp_initf(ctx, x)) return false;
+    memcpy(x->digits, tmp->digits, tmp->size * sizeof(axp_digit_t));
+    x->size = tmp->size;
+    x->sign = tmp->sign;
+    x->exponent = tmp->exponent;
+    return true;
+}
+
+// Exact digits of the finite, non-zero |val| = c * 2^q, as c * 2^q or as c * 5^-q * 10^q. With the trailing
+// zero bits of c dropped that is at most 16 + 751 digits, for the smallest subnormals.
+#define AXP__DOUBLE_EXACT_DIGITS 768
+
+static void axp__double_exact(double val, AXP_Float *tmp) {
+    uint64_t bits = axp__double_bits(val);
+    uint64_t c = bits & (AXP__DBL_C_MIN - 1);
+    int bq = (int)((bits >> 52) & 0x7FF);
+    int q = AXP__DBL_Q_MIN;
+    if (bq) {
+        c |= AXP__DBL_C_MIN;
+        q = bq - 1075;
+    }
+    while (!(c & 1) && q < 0) {
+        c >>= 1;
+        q++;
+    }
+    tmp->size = axp__u64_to_digits(c, tmp->digits);
+    tmp->exponent = 0;
+    for (; q >= 31; q -= 31) tmp->size = axp__mul_small_digits(tmp->digits, tmp->size, UINT32_C(1) << 31);
+    if (q > 0) tmp->size = axp__mul_small_digits(tmp->digits, tmp->size, UINT32_C(1) << q);
+    if (q < 0) {
+        tmp->exponent = q;
+        for (; q <= -13; q += 13) tmp->size = axp__mul_small_digits(tmp->digits, tmp->size, UINT32_C(1220703125));
+        uint32_t p5 = 1;
+        for (; q < 0; q++) p5 *= 5;
+        tmp->size = axp__mul_small_digits(tmp->digits, tmp->size, p5);
+    }
+}
+
+// Shortest digits hold at most 17 significant digits, below that the exact binary value is rounded instead so
+// that it is rounded only once
+bool axp_dtof(AXP_Ctx *ctx, double val, AXP_Float *x) {
+    if (!isfinite(val)) {
+        axp_throw(ctx, AXP_ERR_OVERFLOW, "Cannot represent an infinite or NaN double as a float.");
+        return false;
+    }
+    axp_digit_t digits[AXP__DOUBLE_EXACT_DIGITS] = { 0 };
+    AXP_Float tmp = { 1, AXP__DOUBLE_EXACT_DIGITS, digits, signbit(val) ? 1 : 0, 0 };
+    if (fpclassify(val) != FP_ZERO) {
+        if (ctx->precision >= 17) {
+            uint64_t f;
+            int e10;
+            axp__double_shortest(val, &f, &e10);
+            tmp.size = axp__u64_to_digits(f, digits);
+            tmp.exponent = e10;
+        } else axp__double_exact(val, &tmp);
+    }
+    return axp__store_roundedf(ctx, &tmp, x);
+}
+
+bool axp_i64tof(AXP_Ctx *ctx, int64_t val, AXP_Float *x) {
+    axp_digit_t digits[20] = { 0 };
+    uint64_t magnitude = (val < 0) ? (uint64_t)0 - (uint64_t)val : (uint64_t)val;
+    AXP_Float tmp = { axp__u64_to_digits(magnitude, digits), 20, digits, val < 0, 0 };
+    return axp__store_roundedf(ctx, &tmp, x);
+}
+
+bool axp_ftoi64(AXP_Ctx *ctx, const AXP_Float *x, int64_t *res) {
+    if (!x->digits) {
+        axp_throw(ctx, AXP_ERR_UNINITIALIZED, "Cannot convert uninitialized float.");
+        return false;
+    }
+    // Integer digits run from index `low` up; the digit below decides the rounding (ties away from zero)
+    axp_exp_t low = -x->exponent;
+    uint64_t magnitude = 0;
+    bool overflow = false;
+    for (axp_exp_t i = (axp_exp_t)x->size - 1; i >= low && !overflow; i--) {
+        axp_digit_t d = (i >= 0) ? x->digits[i] : 0;
+        overflow = magnitude > (UINT64_MAX - d) / 10;
+        magnitude = magnitude * 10 + d;
+    }
+    if (!overflow && low > 0 && low <= (axp_exp_t)x->size && x->digits[low - 1] >= 5) {
+        overflow = magnitude == UINT64_MAX;
+        magnitude++;
+    }
+    uint64_t limit = (x->sign ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX);
+    if (overflow || magnitude > limit) {
+        axp_throw(ctx, AXP_ERR_OVERFLOW, "Float does not fit into int64_t.");
+        return false;
+    }
+    *res = x->sign ? (int64_t)((uint64_t)0 - magnitude) : (int64_t)magnitude;
+    axp_error_reset(ctx);
+    return true;
+}
+
+// Binary format: 4-byte magic, version, sign, layout, a reserved byte, uint32 digit count, int64 exponent (floats
+// only), then the digits in little-endian order, either packed BCD (low nibble first) or one byte per digit.
+// Integers are little-endian.
+#define AXP__SERIAL_VERSION 1
+#define AXP__SERIAL_INT_HEADER 12
+#define AXP__SERIAL_FLOAT_HEADER 20
+
+static void axp__put_le(uint8_t *buf, uint64_t val, size_t n) {
+    for (size_t i = 0; i < n; i++) buf[i] = (uint8_t)(val >> (8 * i));
+}
+
+static uint64_t axp__get_le(const uint8_t *buf, size_t n) {
+    uint64_t val = 0;
+    for (size_t i = 0; i < n; i++) val |= (uint64_t)buf[i] << (8 * i);
+    return val;
+}
+
+static size_t axp__serial_payload(axp_size_t size, AXP_SerialLayout layout) {
+    return layout == AXP_SERIAL_UNPACKED ? size : ((size_t)size + 1) / 2;
+}
+
+static size_t axp__serialize_digits(const char *magic, size_t header_sz, uint8_t sign, const axp_digit_t *digits,
+                                    axp_size_t size, axp_exp_t exponent, uint8_t *buf, size_t buf_sz,
+                                    AXP_SerialLayout layout) {
+    size_t needed_space = header_sz + axp__serial_payload(size, layout);
+    if (!buf || buf_sz < needed_space) return needed_space;
+
+    memcpy(buf, magic, 4);
+    buf[4] = AXP__SERIAL_VERSION;
+    buf[5] = sign;
+    buf[6] = (uint8_t)layout;
+    buf[7] = 0;
+    axp__put_le(buf + 8, size, 4);
+    if (header_sz == AXP__SERIAL_FLOAT_HEADER) axp__put_le(buf + 12, (uint64_t)exponent, 8);
+
+    if (layout == AXP_SERIAL_UNPACKED) {
+        memcpy(buf + header_sz, digits, size * sizeof(axp_digit_t));
+        return needed_space;
+    }
+    uint8_t *packed = buf + header_sz;
+    axp_size_t k = 0;
+#if defined(__SSE2__)
+    const __m128i low_bytes = _mm_set1_epi16(0x00FF);
+    for (; k + 16 <= size / 2; k += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(const void *)(digits + 2*k));
+        __m128i b = _mm_loadu_si128((const __m128i *)(const void *)(digits + 2*k + 16));
+        a = _mm_or_si128(_mm_and_si128(a, low_bytes), _mm_slli_epi16(_mm_srli_epi16(a, 8), 4));
+        b = _mm_or_si128(_mm_and_si128(b, low_bytes), _mm_slli_epi16(_mm_srli_epi16(b, 8), 4));
+        _mm_storeu_si128((__m128i *)(void *)(packed + k), _mm_packus_epi16(a, b));
+    }
+#endif
+    for (; k < size / 2; k++) packed[k] = (uint8_t)(digits[2*k] | (digits[2*k + 1] << 4));
+    if (size % 2) packed[size / 2] = digits[size - 1];
+    return needed_space;
+}
+
+// Validates a header and the length of the record behind it, returns the record's size in bytes or 0
+static size_t axp__serial_check(AXP_Ctx *ctx, const char *magic, size_t header_sz, const uint8_t *buf, size_t buf_sz,
+                                axp_size_t *size) {
+    if (!buf || buf_sz < header_sz || memcmp(buf, magic, 4) != 0) {
+        axp_throw(ctx, AXP_ERR_PARSE, "Buffer does not hold a serialized %s.", magic[3] == 'I' ? "AXP_Int" : "AXP_Float");
+        return 0;
+    }
+    if (buf[4] != AXP__SERIAL_VERSION) {
+        axp_throw(ctx, AXP_ERR_PARSE, "Unsupported serialization version %d.", buf[4]);
+        return 0;
+    }
+    *size = (axp_size_t)axp__get_le(buf + 8, 4);
+    if (*size == 0 || buf[5] > 1 || buf[6] > AXP_SERIAL_UNPACKED
+        || (buf_sz - header_sz) < axp__serial_payload(*size, (AXP_SerialLayout)buf[6])) {
+        axp_throw(ctx, AXP_ERR_PARSE, "Serialized number is truncated or malformed.");
+        return 0;
+    }
+    return header_sz + axp__serial_payload(*size, (AXP_SerialLayout)buf[6]);
+}
+
+// Checks the header and copies or unpacks the digits into a freshly allocated array of exactly `size` digits
+static axp_digit_t *axp__deserialize_digits(AXP_Ctx *ctx, const char *magic, size_t header_sz, const uint8_t *buf,
+                                            size_t buf_sz, axp_size_t *size) {
+    if (!axp__serial_check(ctx, magic, header_sz, buf, buf_sz, size)) return NULL;
+
+    axp_digit_t *digits = axp__malloc(ctx, *size * sizeof(axp_digit_t));
+    if (!digits) {
+        axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp_deserialize`.", *size*sizeof(axp_digit_t));
+        return NULL;
+    }
+    if (buf[6] == AXP_SERIAL_UNPACKED) {
+        axp_digit_t top = 0;
+        memcpy(digits, buf + header_sz, *size * sizeof(axp_digit_t));
+        for (axp_size_t k = 0; k < *size; k++) top = digits[k] > top ? digits[k] : top;
+        if (top > 9) {
+            axp__free(ctx, digits, *size * sizeof(axp_digit_t));
+            axp_throw(ctx, AXP_ERR_PARSE, "Serialized number holds a byte that is not a decimal digit.");
+            return NULL;
+        }
+        return digits;
+    }
+    const uint8_t *packed = buf + header_sz;
+    uint8_t bad = 0;
+    axp_size_t k = 0;
+#if defined(__SSE2__)
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i top = _mm_setzero_si128();
+    for (; k + 16 <= *size / 2; k += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(packed + k));
+        __m128i lo = _mm_and_si128(v, nibble), hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+        top = _mm_max_epu8(top, _mm_max_epu8(lo, hi));
+        _mm_storeu_si128((__m128i *)(void *)(digits + 2*k), _mm_unpacklo_epi8(lo, hi));
+        _mm_storeu_si128((__m128i *)(void *)(digits + 2*k + 16), _mm_unpackhi_epi8(lo, hi));
+    }
+    bad = (uint8_t)(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(top, _mm_set1_epi8(9)), top)) != 0xFFFF);
+#endif
+    for (; k < *size / 2; k++) {
+        uint8_t lo = packed[k] & 0x0F, hi = packed[k] >> 4;
+        bad |= (uint8_t)((lo > 9) | (hi > 9));
+        digits[2*k] = lo;
+        digits[2*k + 1] = hi;
+    }
+    if (*size % 2) {
+        digits[*size - 1] = packed[*size / 2] & 0x0F;
+        bad |= (uint8_t)((packed[*size / 2] & 0x0F) > 9 || (packed[*size / 2] >> 4) != 0);
+    }
+    if (bad) {
+        axp__free(ctx, digits, *size * sizeof(axp_digit_t));
+        axp_throw(ctx, AXP_ERR_PARSE, "Serialized number holds a nibble that is not a decimal digit.");
+        return NULL;
+    }
+    return digits;
+}
+
+size_t axp_serializei(const AXP_Int *x, uint8_t *buf, size_t buf_sz) {
+    return axp_serializei_ex(x, buf, buf_sz, AXP_SERIAL_PACKED);
+}
+
+size_t axp_serializei_ex(const AXP_Int *x, uint8_t *buf, size_t buf_sz, AXP_SerialLayout layout) {
+    return axp__serialize_digits("AXPI", AXP__SERIAL_INT_HEADER, x->sign, x->digits, x->size, 0, buf, buf_sz, layout);
+}
+
+size_t axp_serializef(const AXP_Float *x, uint8_t *buf, size_t buf_sz) {
+    return axp_serializef_ex(x, buf, buf_sz, AXP_SERIAL_PACKED);
+}
+
+size_t axp_serializef_ex(const AXP_Float *x, uint8_t *buf, size_t buf_sz, AXP_SerialLayout layout) {
+    return axp__serialize_digits("AXPF", AXP__SERIAL_FLOAT_HEADER, x->sign, x->digits, x->size, x->exponent, buf, buf_sz, layout);
+}
+
+bool axp_deserializei(AXP_Ctx *ctx, const uint8_t *buf, size_t buf_sz, AXP_Int *x) {
+    axp_size_t size;
+    axp_digit_t *digits = axp__deserialize_digits(ctx, "AXPI", AXP__SERIAL_INT_HEADER, buf, buf_sz, &size);
+    if (!digits) return false;
+    x->sign = buf[5];
+    x->digits = digits;
+    x->size = size;
+    x->capacity = size;
+    axp_error_reset(ctx);
+    return true;
+}
+
+bool axp_deserializef(AXP_Ctx *ctx, const uint8_t *buf, size_t buf_sz, AXP_Float *x) {
+    axp_size_t size;
+    axp_digit_t *digits = axp__deserialize_digits(ctx, "AXPF", AXP__SERIAL_FLOAT_HEADER, buf, buf_sz, &size);
+    if (!digits) return false;
+    x->sign = buf[5];
+    x->digits = digits;
+    x->size = size;
+    x->capacity = size;
+    x->exponent = (axp_exp_t)axp__get_le(buf + 12, 8);
+    axp_error_reset(ctx);
+    return true;
+}
+
+// Views borrow the digits of an unpacked record; they are not validated so opening one never touches the payload
+size_t axp_viewi(AXP_Ctx *ctx, const void *data, size_t data_sz, AXP_IntView *view) {
+    const uint8_t *buf = data;
+    axp_size_t size;
+    size_t record_sz = axp__serial_check(ctx, "AXPI", AXP__SERIAL_INT_HEADER, buf, data_sz, &size);
+    if (!record_sz) return 0;
+    if (buf[6] != AXP_SERIAL_UNPACKED) {
+        axp_throw(ctx, AXP_ERR_PARSE, "Only numbers serialized with AXP_SERIAL_UNPACKED can be viewed in place.");
+        return 0;
+    }
+    view->value.sign = buf[5];
+    view->value.digits = (axp_digit_t *)(uintptr_t)(buf + AXP__SERIAL_INT_HEADER);
+    view->value.size = size;
+    view->value.capacity = size;
+    axp_error_reset(ctx);
+    return record_sz;
+}
+
+size_t axp_viewf(AXP_Ctx *ctx, const void *data, size_t data_sz, AXP_FloatView *view) {
+    const uint8_t *buf = data;
+    axp_size_t size;
+    size_t record_sz = axp__serial_check(ctx, "AXPF", AXP__SERIAL_FLOAT_HEADER, buf, data_sz, &size);
+    if (!record_sz) return 0;
+    if (buf[6] != AXP_SERIAL_UNPACKED) {
+        axp_throw(ctx, AXP_ERR_PARSE, "Only numbers serialized with AXP_SERIAL_UNPACKED can be viewed in place.");
+        return 0;
+    }
+    view->value.sign = buf[5];
+    view->value.digits = (axp_digit_t *)(uintptr_t)(buf + AXP__SERIAL_FLOAT_HEADER);
+    view->value.size = size;
+    view->value.capacity = size;
+    view->value.exponent = (axp_exp_t)axp__get_le(buf + 12, 8);
+    axp_error_reset(ctx);
+    return record_sz;
+}
+
+bool axp_map_file(AXP_Ctx *ctx, const char *path, AXP_Mapping *map) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        axp_throw(ctx, AXP_ERR_READ, "Could not open '%s': %s", path, strerror(errno));
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        axp_throw(ctx, AXP_ERR_READ, "Could not stat '%s': %s", path, strerror(errno));
+        close(fd);
+        return false;
+    }
+    map->size = (size_t)st.st_size;
+    map->data = NULL;
+    if (map->size) {
+        void *mem = mmap(NULL, map->size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mem == MAP_FAILED) {
+            axp_throw(ctx, AXP_ERR_READ, "Could not map '%s': %s", path, strerror(errno));
+            close(fd);
+            return false;
+        }
+        map->data = mem;
+    }
+    close(fd); // The mapping keeps the file referenced
+    axp_error_reset(ctx);
+    return true;
+}
+
+void axp_unmap_file(AXP_Mapping *map) {
+    if (map->data) munmap((void *)(uintptr_t)map->data, map->size);
+    map->data = NULL;
+    map->size = 0;
+}
+
 void axp_throw(AXP_Ctx *ctx, AXP_ErrorCode err_code, const char *fmt, ...) {
     ctx->err = err_code;
     va_list args;
@@ -2243,6 +7299,8 @@ static const char *axp_error_messages[] = {
     [AXP_ERR_UNINITIALIZED] = "Uninitialized number error",
     [AXP_ERR_FORMAT] = "Format error",
     [AXP_ERR_WRITE] = "Writing error",
+    [AXP_ERR_READ] = "Reading error",
+    [AXP_ERR_SIZE] = "Size mismatch",
 };
 
 const char *axp_strerror(const AXP_Ctx *ctx)
@@ -2288,7 +7346,7 @@ int axp__printf_core(AXP_Ctx *ctx, axp__print_target *target, const char *fmt, v
             );                                                                                              \
             return -1;                                                                                      \
         }                                                                                                   \
-        char *_tmp_buf = malloc((size_t)(_needed_buf_len + 1) * sizeof(char));                              \
+        char *_tmp_buf = axp__malloc(ctx, (size_t)(_needed_buf_len + 1) * sizeof(char));                    \
         if (!_tmp_buf) {                                                                                    \
             axp_throw(ctx, AXP_ERR_ALLOC,                                                                   \
                            "Memory allocation failed, could not allocate %lu bytes in `axp__printf_core`.", \
@@ -2298,7 +7356,7 @@ int axp__printf_core(AXP_Ctx *ctx, axp__print_target *target, const char *fmt, v
         int _actually_written = snprintf(_tmp_buf, (size_t)_needed_buf_len + 1, spec_fmt_str, __VA_ARGS__); \
         AXP_ASSERT(_actually_written == _needed_buf_len);                                                   \
         _WRITE_STR(_tmp_buf, _needed_buf_len);                                                              \
-        free(_tmp_buf);                                                                                     \
+        axp__free(ctx, _tmp_buf, (size_t)(_needed_buf_len + 1) * sizeof(char));                             \
         if (write_failed) return -1;                                                                        \
     } while (0)
 
@@ -2341,30 +7399,12 @@ int axp__printf_core(AXP_Ctx *ctx, axp__print_target *target, const char *fmt, v
 
         if (*chr == 'Z') {
             AXP_Int arg = va_arg(*args, AXP_Int);
-            size_t needed_space = axp_itoa(&arg, NULL, 0);
-            char *tmp_buf = malloc((needed_space + 1) * sizeof(char));
-            if (!tmp_buf) {
-                axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp__printf_core`.", (needed_space+1)*sizeof(char));
-                return -1;
-            }
-            axp_itoa(&arg, tmp_buf, needed_space + 1);
-            _WRITE_STR(tmp_buf, needed_space);
-            free(tmp_buf);
-            if (write_failed) return -1;
+            if (axp__itoa_emit(ctx, &arg, target->write_fn, &target->as, &out_pos) < 0) return -1;
             chr++;
             continue;
         } else if (*chr == 'R') {
             AXP_Float arg = va_arg(*args, AXP_Float);
-            size_t needed_space = axp_ftoa(&arg, NULL, 0);
-            char *tmp_buf = malloc((needed_space + 1) * sizeof(char));
-            if (!tmp_buf) {
-                axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp__printf_core`.", (needed_space+1)*sizeof(char));
-                return -1;
-            }
-            axp_ftoa(&arg, tmp_buf, needed_space + 1);
-            _WRITE_STR(tmp_buf, needed_space);
-            free(tmp_buf);
-            if (write_failed) return -1;
+            if (axp__ftoa_emit(ctx, &arg, AXP_FTOA_AUTO, target->write_fn, &target->as, &out_pos) < 0) return -1;
             chr++;
             continue;
         }
@@ -2373,7 +7413,7 @@ int axp__printf_core(AXP_Ctx *ctx, axp__print_target *target, const char *fmt, v
         int star_width = 0;
 
         int has_star_prec = 0;
-        int star_prec;
+        int star_prec = 0;
 
         while (*chr == '-' || *chr == '+' || *chr == ' ' || *chr == '#' || *chr == '0') chr++;
         
@@ -2413,7 +7453,11 @@ int axp__printf_core(AXP_Ctx *ctx, axp__print_target *target, const char *fmt, v
         char spec = *chr++;
 
         size_t spec_len = (size_t)(chr - fmt_start);
-        char *spec_fmt_str = malloc((spec_len + 1) * sizeof(char));
+        char *spec_fmt_str = axp__malloc(ctx, (spec_len + 1) * sizeof(char));
+        if (!spec_fmt_str) {
+            axp_throw(ctx, AXP_ERR_ALLOC, "Memory allocation failed, could not allocate %lu bytes in `axp__printf_core`.", (spec_len+1)*sizeof(char));
+            return -1;
+        }
         memcpy(spec_fmt_str, fmt_start, (spec_len + 1) * sizeof(char));
         spec_fmt_str[spec_len] = '\0';
 
@@ -2487,8 +7531,10 @@ int axp__printf_core(AXP_Ctx *ctx, axp__print_target *target, const char *fmt, v
             break;
         default:
             axp_throw(ctx, AXP_ERR_FORMAT, "Unknown specifier: %%%c.", spec);
+            axp__free(ctx, spec_fmt_str, (spec_len + 1) * sizeof(char));
             return -1;
         }
+        axp__free(ctx, spec_fmt_str, (spec_len + 1) * sizeof(char));
     }
 
     #undef _WRITE_STR
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #if defined(__GNUC__) || defined(__clang__)
 #define PRINTF_LIKE_WARNINGS(string_idx, arguments_idx_start) __attribute__((format(printf, string_idx, arguments_idx_start)))
@@ -24,10 +25,29 @@
 #define AXP_ZIV_DEFAULT_SAFETY_DIGITS 8
 #define AXP_ZIV_DEFAULT_MAX_RETRIES 8
 
+#define AXP_LN_AGM_DEFAULT_THRESHOLD 1000
+
+// Operand lengths (in digits, then in 8-digit limbs) from which multiplication packs limbs and uses Karatsuba.
+// Packing pays for itself from about 6 digits (16 x 16 digits: 0.6 us per digit, 0.14 us per limb), Karatsuba
+// is even with the limb schoolbook around 32-48 limbs and ahead by half from 256 limbs (90 us against 175 us).
+#define AXP_MUL_LIMB_THRESHOLD 12
+#define AXP_MUL_KARATSUBA_LIMBS 24
+
+// Bytes read per chunk by the streaming parsers
+#define AXP_STREAM_CHUNK_SIZE 65536
+// Characters buffered per call of the writer callback by `axp_itoa_write` / `axp_ftoa_write`
+#define AXP_WRITE_CHUNK_SIZE 4096
+
+// Largest denominator q for which `axp_powff` evaluates x^(p/q) as a q-th root instead of exp(y ln x)
+#define AXP_POWFF_MAX_ROOT 1000
+
 typedef uint8_t axp_digit_t;
 typedef uint32_t axp_size_t;
 typedef int64_t axp_exp_t;
 
+#define AXP_EXP_MAX INT64_MAX
+#define AXP_EXP_MIN INT64_MIN
+
 typedef enum {
     AXP_OK = 0,
     AXP_ERR_ALLOC,
@@ -38,18 +58,10 @@ typedef enum {
     AXP_ERR_UNINITIALIZED,
     AXP_ERR_FORMAT,
     AXP_ERR_WRITE,
+    AXP_ERR_READ,
+    AXP_ERR_SIZE,
 } AXP_ErrorCode;
 
-typedef struct {
-    axp_size_t precision;
-    AXP_ErrorCode err;
-    char err_str[1024];
-    
-    bool fast_rounding;
-    axp_size_t ziv_safety_digits;
-    axp_size_t ziv_max_retries;
-} AXP_Ctx;
-
 typedef struct {
     axp_size_t size;
     axp_size_t capacity;
@@ -65,6 +77,84 @@ typedef struct {
     axp_exp_t exponent;
 } AXP_Float; // Number is represented as value = digits * 10^exp note that digits is an integer not a float so 1.23 would be represented as 123 * 10^-2
 
+// Read-only numbers borrowing their digits from a serialized buffer, see `axp_viewi` / `axp_viewf`
+typedef struct {
+    AXP_Int value;
+} AXP_IntView;
+
+typedef struct {
+    AXP_Float value;
+} AXP_FloatView;
+
+typedef struct {
+    const void *data;
+    size_t size;
+} AXP_Mapping;
+
+// Column of floats stored as parallel arrays: value i has sizes[i] digits at digits + offsets[i] (least significant
+// first), exponents[i] and signs[i]. The per-value arrays share one allocation and every digit lives in one slab.
+typedef struct {
+    size_t count;
+    size_t *offsets;
+    axp_size_t *sizes;
+    axp_exp_t *exponents;
+    uint8_t *signs;
+    axp_digit_t *digits;
+    size_t digits_capacity; // Digits the slab has room for
+} AXP_FloatArray;
+
+// Binary splitting state of a hypergeometric-type series
+//   S = sum_{k=0}^{terms-1} a(k)/b(k) * prod_{j=0}^{k} p(j)/q(j)
+// over the first `terms` terms, where S = T / (B*Q). A zero initialized `AXP_Series` is an empty sum.
+typedef struct {
+    AXP_Int p;
+    AXP_Int q;
+    AXP_Int b;
+    AXP_Int t;
+    axp_size_t terms;
+} AXP_Series;
+
+typedef enum {
+    AXP_CONST_E,
+    AXP_CONST_LN2,
+    AXP_CONST_LN10,
+    AXP_CONST_PI,
+    AXP_CONST_COUNT,
+} AXP_Constant;
+
+typedef struct {
+    AXP_Series series[2]; // Binary splitting state of the series the constant is assembled from
+    AXP_Float value;      // Most precise value computed so far
+    axp_size_t precision; // Correct digits held by `value`, 0 if nothing has been computed yet
+} AXP_ConstCacheEntry;
+
+typedef struct {
+    size_t bytes_live;    // Bytes currently held by digit buffers and scratch allocations
+    size_t bytes_peak;    // High-water mark of `bytes_live` since the last reset
+    size_t alloc_count;   // Number of fresh allocations
+    size_t realloc_count; // Number of reallocations
+    size_t free_count;    // Number of buffers released
+    size_t bytes_freed;   // Bytes released by those frees
+} AXP_CtxStats;
+
+typedef struct {
+    axp_size_t precision;
+    AXP_ErrorCode err;
+    char err_str[1024];
+    
+    bool fast_rounding;
+    axp_size_t ziv_safety_digits;
+    axp_size_t ziv_max_retries;
+    axp_size_t ln_agm_threshold; // Working digits from which ln uses the AGM instead of Newton on exp, 0 selects the default
+
+    AXP_CtxStats stats;
+    AXP_ConstCacheEntry constants[AXP_CONST_COUNT]; // Freed by `axp_const_cache_free`
+} AXP_Ctx;
+
+// Initializes `p`, `q`, `a` and `b` with the factors of term `k`.
+// On failure nothing may be left allocated and ctx->err must be set.
+typedef bool (*axp_series_term_fn)(AXP_Ctx *ctx, void *user, axp_size_t k, AXP_Int *p, AXP_Int *q, AXP_Int *a, AXP_Int *b);
+
 #define AXP_FTOA_AUTO_PAD_THRESHOLD 6
 
 typedef enum {
@@ -73,6 +163,11 @@ typedef enum {
     AXP_FTOA_AUTO,
 } AXP_FtoaFormat;
 
+typedef enum {
+    AXP_SERIAL_PACKED,      // Two digits per byte, the compact form for storage
+    AXP_SERIAL_UNPACKED,    // One digit per byte, the in-memory layout that `axp_viewi` / `axp_viewf` can borrow
+} AXP_SerialLayout;
+
 typedef int (*axp__print_writer_fn)(AXP_Ctx *, void *, const char *, size_t, int *);
 
 typedef enum {
@@ -96,6 +191,7 @@ typedef struct {
 
 /* -- ALLOCATION FUNCTIONS -- */
 bool axp_initi(AXP_Ctx *ctx, AXP_Int *x, axp_size_t initial_capacity);
+bool axp_initi_i64(AXP_Ctx *ctx, AXP_Int *x, int64_t value);
 bool axp_initf(AXP_Ctx *ctx, AXP_Float *x);
 bool axp_initf_ex(AXP_Ctx *ctx, AXP_Float *x, axp_size_t precision);
 
@@ -105,6 +201,15 @@ bool axp_reallocf_round(AXP_Ctx *ctx, AXP_Float *x, axp_size_t size);
 
 void axp_freei(AXP_Int *x);
 void axp_freef(AXP_Float *x);
+// Same as `axp_freei`/`axp_freef` but also records the free in the statistics of `ctx`, which the plain variants
+// cannot reach. Numbers should be freed with the context they were allocated with for the statistics to balance.
+void axp_freei_ex(AXP_Ctx *ctx, AXP_Int *x);
+void axp_freef_ex(AXP_Ctx *ctx, AXP_Float *x);
+
+/* -- MEMORY STATISTICS -- */
+void axp_ctx_stats_get(const AXP_Ctx *ctx, AXP_CtxStats *stats);
+// Resets the counters and the high-water mark, `bytes_live` is kept since those bytes are still allocated.
+void axp_ctx_stats_reset(AXP_Ctx *ctx);
 
 /* -- COPY FUNCTIONS -- */
 
@@ -139,6 +244,10 @@ bool axp_copyf_exact(AXP_Ctx *ctx, AXP_Float *restrict dst, const AXP_Float *res
 // Compares the absolute value of two `Cxp_Int`
 // Sets res to: `1` if `x > y`, `0`if `x == y` and `-1` if `x < y`
 bool axp_abs_cmpi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, int8_t *res);
+bool axp_abs_cmpf(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, int8_t *res);
+// Signed comparisons, with the same result convention (-0 compares equal to 0)
+bool axp_cmpi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, int8_t *res);
+bool axp_cmpf(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, int8_t *res);
 bool axp_is_zeroi(AXP_Ctx *ctx, const AXP_Int *x, bool *res);
 
 void axp_normalizef(AXP_Float *x);
@@ -181,35 +290,150 @@ bool axp_divi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *res, AX
 bool axp_divf(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float *res);
 bool axp_divf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *y, AXP_Float *res, axp_size_t precision);
 
-axp_size_t axp__pow_digits(axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp_digit_t *tmp_buf, axp_digit_t *res);
-axp_size_t axp__pow_digits_float(axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp_digit_t *tmp_buf, axp_digit_t *res, axp_size_t res_cap, axp_exp_t *exp_adj);
+axp_size_t axp__pow_digits(const axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp_digit_t *tmp_buf, axp_digit_t *res);
+bool axp__pow_digits_float(AXP_Ctx *ctx, const axp_digit_t *x_digits, axp_size_t x_sz, axp_size_t y, axp_digit_t *tmp_buf, axp_digit_t *res, axp_size_t res_cap, axp_size_t *res_sz, axp_exp_t *exp_adj);
 bool axp_powi(AXP_Ctx *ctx, AXP_Int *x, axp_size_t y, AXP_Int *res);
+// Largest integer whose square does not exceed x, x >= 0
+bool axp_isqrti(AXP_Ctx *ctx, const AXP_Int *x, AXP_Int *res);
+// Least non-negative residue of x modulo |m|
+bool axp_modi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *m, AXP_Int *res);
+// base^exp mod |mod| for exp >= 0, without building base^exp
+bool axp_powmodi(AXP_Ctx *ctx, const AXP_Int *base, const AXP_Int *exp, const AXP_Int *mod, AXP_Int *res);
+// Non-negative gcd and lcm, gcd(0, 0) = 0
+bool axp_gcdi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *res);
+bool axp_lcmi(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *res);
+// g = gcd(x, y) = s*x + t*y
+bool axp_gcdexti(AXP_Ctx *ctx, const AXP_Int *x, const AXP_Int *y, AXP_Int *g, AXP_Int *s, AXP_Int *t);
+bool axp_factoriali(AXP_Ctx *ctx, axp_size_t n, AXP_Int *res);
+bool axp_binomiali(AXP_Ctx *ctx, axp_size_t n, axp_size_t k, AXP_Int *res);
+// Product of the primes <= n
+bool axp_primoriali(AXP_Ctx *ctx, axp_size_t n, AXP_Int *res);
+// x * (x + 1) * ... * (x + n - 1)
+bool axp_rising_factoriali(AXP_Ctx *ctx, const AXP_Int *x, axp_size_t n, AXP_Int *res);
 bool axp_powf(AXP_Ctx *ctx, AXP_Float *x, axp_exp_t y, AXP_Float *res);
 bool axp_powf_ex(AXP_Ctx *ctx, AXP_Float *x, axp_exp_t y, AXP_Float *res, axp_size_t precision);
 
+// Extends `series` to its first `terms` terms, only the missing terms are evaluated and merged into the existing state.
+bool axp_series_extend(AXP_Ctx *ctx, AXP_Series *series, axp_series_term_fn term, void *user, axp_size_t terms);
+// Evaluates T / (B*Q) of the current state to `precision` digits.
+bool axp_series_sumf(AXP_Ctx *ctx, const AXP_Series *series, AXP_Float *res, axp_size_t precision);
+void axp_series_free(AXP_Ctx *ctx, AXP_Series *series);
+
+// Copies `constant` rounded to `precision` digits into `res`. Values are cached on the context and only
+// recomputed (incrementally) when more digits than the cache holds are requested.
+bool axp_constf_ex(AXP_Ctx *ctx, AXP_Constant constant, AXP_Float *res, axp_size_t precision);
+void axp_const_cache_free(AXP_Ctx *ctx);
+
 bool axp_e(AXP_Ctx *ctx, AXP_Float *res);
 bool axp_e_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision);
+bool axp_ln2(AXP_Ctx *ctx, AXP_Float *res);
+bool axp_ln2_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision);
+bool axp_ln10(AXP_Ctx *ctx, AXP_Float *res);
+bool axp_ln10_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision);
+bool axp_pi(AXP_Ctx *ctx, AXP_Float *res);
+bool axp_pi_ex(AXP_Ctx *ctx, AXP_Float *res, axp_size_t precision);
 
 bool axp_expf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
 bool axp_expf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
 bool axp_expf_no_splitting(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
 
+bool axp_sqrtf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
+bool axp_sqrtf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+bool axp_rsqrtf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
+bool axp_rsqrtf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+// n-th root of x, negative x is allowed for odd n
+bool axp_rootf(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t n, AXP_Float *res);
+bool axp_rootf_ex(AXP_Ctx *ctx, const AXP_Float *x, axp_size_t n, AXP_Float *res, axp_size_t precision);
+
 bool axp_lnf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
 bool axp_lnf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+bool axp_log10f(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
+bool axp_log10f_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+bool axp_log2f(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
+bool axp_log2f_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+bool axp_logbf(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *b, AXP_Float *res);
+bool axp_logbf_ex(AXP_Ctx *ctx, const AXP_Float *x, const AXP_Float *b, AXP_Float *res, axp_size_t precision);
 
 bool axp_powff(AXP_Ctx *ctx, AXP_Float *x, const AXP_Float *y, AXP_Float *res);
 bool axp_powff_ex(AXP_Ctx *ctx, AXP_Float *x, const AXP_Float *y, AXP_Float *res, axp_size_t precision);
 
+// Arguments are reduced modulo pi/2 with as many digits of pi as the cancellation needs
+bool axp_sinf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
+bool axp_sinf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+bool axp_cosf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
+bool axp_cosf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+bool axp_tanf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
+bool axp_tanf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+bool axp_atanf(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res);
+bool axp_atanf_ex(AXP_Ctx *ctx, const AXP_Float *x, AXP_Float *res, axp_size_t precision);
+
 // Write AXP_Float to string, returns bytes written. If buf is NULL of buf_sz is 0 only the needed space will be returned.
-size_t axp_itoa(AXP_Int *x, char *buf, size_t buf_sz);
-char *axp_itoa_alloc(AXP_Ctx *ctx, AXP_Int *x);
+size_t axp_itoa(const AXP_Int *x, char *buf, size_t buf_sz);
+char *axp_itoa_alloc(AXP_Ctx *ctx, const AXP_Int *x);
 bool axp_atoi(AXP_Ctx *ctx, const char *str, AXP_Int *x);
 
-size_t axp_ftoa(AXP_Float *x, char *buf, size_t buf_sz);
-size_t axp_ftoa_ex(AXP_Float *x, char *buf, size_t buf_sz, AXP_FtoaFormat format);
-char *axp_ftoa_alloc(AXP_Ctx *ctx, AXP_Float *x);
+size_t axp_ftoa(const AXP_Float *x, char *buf, size_t buf_sz);
+size_t axp_ftoa_ex(const AXP_Float *x, char *buf, size_t buf_sz, AXP_FtoaFormat format);
+char *axp_ftoa_alloc(AXP_Ctx *ctx, const AXP_Float *x);
 bool axp_atof(AXP_Ctx *ctx, const char *str, AXP_Float *x);
 
+// Write a number through `write_fn` in chunks without building the whole string, returns the characters written or -1
+int axp_itoa_write(AXP_Ctx *ctx, const AXP_Int *x, axp__print_writer_fn write_fn, void *dest);
+int axp_ftoa_write(AXP_Ctx *ctx, const AXP_Float *x, AXP_FtoaFormat format, axp__print_writer_fn write_fn, void *dest);
+
+// Parse a number that makes up the rest of a stream or file descriptor, reading it in chunks instead of as one string
+bool axp_atoi_stream(AXP_Ctx *ctx, FILE *stream, AXP_Int *x);
+bool axp_atoi_fd(AXP_Ctx *ctx, int fd, AXP_Int *x);
+bool axp_atof_stream(AXP_Ctx *ctx, FILE *stream, AXP_Float *x);
+bool axp_atof_fd(AXP_Ctx *ctx, int fd, AXP_Float *x);
+
+// Parses `delim` separated decimals in buf[0, len) into `out` with two allocations in total, each value rounded to the
+// context precision. A delimiter at the very end does not start another value.
+bool axp_atof_batch(AXP_Ctx *ctx, const char *buf, size_t len, char delim, AXP_FloatArray *out);
+// Borrows value i of the array, valid until the array is freed
+AXP_FloatView axp_float_array_at(const AXP_FloatArray *arr, size_t i);
+void axp_float_array_free(AXP_Ctx *ctx, AXP_FloatArray *arr);
+
+/* FLOAT ARRAYS */
+// Batch kernels walk the parallel arrays without allocating per value. Results are rounded half-up to the context
+// precision from the exact values and packed into a new array of `x->count` values, pairwise kernels need arrays of
+// equal length (AXP_ERR_SIZE otherwise). Comparisons write -1, 0 or 1 per value into `res`.
+bool axp_float_array_init(AXP_Ctx *ctx, AXP_FloatArray *arr, const AXP_Float *values, size_t count);
+bool axp_float_array_addf(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_FloatArray *y, AXP_FloatArray *res);
+bool axp_float_array_addf_scalar(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_Float *s, AXP_FloatArray *res);
+bool axp_float_array_mulf_scalar(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_Float *s, AXP_FloatArray *res);
+bool axp_float_array_sumf(AXP_Ctx *ctx, const AXP_FloatArray *x, AXP_Float *res);
+bool axp_float_array_minmaxf(AXP_Ctx *ctx, const AXP_FloatArray *x, size_t *min_idx, size_t *max_idx);
+bool axp_float_array_cmpf(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_FloatArray *y, int8_t *res);
+bool axp_float_array_cmpf_scalar(AXP_Ctx *ctx, const AXP_FloatArray *x, const AXP_Float *s, int8_t *res);
+
+// Binary <-> decimal without string formatting. axp_dtof keeps the shortest digits that read back as `val` from a
+// context precision of 17 on and rounds the exact binary value below, axp_ftod rounds correctly to nearest, ties to even. axp_ftoi64 rounds
+// to nearest with ties away from zero; both fail with AXP_ERR_OVERFLOW when the value does not fit.
+bool axp_dtof(AXP_Ctx *ctx, double val, AXP_Float *x);
+bool axp_ftod(AXP_Ctx *ctx, const AXP_Float *x, double *res);
+bool axp_i64tof(AXP_Ctx *ctx, int64_t val, AXP_Float *x);
+bool axp_ftoi64(AXP_Ctx *ctx, const AXP_Float *x, int64_t *res);
+
+// Versioned binary form (header plus packed BCD digits). Serializing returns the bytes needed and only writes when
+// buf_sz is large enough; deserializing allocates exactly the stored digits.
+size_t axp_serializei(const AXP_Int *x, uint8_t *buf, size_t buf_sz);
+size_t axp_serializei_ex(const AXP_Int *x, uint8_t *buf, size_t buf_sz, AXP_SerialLayout layout);
+size_t axp_serializef(const AXP_Float *x, uint8_t *buf, size_t buf_sz);
+size_t axp_serializef_ex(const AXP_Float *x, uint8_t *buf, size_t buf_sz, AXP_SerialLayout layout);
+bool axp_deserializei(AXP_Ctx *ctx, const uint8_t *buf, size_t buf_sz, AXP_Int *x);
+bool axp_deserializef(AXP_Ctx *ctx, const uint8_t *buf, size_t buf_sz, AXP_Float *x);
+
+/* VIEWS */
+// A view wraps the digits of an AXP_SERIAL_UNPACKED record in place, e.g. inside a file mapped with `axp_map_file`,
+// so every process shares the page cache instead of holding a private copy. Pass `&view.value` to functions taking a
+// `const AXP_Int *` / `const AXP_Float *`; never free it, write to it or use it after the buffer is unmapped.
+// Returns the size of the record in bytes so consecutive records can be walked, or 0 on failure.
+size_t axp_viewi(AXP_Ctx *ctx, const void *data, size_t data_sz, AXP_IntView *view);
+size_t axp_viewf(AXP_Ctx *ctx, const void *data, size_t data_sz, AXP_FloatView *view);
+bool axp_map_file(AXP_Ctx *ctx, const char *path, AXP_Mapping *map);
+void axp_unmap_file(AXP_Mapping *map);
+
 void axp_throw(AXP_Ctx *ctx, AXP_ErrorCode err_code, const char *fmt, ...) PRINTF_LIKE_WARNINGS(3, 4);
 const char *axp_strerror(const AXP_Ctx *ctx);
 void axp_error_reset(AXP_Ctx *ctx);
@@ -3,8 +3,8 @@ import subprocess
 import sys
 from pathlib import Path
 from ctypes import (
-  c_uint8, c_int8, c_uint32, c_int64, c_int, c_size_t, c_char_p, c_char,
-  byref, c_bool, c_void_p, POINTER, Structure, create_string_buffer,
+  c_uint8, c_int8, c_uint32, c_int64, c_int, c_size_t, c_char_p, c_char, c_double,
+  byref, c_bool, c_void_p, POINTER, Structure, create_string_buffer, CFUNCTYPE,
 )
 
 ROOT_DIR = Path(__file__).parent.parent
@@ -55,6 +55,8 @@ AXP_ERR_PARSE = 5
 AXP_ERR_UNINITIALIZED = 6
 AXP_ERR_FORMAT = 7
 AXP_ERR_WRITE = 8
+AXP_ERR_READ = 9
+AXP_ERR_SIZE = 10
 
 ERROR_NAMES = {
   AXP_OK: "AXP_OK",
@@ -66,22 +68,17 @@ ERROR_NAMES = {
   AXP_ERR_UNINITIALIZED: "AXP_ERR_UNINITIALIZED",
   AXP_ERR_FORMAT: "AXP_ERR_FORMAT",
   AXP_ERR_WRITE: "AXP_ERR_WRITE",
+  AXP_ERR_READ: "AXP_ERR_READ",
+  AXP_ERR_SIZE: "AXP_ERR_SIZE",
 }
 
+AXP_MUL_LIMB_THRESHOLD = 12
+AXP_MUL_KARATSUBA_LIMBS = 24
+
 AXP_FTOA_REGULAR = 0
 AXP_FTOA_SCIENTIFIC = 1
 AXP_FTOA_AUTO = 2
 
-class AXP_Ctx(Structure):
-  _fields_ = [
-    ("precision", axp_size_t),
-    ("err", AXP_ErrorCode),
-    ("err_str", c_char * 1024),
-    ("fast_rounding", c_bool),
-    ("ziv_safety_digits", axp_size_t),
-    ("ziv_max_retries", axp_size_t),
-  ]
-
 class AXP_Int(Structure):
   _fields_ = [
     ("size", axp_size_t),
@@ -99,6 +96,74 @@ class AXP_Float(Structure):
     ("exponent", axp_exp_t),
   ]
 
+class AXP_IntView(Structure):
+  _fields_ = [("value", AXP_Int)]
+
+class AXP_FloatView(Structure):
+  _fields_ = [("value", AXP_Float)]
+
+class AXP_Mapping(Structure):
+  _fields_ = [("data", c_void_p), ("size", c_size_t)]
+
+class AXP_FloatArray(Structure):
+  _fields_ = [
+    ("count", c_size_t),
+    ("offsets", POINTER(c_size_t)),
+    ("sizes", POINTER(axp_size_t)),
+    ("exponents", POINTER(axp_exp_t)),
+    ("signs", POINTER(c_uint8)),
+    ("digits", POINTER(axp_digit_t)),
+    ("digits_capacity", c_size_t),
+  ]
+
+AXP_SERIAL_PACKED = 0
+AXP_SERIAL_UNPACKED = 1
+
+class AXP_Series(Structure):
+  _fields_ = [
+    ("p", AXP_Int),
+    ("q", AXP_Int),
+    ("b", AXP_Int),
+    ("t", AXP_Int),
+    ("terms", axp_size_t),
+  ]
+
+AXP_CONST_E = 0
+AXP_CONST_LN2 = 1
+AXP_CONST_LN10 = 2
+AXP_CONST_PI = 3
+AXP_CONST_COUNT = 4
+
+class AXP_ConstCacheEntry(Structure):
+  _fields_ = [
+    ("series", AXP_Series * 2),
+    ("value", AXP_Float),
+    ("precision", axp_size_t),
+  ]
+
+class AXP_CtxStats(Structure):
+  _fields_ = [
+    ("bytes_live", c_size_t),
+    ("bytes_peak", c_size_t),
+    ("alloc_count", c_size_t),
+    ("realloc_count", c_size_t),
+    ("free_count", c_size_t),
+    ("bytes_freed", c_size_t),
+  ]
+
+class AXP_Ctx(Structure):
+  _fields_ = [
+    ("precision", axp_size_t),
+    ("err", AXP_ErrorCode),
+    ("err_str", c_char * 1024),
+    ("fast_rounding", c_bool),
+    ("ziv_safety_digits", axp_size_t),
+    ("ziv_max_retries", axp_size_t),
+    ("ln_agm_threshold", axp_size_t),
+    ("stats", AXP_CtxStats),
+    ("constants", AXP_ConstCacheEntry * AXP_CONST_COUNT),
+  ]
+
 def _fn(name, restype, *argtypes):
   f = getattr(lib, name)
   f.restype = restype
@@ -113,6 +178,10 @@ axp_reallocf = _fn("axp_reallocf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float),
 axp_reallocf_round = _fn("axp_reallocf_round", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), axp_size_t)
 axp_freei = _fn("axp_freei", None, POINTER(AXP_Int))
 axp_freef = _fn("axp_freef", None, POINTER(AXP_Float))
+axp_freei_ex = _fn("axp_freei_ex", None, POINTER(AXP_Ctx), POINTER(AXP_Int))
+axp_freef_ex = _fn("axp_freef_ex", None, POINTER(AXP_Ctx), POINTER(AXP_Float))
+axp_ctx_stats_get = _fn("axp_ctx_stats_get", None, POINTER(AXP_Ctx), POINTER(AXP_CtxStats))
+axp_ctx_stats_reset = _fn("axp_ctx_stats_reset", None, POINTER(AXP_Ctx))
 
 axp_copyi = _fn("axp_copyi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int))
 axp_copyi_ex = _fn("axp_copyi_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), axp_size_t)
@@ -122,6 +191,9 @@ axp_copyf_ex_round = _fn("axp_copyf_ex_round", c_bool, POINTER(AXP_Ctx), POINTER
 axp_copyf_exact = _fn("axp_copyf_exact", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
 
 axp_abs_cmpi = _fn("axp_abs_cmpi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(c_int8))
+axp_abs_cmpf = _fn("axp_abs_cmpf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), POINTER(c_int8))
+axp_cmpi = _fn("axp_cmpi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(c_int8))
+axp_cmpf = _fn("axp_cmpf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), POINTER(c_int8))
 axp_is_zeroi = _fn("axp_is_zeroi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(c_bool))
 axp_normalizef = _fn("axp_normalizef", None, POINTER(AXP_Float))
 axp_roundf = _fn("axp_roundf", None, POINTER(AXP_Float), axp_size_t)
@@ -135,6 +207,16 @@ axp_subi = _fn("axp_subi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(A
 axp_muli = _fn("axp_muli", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int))
 axp_divi = _fn("axp_divi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int))
 axp_powi = _fn("axp_powi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), axp_size_t, POINTER(AXP_Int))
+axp_isqrti = _fn("axp_isqrti", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int))
+axp_modi = _fn("axp_modi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int))
+axp_powmodi = _fn("axp_powmodi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int))
+axp_gcdi = _fn("axp_gcdi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int))
+axp_lcmi = _fn("axp_lcmi", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int))
+axp_gcdexti = _fn("axp_gcdexti", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int), POINTER(AXP_Int))
+axp_factoriali = _fn("axp_factoriali", c_bool, POINTER(AXP_Ctx), axp_size_t, POINTER(AXP_Int))
+axp_binomiali = _fn("axp_binomiali", c_bool, POINTER(AXP_Ctx), axp_size_t, axp_size_t, POINTER(AXP_Int))
+axp_primoriali = _fn("axp_primoriali", c_bool, POINTER(AXP_Ctx), axp_size_t, POINTER(AXP_Int))
+axp_rising_factoriali = _fn("axp_rising_factoriali", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Int), axp_size_t, POINTER(AXP_Int))
 
 axp_addf = _fn("axp_addf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), POINTER(AXP_Float))
 axp_addf_ex = _fn("axp_addf_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), POINTER(AXP_Float), axp_size_t)
@@ -146,16 +228,33 @@ axp_divf = _fn("axp_divf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER
 axp_divf_ex = _fn("axp_divf_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), POINTER(AXP_Float), axp_size_t)
 axp_powf = _fn("axp_powf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), axp_exp_t, POINTER(AXP_Float))
 axp_powf_ex = _fn("axp_powf_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), axp_exp_t, POINTER(AXP_Float), axp_size_t)
+axp_sqrtf = _fn("axp_sqrtf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
+axp_sqrtf_ex = _fn("axp_sqrtf_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), axp_size_t)
+axp_rsqrtf = _fn("axp_rsqrtf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
+axp_rootf = _fn("axp_rootf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), axp_size_t, POINTER(AXP_Float))
 
 axp_e = _fn("axp_e", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float))
 axp_e_ex = _fn("axp_e_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), axp_size_t)
+axp_ln2_ex = _fn("axp_ln2_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), axp_size_t)
+axp_ln10_ex = _fn("axp_ln10_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), axp_size_t)
+axp_pi_ex = _fn("axp_pi_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), axp_size_t)
+axp_constf_ex = _fn("axp_constf_ex", c_bool, POINTER(AXP_Ctx), c_int, POINTER(AXP_Float), axp_size_t)
+axp_const_cache_free = _fn("axp_const_cache_free", None, POINTER(AXP_Ctx))
 axp_expf = _fn("axp_expf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
 axp_expf_ex = _fn("axp_expf_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), axp_size_t)
 axp_expf_no_splitting = _fn("axp_expf_no_splitting", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), axp_size_t)
 axp_lnf = _fn("axp_lnf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
 axp_lnf_ex = _fn("axp_lnf_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), axp_size_t)
+axp_log10f = _fn("axp_log10f", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
+axp_log2f = _fn("axp_log2f", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
+axp_logbf = _fn("axp_logbf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), POINTER(AXP_Float))
 axp_powff = _fn("axp_powff", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), POINTER(AXP_Float))
 axp_powff_ex = _fn("axp_powff_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), POINTER(AXP_Float), axp_size_t)
+axp_sinf = _fn("axp_sinf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
+axp_cosf = _fn("axp_cosf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
+axp_tanf = _fn("axp_tanf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
+axp_atanf = _fn("axp_atanf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float))
+axp_sinf_ex = _fn("axp_sinf_ex", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(AXP_Float), axp_size_t)
 
 axp_itoa = _fn("axp_itoa", c_size_t, POINTER(AXP_Int), c_void_p, c_size_t)
 axp_itoa_alloc = _fn("axp_itoa_alloc", c_char_p, POINTER(AXP_Ctx), POINTER(AXP_Int))
@@ -164,6 +263,38 @@ axp_ftoa = _fn("axp_ftoa", c_size_t, POINTER(AXP_Float), c_void_p, c_size_t)
 axp_ftoa_ex = _fn("axp_ftoa_ex", c_size_t, POINTER(AXP_Float), c_void_p, c_size_t, c_int)
 axp_ftoa_alloc = _fn("axp_ftoa_alloc", c_char_p, POINTER(AXP_Ctx), POINTER(AXP_Float))
 axp_atof = _fn("axp_atof", c_bool, POINTER(AXP_Ctx), c_char_p, POINTER(AXP_Float))
+AXP_WriterFn = CFUNCTYPE(c_int, POINTER(AXP_Ctx), c_void_p, POINTER(c_char), c_size_t, POINTER(c_int))
+axp_itoa_write = _fn("axp_itoa_write", c_int, POINTER(AXP_Ctx), POINTER(AXP_Int), AXP_WriterFn, c_void_p)
+axp_ftoa_write = _fn("axp_ftoa_write", c_int, POINTER(AXP_Ctx), POINTER(AXP_Float), c_int, AXP_WriterFn, c_void_p)
+axp_serializei = _fn("axp_serializei", c_size_t, POINTER(AXP_Int), c_void_p, c_size_t)
+axp_serializef = _fn("axp_serializef", c_size_t, POINTER(AXP_Float), c_void_p, c_size_t)
+axp_serializei_ex = _fn("axp_serializei_ex", c_size_t, POINTER(AXP_Int), c_void_p, c_size_t, c_int)
+axp_serializef_ex = _fn("axp_serializef_ex", c_size_t, POINTER(AXP_Float), c_void_p, c_size_t, c_int)
+axp_deserializei = _fn("axp_deserializei", c_bool, POINTER(AXP_Ctx), c_char_p, c_size_t, POINTER(AXP_Int))
+axp_deserializef = _fn("axp_deserializef", c_bool, POINTER(AXP_Ctx), c_char_p, c_size_t, POINTER(AXP_Float))
+axp_viewi = _fn("axp_viewi", c_size_t, POINTER(AXP_Ctx), c_void_p, c_size_t, POINTER(AXP_IntView))
+axp_viewf = _fn("axp_viewf", c_size_t, POINTER(AXP_Ctx), c_void_p, c_size_t, POINTER(AXP_FloatView))
+axp_map_file = _fn("axp_map_file", c_bool, POINTER(AXP_Ctx), c_char_p, POINTER(AXP_Mapping))
+axp_unmap_file = _fn("axp_unmap_file", None, POINTER(AXP_Mapping))
+axp_atoi_stream = _fn("axp_atoi_stream", c_bool, POINTER(AXP_Ctx), c_void_p, POINTER(AXP_Int))
+axp_atoi_fd = _fn("axp_atoi_fd", c_bool, POINTER(AXP_Ctx), c_int, POINTER(AXP_Int))
+axp_atof_stream = _fn("axp_atof_stream", c_bool, POINTER(AXP_Ctx), c_void_p, POINTER(AXP_Float))
+axp_atof_fd = _fn("axp_atof_fd", c_bool, POINTER(AXP_Ctx), c_int, POINTER(AXP_Float))
+axp_dtof = _fn("axp_dtof", c_bool, POINTER(AXP_Ctx), c_double, POINTER(AXP_Float))
+axp_ftod = _fn("axp_ftod", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(c_double))
+axp_i64tof = _fn("axp_i64tof", c_bool, POINTER(AXP_Ctx), c_int64, POINTER(AXP_Float))
+axp_ftoi64 = _fn("axp_ftoi64", c_bool, POINTER(AXP_Ctx), POINTER(AXP_Float), POINTER(c_int64))
+axp_atof_batch = _fn("axp_atof_batch", c_bool, POINTER(AXP_Ctx), c_char_p, c_size_t, c_char, POINTER(AXP_FloatArray))
+axp_float_array_at = _fn("axp_float_array_at", AXP_FloatView, POINTER(AXP_FloatArray), c_size_t)
+axp_float_array_free = _fn("axp_float_array_free", None, POINTER(AXP_Ctx), POINTER(AXP_FloatArray))
+axp_float_array_init = _fn("axp_float_array_init", c_bool, POINTER(AXP_Ctx), POINTER(AXP_FloatArray), POINTER(AXP_Float), c_size_t)
+axp_float_array_addf = _fn("axp_float_array_addf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_FloatArray), POINTER(AXP_FloatArray), POINTER(AXP_FloatArray))
+axp_float_array_addf_scalar = _fn("axp_float_array_addf_scalar", c_bool, POINTER(AXP_Ctx), POINTER(AXP_FloatArray), POINTER(AXP_Float), POINTER(AXP_FloatArray))
+axp_float_array_mulf_scalar = _fn("axp_float_array_mulf_scalar", c_bool, POINTER(AXP_Ctx), POINTER(AXP_FloatArray), POINTER(AXP_Float), POINTER(AXP_FloatArray))
+axp_float_array_sumf = _fn("axp_float_array_sumf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_FloatArray), POINTER(AXP_Float))
+axp_float_array_minmaxf = _fn("axp_float_array_minmaxf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_FloatArray), POINTER(c_size_t), POINTER(c_size_t))
+axp_float_array_cmpf = _fn("axp_float_array_cmpf", c_bool, POINTER(AXP_Ctx), POINTER(AXP_FloatArray), POINTER(AXP_FloatArray), POINTER(c_int8))
+axp_float_array_cmpf_scalar = _fn("axp_float_array_cmpf_scalar", c_bool, POINTER(AXP_Ctx), POINTER(AXP_FloatArray), POINTER(AXP_Float), POINTER(c_int8))
 
 axp_strerror = _fn("axp_strerror", c_char_p, POINTER(AXP_Ctx))
 axp_error_reset = _fn("axp_error_reset", None, POINTER(AXP_Ctx))
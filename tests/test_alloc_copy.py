@@ -3,9 +3,10 @@ from decimal import Decimal, getcontext, ROUND_HALF_UP
 
 import framework
 from axp_bindings import (
-  AXP_Int, AXP_Float, new_ctx,
+  AXP_Int, AXP_Float, AXP_CtxStats, new_ctx,
   axp_initi, axp_initf, axp_initf_ex, axp_realloci, axp_reallocf, axp_reallocf_round,
-  axp_freei, axp_freef, axp_copyi, axp_copyi_ex, axp_copyf, axp_copyf_ex,
+  axp_freei, axp_freef, axp_freei_ex, axp_freef_ex, axp_ctx_stats_get, axp_ctx_stats_reset,
+  axp_mulf, axp_addf, axp_divf, axp_powf, axp_expf, axp_lnf, axp_sqrtf, axp_sinf, axp_const_cache_free, axp_copyi, axp_copyi_ex, axp_copyf, axp_copyf_ex,
   axp_copyf_ex_round, axp_copyf_exact, axp_normalizef, axp_roundf, axp_floorf,
   axp_shli, axp_shri, int_to_axpi, axpi_to_int, str_to_axpf, axpf_to_str,
 )
@@ -136,3 +137,53 @@ def run(report):
     axp_shri(byref(ctx), byref(x), 5)  # shift more than size -> truncates to 0
     s.check_equal(axpi_to_int(x), 0, "axp_shri past the digit count truncates to 0")
     axp_freei(byref(x))
+
+    # memory statistics
+    sctx = new_ctx(precision=16)
+    stats = AXP_CtxStats()
+    f = AXP_Float()
+    axp_initf_ex(byref(sctx), byref(f), 40)
+    axp_ctx_stats_get(byref(sctx), byref(stats))
+    s.check_equal((stats.bytes_live, stats.bytes_peak, stats.alloc_count), (40, 40, 1), "axp_initf_ex is accounted in the ctx stats")
+    axp_reallocf(byref(sctx), byref(f), 10)
+    axp_ctx_stats_get(byref(sctx), byref(stats))
+    s.check_equal((stats.bytes_live, stats.bytes_peak, stats.realloc_count), (10, 40, 1), "axp_reallocf updates live bytes and keeps the peak")
+    axp_freef_ex(byref(sctx), byref(f))
+    axp_ctx_stats_get(byref(sctx), byref(stats))
+    s.check_equal(stats.bytes_live, 0, "axp_freef_ex releases the bytes")
+
+    axp_ctx_stats_reset(byref(sctx))
+    x = int_to_axpi(sctx, 12345678901234567890)
+    axp_ctx_stats_get(byref(sctx), byref(stats))
+    s.check(stats.alloc_count == 1 and stats.realloc_count == 0 and stats.bytes_live == 20,
+            "axp_atoi allocates its digits exactly once",
+            f"alloc_count={stats.alloc_count}, realloc_count={stats.realloc_count}, bytes_live={stats.bytes_live}")
+    axp_freei_ex(byref(sctx), byref(x))
+
+    a, b, r = str_to_axpf(sctx, "1.5"), str_to_axpf(sctx, "2.25"), AXP_Float()
+    axp_ctx_stats_reset(byref(sctx))
+    axp_mulf(byref(sctx), byref(a), byref(b), byref(r))
+    axp_ctx_stats_get(byref(sctx), byref(stats))
+    s.check_equal(stats.bytes_live, 3 * 16, "temporaries of axp_mulf are released, only the result stays live")
+    s.check(stats.bytes_peak > stats.bytes_live and stats.alloc_count == 3, "axp_mulf peak covers its temporaries",
+            f"peak={stats.bytes_peak}, allocs={stats.alloc_count}")
+    for v in (a, b, r): axp_freef_ex(byref(sctx), byref(v))
+    axp_ctx_stats_get(byref(sctx), byref(stats))
+    s.check_equal(stats.bytes_live, 0, "every byte is released after freeing with the ctx")
+
+    # a float workload, including the cached constants, balances every allocation with a free
+    axp_ctx_stats_reset(byref(sctx))
+    vals = [str_to_axpf(sctx, v) for v in ("2.5", "-0.125", "31415.9265", "7e-12")]
+    outs = []
+    for x in vals:
+      for fn in (axp_expf, axp_sinf) + ((axp_lnf, axp_sqrtf) if x.sign == 0 else ()):
+        outs.append(AXP_Float()); fn(byref(sctx), byref(x), byref(outs[-1]))
+      for fn in (axp_addf, axp_mulf, axp_divf):
+        outs.append(AXP_Float()); fn(byref(sctx), byref(x), byref(vals[0]), byref(outs[-1]))
+      outs.append(AXP_Float()); axp_powf(byref(sctx), byref(x), 7, byref(outs[-1]))
+    for v in vals + outs: axp_freef_ex(byref(sctx), byref(v))
+    axp_const_cache_free(byref(sctx))
+    axp_ctx_stats_get(byref(sctx), byref(stats))
+    s.check(stats.bytes_live == 0 and stats.free_count == stats.alloc_count and stats.bytes_freed >= stats.bytes_peak > 0,
+            "float frees are counted against their allocations",
+            f"live={stats.bytes_live}, allocs={stats.alloc_count}, frees={stats.free_count}, freed={stats.bytes_freed}")
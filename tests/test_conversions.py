@@ -1,16 +1,27 @@
+import os
 import random
-from ctypes import byref
-from decimal import Decimal, getcontext, ROUND_HALF_UP
+import tempfile
+import ctypes
+import math
+import struct
+from ctypes import byref, c_void_p, c_char_p, c_int8, c_double, c_int64, create_string_buffer
+from decimal import Decimal, Context, getcontext, ROUND_HALF_UP
 
 import framework
 from axp_bindings import (
   AXP_Int, AXP_Float, new_ctx, axp_atoi, axp_atof, axp_itoa, axp_ftoa, axp_ftoa_ex,
   AXP_FTOA_REGULAR, AXP_FTOA_SCIENTIFIC, AXP_FTOA_AUTO,
   axp_freei, axp_freef, int_to_axpi, axpi_to_int, str_to_axpf, axpf_to_str, axpf_to_str_ex,
+  axp_serializei, axp_serializef, axp_deserializei, axp_deserializef, axp_serializei_ex, axp_serializef_ex,
+  AXP_SERIAL_UNPACKED, AXP_IntView, AXP_FloatView, AXP_Mapping, axp_viewi, axp_viewf, axp_map_file, axp_unmap_file,
+  axp_addf, axp_cmpf, axp_dtof, axp_ftod, axp_i64tof, axp_ftoi64, AXP_ERR_OVERFLOW,
+  AXP_FloatArray, axp_atof_batch, axp_float_array_at, axp_float_array_free, AXP_CtxStats, axp_ctx_stats_get, err_str,
+  AXP_WriterFn, axp_itoa_write, axp_ftoa_write, axp_atoi_stream, axp_atoi_fd, axp_atof_stream, axp_atof_fd, AXP_ERR_PARSE, AXP_ERR_READ,
 )
 from helpers import gen_randomi, gen_randomf
 
 ctx = new_ctx(precision=16)
+ctx_wide = new_ctx(precision=40)
 _REF_GUARD_PREC = 50
 
 def _correctly_rounded(compute, target_prec):
@@ -31,7 +42,7 @@ def run_ftoa_roundtrip(x_str):
   ax = str_to_axpf(ctx, x_str)
   got_str = axpf_to_str(ctx, ax)
   axp_freef(byref(ax))
-  expected = _correctly_rounded(lambda: Decimal(x_str), ctx.precision)
+  expected = _correctly_rounded(lambda: Decimal(x_str.replace(" ", "")), ctx.precision)
   return Decimal(got_str), expected, f"ftoa(atof({x_str}))"
 
 def run_ftoa_ex_value_roundtrip(x_str, fmt):
@@ -44,6 +55,194 @@ def run_ftoa_ex_value_roundtrip(x_str, fmt):
   expected = _correctly_rounded(lambda: Decimal(x_str), ctx.precision)
   return got, expected, f"parse(ftoa_ex(atof({x_str}), fmt={fmt}))"
 
+def _atoi_ok(x_str):
+  ax = AXP_Int()
+  ok = axp_atoi(byref(ctx), x_str.encode(), byref(ax))
+  if ok: axp_freei(byref(ax))
+  return ok
+
+def run_atof_spaced(x_str):
+  spaced = "".join(c + (" " if random.random() < 0.1 else "") for c in x_str)
+  got, expected, _ = run_ftoa_roundtrip(spaced)
+  return got, expected, f"ftoa(atof({spaced!r}))"
+
+_libc = ctypes.CDLL(None)
+_libc.fopen.restype = c_void_p
+_libc.fopen.argtypes = [c_char_p, c_char_p]
+_libc.fclose.argtypes = [c_void_p]
+
+def _parse_file(text, parse, out, use_stream=False):
+  with tempfile.NamedTemporaryFile("w", delete=False) as f:
+    f.write(text)
+  try:
+    if use_stream:
+      stream = _libc.fopen(f.name.encode(), b"r")
+      ok = parse(byref(ctx), stream, byref(out))
+      _libc.fclose(stream)
+    else:
+      fd = os.open(f.name, os.O_RDONLY)
+      ok = parse(byref(ctx), fd, byref(out))
+      os.close(fd)
+  finally:
+    os.unlink(f.name)
+  return ok
+
+def run_atoi_fd(x, use_stream=False):
+  ax = AXP_Int()
+  ok = _parse_file(f" {x}\n", axp_atoi_stream if use_stream else axp_atoi_fd, ax, use_stream)
+  got = axpi_to_int(ax) if ok else None
+  if ok: axp_freei(byref(ax))
+  return got, x, f"atoi_fd({x})"
+
+def run_atof_fd(x_str, use_stream=False):
+  ax = AXP_Float()
+  ok = _parse_file(x_str, axp_atof_stream if use_stream else axp_atof_fd, ax, use_stream)
+  if not ok: return None, None, f"atof_fd({x_str})"
+  got = Decimal(axpf_to_str(ctx, ax))
+  axp_freef(byref(ax))
+  expected = _correctly_rounded(lambda: Decimal(x_str.replace(" ", "")), ctx.precision)
+  return got, expected, f"atof_fd({x_str})"
+
+def _chunk_writer(fail_after=None):
+  chunks = []
+  def write(_ctx, _dest, txt, txt_len, curr_pos):
+    if fail_after is not None and len(chunks) >= fail_after: return -1
+    chunks.append(txt[:txt_len].decode())
+    curr_pos[0] += txt_len
+    return txt_len
+  return chunks, AXP_WriterFn(write)
+
+def run_itoa_write(x):
+  ax = int_to_axpi(ctx, x)
+  chunks, fn = _chunk_writer()
+  n = axp_itoa_write(byref(ctx), byref(ax), fn, None)
+  axp_freei(byref(ax))
+  got = "".join(chunks)
+  return (int(got), n, max(map(len, chunks)) <= 4096), (x, len(got), True), f"itoa_write({x})"
+
+def run_ftoa_write(x_str, fmt):
+  ax = str_to_axpf(ctx, x_str)
+  chunks, fn = _chunk_writer()
+  n = axp_ftoa_write(byref(ctx), byref(ax), fmt, fn, None)
+  expected = axpf_to_str_ex(ax, fmt)
+  axp_freef(byref(ax))
+  return ("".join(chunks), n), (expected, len(expected)), f"ftoa_write({x_str}, fmt={fmt})"
+
+def _serialize(serialize, ax):
+  n = serialize(byref(ax), None, 0)
+  buf = create_string_buffer(n)
+  assert serialize(byref(ax), buf, n) == n
+  return buf.raw
+
+def run_serializei(x, layout=0):
+  ax = int_to_axpi(ctx, x)
+  blob = _serialize(lambda v, b, n: axp_serializei_ex(v, b, n, layout), ax)
+  axp_freei(byref(ax))
+  back = AXP_Int()
+  ok = axp_deserializei(byref(ctx), blob, len(blob), byref(back))
+  got = axpi_to_int(back) if ok else None
+  if ok: axp_freei(byref(back))
+  payload = len(str(abs(x))) if layout == AXP_SERIAL_UNPACKED else (len(str(abs(x))) + 1) // 2
+  return (got, len(blob)), (x, 12 + payload), f"deserializei(serializei({x}))"
+
+def run_serializef(x_str):
+  ax = str_to_axpf(ctx, x_str)
+  expected = axpf_to_str(ctx, ax)
+  blob = _serialize(axp_serializef, ax)
+  axp_freef(byref(ax))
+  back = AXP_Float()
+  ok = axp_deserializef(byref(ctx), blob, len(blob), byref(back))
+  got = axpf_to_str(ctx, back) if ok else None
+  if ok: axp_freef(byref(back))
+  return got, expected, f"deserializef(serializef({x_str}))"
+
+def _bits_to_double(bits):
+  return struct.unpack("<d", struct.pack("<Q", bits))[0]
+
+def gen_random_double():
+  while True:
+    v = _bits_to_double(random.getrandbits(64))
+    if math.isfinite(v): return v
+
+def run_dtof(v):
+  ax = AXP_Float()
+  ok = axp_dtof(byref(ctx_wide), v, byref(ax))
+  got = axpf_to_str(ctx_wide, ax) if ok else None
+  back = c_double()
+  ok = ok and axp_ftod(byref(ctx_wide), ax, byref(back))
+  if got is not None: axp_freef(byref(ax))
+  # Python's repr is the shortest round-trip form as well
+  return (got and Decimal(got), ok and back.value), (Decimal(repr(v)), v), f"dtof({v!r})"
+
+def run_dtof_short(v, precision):
+  # Below 17 digits the exact binary value is rounded once, not its shortest form
+  ctx_short = new_ctx(precision=precision)
+  ax = AXP_Float()
+  ok = axp_dtof(byref(ctx_short), v, byref(ax))
+  got = Decimal(axpf_to_str(ctx_short, ax)) if ok else None
+  if ok: axp_freef(byref(ax))
+  return got, Context(prec=precision, rounding=ROUND_HALF_UP).plus(Decimal(v)), f"dtof({v!r}) at {precision} digits"
+
+def gen_near_halfway():
+  # A decimal within a few units of the 40th digit of the midpoint between two neighbouring doubles
+  bits = random.getrandbits(63)
+  lo = _bits_to_double(bits)
+  hi = _bits_to_double(bits + 1)
+  if not math.isfinite(hi): return "1e-5"
+  getcontext().prec = 800
+  mid = (Decimal(lo) + Decimal(hi)) / 2
+  if random.random() < 0.3: return str(mid)
+  getcontext().prec = 40
+  return str(+mid + Decimal(random.randint(-3, 3)).scaleb(mid.adjusted() - 39))
+
+def run_ftod(x_str):
+  c = new_ctx(precision=max(len(x_str), 16))
+  ax = str_to_axpf(c, x_str)
+  back = c_double()
+  ok = axp_ftod(byref(c), ax, byref(back))
+  axp_freef(byref(ax))
+  expected = float(x_str)
+  return (ok, back.value), (math.isfinite(expected), expected), f"ftod({x_str})"
+
+def _ftoi64(x_str):
+  ax = str_to_axpf(ctx_wide, x_str)
+  res = c_int64()
+  ok = axp_ftoi64(byref(ctx_wide), ax, byref(res))
+  axp_freef(byref(ax))
+  return res.value if ok else ctx_wide.err
+
+def _i64tof(v, precision):
+  c = new_ctx(precision=precision)
+  ax = AXP_Float()
+  axp_i64tof(byref(c), v, byref(ax))
+  got = axpf_to_str(c, ax)
+  axp_freef(byref(ax))
+  return Decimal(got)
+
+def _atof_batch(text, delim=b","):
+  arr = AXP_FloatArray()
+  if not axp_atof_batch(byref(ctx), text, len(text), delim, byref(arr)): return None
+  values = [axpf_to_str(ctx, axp_float_array_at(byref(arr), i).value) for i in range(arr.count)]
+  axp_float_array_free(byref(ctx), byref(arr))
+  return values
+
+def _atof_each(values):
+  out = []
+  for v in values:
+    ax = str_to_axpf(ctx, v)
+    out.append(axpf_to_str(ctx, ax))
+    axp_freef(byref(ax))
+  return out
+
+def run_atof_batch(values):
+  return _atof_batch(",".join(values).encode()), _atof_each(values), f"atof_batch({values})"
+
+def _deserializei_err(blob):
+  back = AXP_Int()
+  ok = axp_deserializei(byref(ctx), blob, len(blob), byref(back))
+  if ok: axp_freei(byref(back))
+  return not ok and ctx.err == AXP_ERR_PARSE
+
 def run(report):
   with framework.Suite("conversions", report) as s:
     # itoa/atoi edge cases
@@ -69,6 +268,16 @@ def run(report):
       s.check_equal(axpi_to_int(ax), 42, "atoi('+42') == 42")
       axp_freei(byref(ax))
 
+    # atoi validates a vector of characters at a time, so bad characters are caught at every offset
+    long_digits = "".join(random.choice("0123456789") for _ in range(301)).lstrip("0") or "7"
+    s.check_equal(run_itoa_roundtrip(int(long_digits))[0], int(long_digits), "atoi/itoa round-trips a 300-digit number")
+    ax = AXP_Int()
+    ok = axp_atoi(byref(ctx), b"-12 345\t678 9", byref(ax))
+    s.check(ok and axpi_to_int(ax) == -123456789, "atoi skips whitespace between digits")
+    if ok: axp_freei(byref(ax))
+    bad_offsets = [i for i in range(70) if not _atoi_ok("1" * i + "x" + "2" * (69 - i))]
+    s.check_equal(len(bad_offsets), 70, "atoi rejects a non-digit at any offset of a 70-character string")
+
     # atof/ftoa edge cases, including every zero representation
     for zero_str in ["0", "00", "000", "0.0", "0.00", "00.00", "-0", "+0", "0e10", "0.0e-100"]:
       s.check_equal(run_ftoa_roundtrip(zero_str)[0], Decimal("0"), f"atof({zero_str!r}) parses as exactly zero")
@@ -87,6 +296,138 @@ def run(report):
     got, _, _ = run_ftoa_roundtrip("1.0000000000000005")
     s.check_equal(got, Decimal("1.000000000000001"), "atof correctly rounds excess digits at a halfway tie")
 
+    got, _, _ = run_ftoa_roundtrip("9.99999999999999999")
+    s.check_equal(got, Decimal("10"), "atof carries a rounding overflow into the exponent")
+    got, _, _ = run_ftoa_roundtrip("1234567890123456.7")
+    s.check_equal(got, Decimal("1234567890123457"), "atof rounds on the digit just past the decimal point")
+    got, _, _ = run_ftoa_roundtrip("0.000" + "123456789" * 40 + "e-5")
+    s.check_equal(got, Decimal("1.234567891234568e-9"), "atof rounds a long mantissa with leading zeros after the dot")
+    got, _, _ = run_ftoa_roundtrip("-1 234 567.891 234 567 8")
+    s.check_equal(got, Decimal("-1234567.891234568"), "atof skips whitespace between digits when rounding")
+
+    # Writers hand out at most AXP_WRITE_CHUNK_SIZE characters per callback
+    big = -int("8" + "0123456789" * 1000)
+    s.check_equal(run_itoa_write(big)[0], (big, 10002, True), "itoa_write emits a 10001-digit integer in 4096-character chunks")
+    wide = str_to_axpf(new_ctx(precision=5000), "7" * 5000 + "e-2500")
+    chunks, fn = _chunk_writer()
+    n = axp_ftoa_write(byref(ctx), byref(wide), AXP_FTOA_REGULAR, fn, None)
+    s.check_equal(("".join(chunks), n, len(chunks)), ("7" * 2500 + "." + "7" * 2500, 5001, 2),
+                  "ftoa_write splits a wide value across chunks")
+    chunks, fn = _chunk_writer(fail_after=1)
+    s.check_equal(axp_ftoa_write(byref(ctx), byref(wide), AXP_FTOA_SCIENTIFIC, fn, None), -1,
+                  "ftoa_write returns -1 when the writer fails")
+    axp_freef(byref(wide))
+    s.check_equal(run_ftoa_write("1e30000", AXP_FTOA_REGULAR)[0][1], 30003, "ftoa_write pads a huge exponent with zeros")
+
+    # Binary serialization: 12/20-byte header plus packed BCD
+    s.check_equal(run_serializei(-12345)[0], (-12345, 15), "serializei packs 5 digits into 3 bytes after the header")
+    blob = _serialize(axp_serializei, int_to_axpi(ctx, 987654321))
+    s.check_equal(blob[:6], b"AXPI\x01\x00", "serializei writes the magic, version and sign")
+    s.check(_deserializei_err(blob[:-1]), "deserializei rejects a truncated buffer")
+    s.check(_deserializei_err(b"AXPF" + blob[4:]), "deserializei rejects a float's magic")
+    s.check(_deserializei_err(blob[:4] + b"\x02" + blob[5:]), "deserializei rejects an unknown version")
+    s.check(_deserializei_err(blob[:12] + b"\xAB" + blob[13:]), "deserializei rejects a nibble above 9")
+    wide_blob = _serialize(axp_serializei, int_to_axpi(ctx, 10 ** 99 - 1))
+    s.check(_deserializei_err(wide_blob[:20] + b"\x9F" + wide_blob[21:]), "deserializei rejects a bad nibble inside a long digit run")
+    s.check_equal(run_serializef("-1.5e-123456")[0], "-1.5e-123456", "serializef keeps a large negative exponent")
+
+    # Binary doubles convert without a string round-trip
+    wide = Context(prec=800)
+    for v in (0.1, 1.0, 123456789.0, 5e-324, 1e-323, 2.2250738585072014e-308, 1.7976931348623157e308, 9007199254740993.0):
+      s.check_equal(run_dtof(v)[0], (Decimal(repr(v)), v), f"dtof/ftod round-trips {v!r}")
+    s.check_equal(run_ftod(str(wide.divide(wide.multiply(Decimal(5e-324), 3), 2)))[0],
+                  (True, 1e-323), "ftod breaks the tie at the smallest subnormals to even")
+    s.check_equal(run_ftod("9007199254740993")[0], (True, 9007199254740992.0), "ftod breaks an integer tie to even")
+    s.check_equal(run_ftod("1.7976931348623158e308")[0], (True, 1.7976931348623157e308), "ftod keeps values just above DBL_MAX finite")
+    s.check_equal(run_ftod("1.797693134862315808e308")[0], (False, math.inf), "ftod reports overflow past DBL_MAX + ulp / 2")
+    under = run_ftod("-1e-400")[0]
+    s.check_equal((under, math.copysign(1.0, under[1])), ((True, 0.0), -1.0), "ftod underflows to a signed zero")
+    s.check_equal(run_dtof_short(1.005, 3)[0], Decimal("1.00"), "dtof rounds the double below 1.005 down at 3 digits")
+    s.check_equal(run_dtof_short(0.125, 2)[0], Decimal("0.13"), "dtof rounds an exact binary tie half up")
+    s.check_equal(run_dtof_short(5e-324, 16)[0], Context(prec=16).plus(Decimal(5e-324)), "dtof expands the smallest subnormal exactly")
+    s.check_equal(run_dtof_short(1.7976931348623157e308, 16)[0], Decimal("1.797693134862316e308"), "dtof expands DBL_MAX exactly")
+    ax = AXP_Float()
+    s.check(not axp_dtof(byref(ctx), math.inf, byref(ax)) and ctx.err == AXP_ERR_OVERFLOW, "dtof rejects infinity")
+    s.check(not axp_dtof(byref(ctx), math.nan, byref(ax)) and ctx.err == AXP_ERR_OVERFLOW, "dtof rejects NaN")
+    s.check_equal(_i64tof(-2 ** 63, 40), Decimal(-2 ** 63), "i64tof converts INT64_MIN exactly")
+    s.check_equal(_i64tof(2 ** 63 - 1, 16), Decimal("9.223372036854776e18"), "i64tof rounds to the context precision")
+    s.check_equal([_ftoi64(v) for v in ("2.5", "-2.5", "2.49", "-0.4", "1e5", "9223372036854775807")],
+                  [3, -3, 2, 0, 100000, 2 ** 63 - 1], "ftoi64 rounds half away from zero")
+    s.check_equal([_ftoi64(v) for v in ("-9223372036854775808", "-9223372036854775808.5", "9223372036854775807.5", "1e30")],
+                  [-2 ** 63, AXP_ERR_OVERFLOW, AXP_ERR_OVERFLOW, AXP_ERR_OVERFLOW], "ftoi64 reports values outside int64_t")
+
+    # Batch parsing shares one digit slab between all values of a column
+    column = [gen_randomf(20, 10) for _ in range(1000)]
+    text = ("\n".join(column) + "\n").encode()
+    s.check_equal(_atof_batch(text, b"\n"), _atof_each(column), "atof_batch parses a newline separated column like atof")
+    before, after = AXP_CtxStats(), AXP_CtxStats()
+    arr = AXP_FloatArray()
+    axp_ctx_stats_get(byref(ctx), byref(before))
+    axp_atof_batch(byref(ctx), text, len(text), b"\n", byref(arr))
+    axp_ctx_stats_get(byref(ctx), byref(after))
+    s.check_equal((arr.count, after.alloc_count - before.alloc_count), (1000, 2), "atof_batch allocates twice for the whole column")
+    axp_float_array_free(byref(ctx), byref(arr))
+    s.check_equal(_atof_batch(b"1.5\r\n-2\r\n 3e2 \r\n", b"\n"), _atof_each(["1.5", "-2", "300"]), "atof_batch tolerates CRLF line ends")
+    s.check_equal(_atof_batch(b"0.12345678901234567890,00,-0"), _atof_each(["0.12345678901234567890", "0", "-0"]),
+                  "atof_batch rounds to the context precision and keeps zeros")
+    s.check_equal(_atof_batch(b""), [], "atof_batch accepts an empty buffer")
+    s.check(_atof_batch(b"1,2,x,4") is None and ctx.err == AXP_ERR_PARSE and "value 2" in err_str(ctx),
+            "atof_batch reports which value failed to parse")
+    s.check(_atof_batch(b"1,,3") is None and ctx.err == AXP_ERR_PARSE, "atof_batch rejects an empty field")
+
+    # Views borrow the digits of unpacked records straight from a mapped file
+    values = ["3." + "14159265358979323846" * 50, "-2.5e-300", "1e400"]
+    table = b""
+    for v in values:
+      ax = str_to_axpf(new_ctx(precision=1001), v)
+      table += _serialize(lambda x, b, n: axp_serializef_ex(x, b, n, AXP_SERIAL_UNPACKED), ax)
+      axp_freef(byref(ax))
+    table += _serialize(lambda x, b, n: axp_serializei_ex(x, b, n, AXP_SERIAL_UNPACKED), int_to_axpi(ctx, -10 ** 40 - 7))
+    with tempfile.NamedTemporaryFile("wb", delete=False) as f:
+      f.write(table)
+    mapping = AXP_Mapping()
+    s.check(axp_map_file(byref(ctx), f.name.encode(), byref(mapping)), "axp_map_file maps a table of serialized numbers")
+    os.unlink(f.name)
+    views, offset = [], 0
+    for _ in values:
+      view = AXP_FloatView()
+      used = axp_viewf(byref(ctx), mapping.data + offset, mapping.size - offset, byref(view))
+      views.append(view)
+      offset += used
+    iview = AXP_IntView()
+    offset += axp_viewi(byref(ctx), mapping.data + offset, mapping.size - offset, byref(iview))
+    s.check_equal(offset, mapping.size, "viewf/viewi walk every record of the mapping")
+    s.check_equal([axpf_to_str(ctx, v.value) for v in views], ["3." + "14159265358979323846" * 50, "-2.5e-300", "1.0e+400"],
+                  "ftoa reads views in place")
+    s.check_equal(axpi_to_int(iview.value), -10 ** 40 - 7, "an integer view reads back in place")
+    r, cmp = AXP_Float(), c_int8()
+    axp_addf(byref(ctx), byref(views[0].value), byref(views[0].value), byref(r))
+    s.check_equal(axpf_to_str(ctx, r), "6.283185307179586", "a view can be an add operand")
+    axp_freef(byref(r))
+    axp_cmpf(byref(ctx), byref(views[1].value), byref(views[2].value), byref(cmp))
+    s.check_equal(cmp.value, -1, "views compare without copying")
+    packed = _serialize(axp_serializei, int_to_axpi(ctx, 5))
+    s.check_equal(axp_viewi(byref(ctx), packed, len(packed), byref(AXP_IntView())), 0, "packed records cannot be viewed")
+    axp_unmap_file(byref(mapping))
+
+    # Streaming parsers read in 64 KiB chunks, so long inputs cross several chunk boundaries
+    huge = int("9" + "".join(random.choice("0123456789") for _ in range(200_000)))
+    s.check_equal(run_atoi_fd(huge)[0], huge, "atoi_fd parses a 200001-digit integer across chunk boundaries")
+    s.check_equal(run_atoi_fd(-huge, use_stream=True)[0], -huge, "atoi_stream parses a negative 200001-digit integer")
+    s.check_equal(run_atoi_fd("12 34\t56")[0], 123456, "atoi_fd skips whitespace between digits")
+    s.check_equal(run_atoi_fd("12x")[0], None, "atoi_fd rejects a non-digit")
+    s.check_equal(run_atoi_fd("")[0], None, "atoi_fd rejects an empty file")
+    s.check_equal(ctx.err, AXP_ERR_PARSE, "atoi_fd reports an empty file as AXP_ERR_PARSE")
+    long_mantissa = "0.000" + "31415926535" * 10_000 + "e-7"
+    got, expected, _ = run_atof_fd(long_mantissa)
+    s.check_equal(got, expected, "atof_fd rounds a 110000-digit mantissa to the context precision")
+    got, expected, _ = run_atof_fd("-1 234.567 890 123 456 789e+12", use_stream=True)
+    s.check_equal(got, expected, "atof_stream parses a spaced value with an exponent")
+    s.check_equal(run_atof_fd("1.2.3")[0], None, "atof_fd rejects multiple decimal points")
+    s.check_equal(run_atof_fd("1e")[0], None, "atof_fd rejects a missing exponent")
+    ok = axp_atoi_fd(byref(ctx), -1, byref(AXP_Int()))
+    s.check(not ok and ctx.err == AXP_ERR_READ, "atoi_fd reports a bad descriptor as AXP_ERR_READ")
+
     # axp_ftoa_ex: REGULAR always fixed-point, even for extreme exponents.
     def regular(x_str):
       ax = str_to_axpf(ctx, x_str)
@@ -110,6 +451,13 @@ def run(report):
     s.check_equal(scientific("5"), "5.0e+0", "SCIENTIFIC always shows a fractional digit, even for a single-digit mantissa")
     s.check_equal(scientific("-0.001"), "-1.0e-3", "SCIENTIFIC switches to e-notation even for a 'small but normal' value")
     s.check_equal(scientific("0.0"), "0.0", "SCIENTIFIC still renders zero as 0.0 (no meaningful exponent)")
+    for e in (9, 10, 99, 100, 101, 12345, 987654321, -7, -10, -100, -4321, -123456789012):
+      s.check_equal(scientific(f"2.5e{e}"), f"2.5e{e:+d}", f"SCIENTIFIC formats the exponent {e} like %+lld")
+    wide_digits = "1" + "23456789" * 12
+    wide = str_to_axpf(new_ctx(precision=100), wide_digits + "e-50")
+    s.check_equal(axpf_to_str_ex(wide, AXP_FTOA_REGULAR), wide_digits[:47] + "." + wide_digits[47:],
+                  "REGULAR emits both sides of the decimal point of a wide value")
+    axp_freef(byref(wide))
 
     # axp_ftoa_ex: AUTO picks REGULAR or SCIENTIFIC based on padding-zero count.
     def auto(x_str):
@@ -126,6 +474,22 @@ def run(report):
 
     s.fuzz("random_itoa_roundtrip", 20_000, lambda: [gen_randomi(200)], run_itoa_roundtrip)
     s.fuzz("random_ftoa_roundtrip", 20_000, lambda: [gen_randomf(50, 30)], run_ftoa_roundtrip)
+    s.fuzz("random_atof_spaced", 5_000, lambda: [gen_randomf(50, 30)], run_atof_spaced)
+    s.fuzz("random_itoa_write", 5_000, lambda: [gen_randomi(200)], run_itoa_write)
+    s.fuzz(
+      "random_ftoa_write", 5_000,
+      lambda: (gen_randomf(50, 30), random.choice([AXP_FTOA_REGULAR, AXP_FTOA_SCIENTIFIC, AXP_FTOA_AUTO])),
+      run_ftoa_write,
+    )
+    s.fuzz("random_serializei", 5_000, lambda: [gen_randomi(300)], run_serializei)
+    s.fuzz("random_serializef", 5_000, lambda: [gen_randomf(50, 30)], run_serializef)
+    s.fuzz("random_serializei_unpacked", 2_000, lambda: [gen_randomi(300)], lambda x: run_serializei(x, AXP_SERIAL_UNPACKED))
+    s.fuzz("random_dtof", 20_000, lambda: [gen_random_double()], run_dtof)
+    s.fuzz("random_dtof_short", 5_000, lambda: (gen_random_double(), random.randint(1, 16)), run_dtof_short)
+    s.fuzz("random_ftod_near_halfway", 5_000, lambda: [gen_near_halfway()], run_ftod)
+    s.fuzz("random_atof_batch", 2_000, lambda: [[gen_randomf(50, 30) for _ in range(random.randint(1, 40))]], run_atof_batch)
+    s.fuzz("random_atoi_fd", 1_000, lambda: [gen_randomi(500)], run_atoi_fd)
+    s.fuzz("random_atof_fd", 1_000, lambda: [gen_randomf(50, 30)], run_atof_fd)
     s.fuzz(
       "random_ftoa_ex_roundtrip", 20_000,
       lambda: (gen_randomf(50, 30), random.choice([AXP_FTOA_REGULAR, AXP_FTOA_SCIENTIFIC, AXP_FTOA_AUTO])),
@@ -7,7 +7,7 @@ from ctypes import byref
 import framework
 from axp_bindings import (
   AXP_Int, AXP_Float, new_ctx, AXP_ERR_DIV_ZERO, AXP_ERR_PARSE,
-  axp_addi, axp_divi, axp_powi, axp_divf, axp_powf, axp_lnf, axp_powff,
+  axp_addi, axp_divi, axp_powi, axp_powmodi, axp_divf, axp_powf, axp_lnf, axp_powff,
   axp_atoi, axp_atof, axp_freei, axp_freef, err_name, err_str,
   int_to_axpi, str_to_axpf,
 )
@@ -34,6 +34,16 @@ def run(report):
     _expect_div_zero(s, ok, "axp_powi(0, 0) fails with AXP_ERR_DIV_ZERO")
     axp_freei(byref(x))
 
+    # modular power with a zero modulus or a negative exponent
+    b, e, m, r = int_to_axpi(ctx, 3), int_to_axpi(ctx, 5), int_to_axpi(ctx, 0), AXP_Int()
+    ok = axp_powmodi(byref(ctx), byref(b), byref(e), byref(m), byref(r))
+    _expect_div_zero(s, ok, "axp_powmodi(3, 5, 0) fails with AXP_ERR_DIV_ZERO")
+    axp_freei(byref(m))
+    e, m = int_to_axpi(ctx, -5), int_to_axpi(ctx, 7)
+    ok = axp_powmodi(byref(ctx), byref(b), byref(e), byref(m), byref(r))
+    _expect_div_zero(s, ok, "axp_powmodi(3, -5, 7) fails with AXP_ERR_DIV_ZERO")
+    axp_freei(byref(b)); axp_freei(byref(e)); axp_freei(byref(m))
+
     # float division by zero
     x, y, r = str_to_axpf(ctx, "10.0"), str_to_axpf(ctx, "0.0"), AXP_Float()
     ok = axp_divf(byref(ctx), byref(x), byref(y), byref(r))
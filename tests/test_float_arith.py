@@ -1,12 +1,19 @@
 import random
-from ctypes import byref
+from ctypes import byref, c_int8, c_size_t
 from decimal import Decimal, getcontext, ROUND_HALF_UP
 
 import framework
-from axp_bindings import AXP_Float, new_ctx, axp_addf, axp_subf, axp_mulf, axp_divf, axp_powf, axp_freef, str_to_axpf, axpf_to_str
-from helpers import gen_randomf
+from axp_bindings import (AXP_Float, new_ctx, axp_addf, axp_subf, axp_mulf, axp_divf, axp_powf,
+  axp_sqrtf, axp_rsqrtf, axp_rootf, axp_cmpf, axp_abs_cmpf, axp_freef, str_to_axpf, axpf_to_str,
+  AXP_FloatArray, AXP_CtxStats, AXP_ERR_SIZE, axp_ctx_stats_get, axp_float_array_init, axp_float_array_at,
+  axp_float_array_free, axp_float_array_addf, axp_float_array_addf_scalar, axp_float_array_mulf_scalar,
+  axp_float_array_sumf, axp_float_array_minmaxf, axp_float_array_cmpf, axp_float_array_cmpf_scalar)
+from helpers import gen_randomf, gen_randomi
 
 ctx = new_ctx(precision=16)
+long_ctx = new_ctx(precision=1000)
+retry_ctx = new_ctx(precision=16)
+retry_ctx.ziv_safety_digits = 1  # most attempts are ambiguous, retries resume the exact powers of x
 _REF_GUARD_PREC = 50
 
 def _correctly_rounded(compute, target_prec):
@@ -32,6 +39,17 @@ def run_add(x_str, y_str):
   expected = _binop_expected(x_str, y_str, lambda a, b: a + b)
   return got, expected, f"{x_str} + {y_str}"
 
+def run_cmp(x_str, y_str):
+  ax, ay, res, abs_res = str_to_axpf(ctx, x_str), str_to_axpf(ctx, y_str), c_int8(), c_int8()
+  axp_cmpf(byref(ctx), byref(ax), byref(ay), byref(res))
+  axp_abs_cmpf(byref(ctx), byref(ax), byref(ay), byref(abs_res))
+  axp_freef(byref(ax)); axp_freef(byref(ay))
+  getcontext().prec = ctx.precision
+  getcontext().rounding = ROUND_HALF_UP
+  x, y = +Decimal(x_str), +Decimal(y_str)
+  sgn = lambda a, b: (a > b) - (a < b)
+  return (res.value, abs_res.value), (sgn(x, y), sgn(abs(x), abs(y))), f"cmp({x_str}, {y_str})"
+
 def run_sub(x_str, y_str):
   ax, ay, ar = str_to_axpf(ctx, x_str), str_to_axpf(ctx, y_str), AXP_Float()
   axp_subf(byref(ctx), byref(ax), byref(ay), byref(ar))
@@ -64,6 +82,140 @@ def run_pow(x_str, y):
   expected = _correctly_rounded(lambda: Decimal(x_str) ** int(y), ctx.precision)
   return got, expected, f"{x_str} ** {y}"
 
+def run_pow_retry(x_str, y):
+  ax, ar = str_to_axpf(retry_ctx, x_str), AXP_Float()
+  axp_powf(byref(retry_ctx), byref(ax), y, byref(ar))
+  got = Decimal(axpf_to_str(retry_ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: Decimal(x_str) ** int(y), retry_ctx.precision)
+  return got, expected, f"{x_str} ** {y} with retries"
+
+def run_sqrt(x_str):
+  ax, ar = str_to_axpf(ctx, x_str), AXP_Float()
+  axp_sqrtf(byref(ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: Decimal(x_str).sqrt(), ctx.precision)
+  return got, expected, f"sqrt({x_str})"
+
+def run_rsqrt(x_str):
+  ax, ar = str_to_axpf(ctx, x_str), AXP_Float()
+  axp_rsqrtf(byref(ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: 1 / Decimal(x_str).sqrt(), ctx.precision)
+  return got, expected, f"1/sqrt({x_str})"
+
+def _decimal_root(x, n):
+  # Newton on r^n = |x| in the current Decimal context, seeded from the float root
+  a = abs(x)
+  r = Decimal(repr(float(a) ** (1.0 / n))) if 1e-300 < a < 1e300 else (a.ln() / n).exp()
+  for _ in range(200):
+    nxt = ((n - 1) * r + a / r ** (n - 1)) / n
+    if nxt == r: break
+    r = nxt
+  return -r if x < 0 else r
+
+def run_root(x_str, n):
+  ax, ar = str_to_axpf(ctx, x_str), AXP_Float()
+  axp_rootf(byref(ctx), byref(ax), n, byref(ar))
+  got = Decimal(axpf_to_str(ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: _decimal_root(Decimal(x_str), n), ctx.precision)
+  return got, expected, f"root({x_str}, {n})"
+
+def run_root_long(x_str, kind, precision):
+  # kind is "sqrt", "rsqrt" or the degree of the root
+  long_ctx.precision = precision
+  ax, ar = str_to_axpf(long_ctx, x_str), AXP_Float()
+  x_str = axpf_to_str(long_ctx, ax)
+  if kind == "sqrt": axp_sqrtf(byref(long_ctx), byref(ax), byref(ar))
+  elif kind == "rsqrt": axp_rsqrtf(byref(long_ctx), byref(ax), byref(ar))
+  else: axp_rootf(byref(long_ctx), byref(ax), kind, byref(ar))
+  got = Decimal(axpf_to_str(long_ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  reference = {"sqrt": lambda: Decimal(x_str).sqrt(), "rsqrt": lambda: 1 / Decimal(x_str).sqrt()}.get(kind, lambda: _decimal_root(Decimal(x_str), kind))
+  expected = _correctly_rounded(reference, precision)
+  return got, expected, f"{kind} root of {x_str[:40]}... at {precision} digits"
+
+def gen_root_long_arg():
+  precision = random.choice([1000, 1005, 2000])
+  digits = "".join(random.choice("0123456789") for _ in range(random.choice([3, precision - 1, 2 * precision])))
+  kind = random.choice(["sqrt", "rsqrt", 3, 7])
+  sign = "-" if kind in (3, 7) and random.random() < 0.5 else ""
+  return (f"{sign}{random.randint(1, 9)}.{digits}e{random.randint(-50, 50)}", kind, precision)
+
+def _to_array(strs):
+  floats = (AXP_Float * len(strs))(*[str_to_axpf(ctx, v) for v in strs])
+  arr = AXP_FloatArray()
+  axp_float_array_init(byref(ctx), byref(arr), floats, len(strs))
+  for f in floats: axp_freef(byref(f))
+  return arr
+
+def _from_array(arr):
+  return [Decimal(axpf_to_str(ctx, axp_float_array_at(byref(arr), i).value)) for i in range(arr.count)]
+
+def _rounded(strs):
+  getcontext().prec = ctx.precision
+  getcontext().rounding = ROUND_HALF_UP
+  return [+Decimal(v) for v in strs]
+
+def run_array_add(xs, ys):
+  ax, ay, ar = _to_array(xs), _to_array(ys), AXP_FloatArray()
+  axp_float_array_addf(byref(ctx), byref(ax), byref(ay), byref(ar))
+  got = _from_array(ar)
+  for arr in (ax, ay, ar): axp_float_array_free(byref(ctx), byref(arr))
+  return got, [_binop_expected(x, y, lambda a, b: a + b) for x, y in zip(xs, ys)], f"array_addf({xs}, {ys})"
+
+def run_array_scalar(xs, s_str, mul):
+  ax, ar, sc = _to_array(xs), AXP_FloatArray(), str_to_axpf(ctx, s_str)
+  (axp_float_array_mulf_scalar if mul else axp_float_array_addf_scalar)(byref(ctx), byref(ax), byref(sc), byref(ar))
+  got = _from_array(ar)
+  axp_float_array_free(byref(ctx), byref(ax)); axp_float_array_free(byref(ctx), byref(ar)); axp_freef(byref(sc))
+  op = (lambda a, b: a * b) if mul else (lambda a, b: a + b)
+  return got, [_binop_expected(x, s_str, op) for x in xs], f"array_{'mul' if mul else 'add'}f_scalar({xs}, {s_str})"
+
+def run_array_sum(xs):
+  ax, ar = _to_array(xs), AXP_Float()
+  axp_float_array_sumf(byref(ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(ctx, ar))
+  axp_float_array_free(byref(ctx), byref(ax)); axp_freef(byref(ar))
+  terms = _rounded(xs)
+  getcontext().prec = 1000
+  exact = sum(terms, Decimal(0))
+  getcontext().prec = ctx.precision
+  return got, +exact, f"array_sumf({xs})"
+
+def run_array_order(xs, ys):
+  ax, ay = _to_array(xs), _to_array(ys)
+  lo, hi = c_size_t(), c_size_t()
+  cmp, cmp_scalar = (c_int8 * len(xs))(), (c_int8 * len(xs))()
+  axp_float_array_minmaxf(byref(ctx), byref(ax), byref(lo), byref(hi))
+  axp_float_array_cmpf(byref(ctx), byref(ax), byref(ay), cmp)
+  pivot = str_to_axpf(ctx, ys[0])
+  axp_float_array_cmpf_scalar(byref(ctx), byref(ax), byref(pivot), cmp_scalar)
+  axp_freef(byref(pivot))
+  axp_float_array_free(byref(ctx), byref(ax)); axp_float_array_free(byref(ctx), byref(ay))
+  x, y = _rounded(xs), _rounded(ys)
+  sgn = lambda a, b: (a > b) - (a < b)
+  got = (x[lo.value], x[hi.value], list(cmp), list(cmp_scalar))
+  return got, (min(x), max(x), [sgn(a, b) for a, b in zip(x, y)], [sgn(a, y[0]) for a in x]), f"array_order({xs}, {ys})"
+
+def _gen_wide_sum():
+  # Far apart magnitudes that partly cancel, so the sum is decided by values far below the largest ones
+  vals = []
+  for _ in range(random.randint(1, 8)):
+    digits = str(random.randint(1, 10**random.randint(1, 20)))
+    v = f"{random.choice(['', '-'])}{digits}e{random.randint(-400, 400)}"
+    vals += [v] * random.randint(1, 2)
+    if random.random() < 0.5: vals.append(v[1:] if v[0] == "-" else "-" + v)
+  random.shuffle(vals)
+  return (vals,)
+
+def _gen_columns(n_cols):
+  n = random.randint(1, 30)
+  return [[gen_randomf(30, 20) for _ in range(n)] for _ in range(n_cols)]
+
 def run(report):
   with framework.Suite("float_arith", report) as s:
     # edge cases
@@ -74,10 +226,17 @@ def run(report):
     s.check_equal(run_mul("1.0", "42.5")[0], Decimal("42.5"), "1.0 * n = n")
     s.check_equal(run_div("0.0", "5.0")[0], Decimal("0.0"), "0.0 / n = 0.0")
     s.check_equal(run_div("1.0", "3.0")[0], _correctly_rounded(lambda: Decimal(1) / Decimal(3), 16), "1/3 rounds correctly at precision boundary")
+    got, expected, _ = run_div("123456789012345678901234.0", "7.0")
+    s.check_equal(got, expected, "dividend longer than the working precision keeps its exponent")
     s.check_equal(run_pow("5.0", 0)[0], Decimal("1.0"), "x^0 = 1.0")
     s.check_equal(run_pow("0.0", 5)[0], Decimal("0.0"), "0.0^n = 0.0 for positive n")
     s.check_equal(run_pow("2.0", -3)[0], Decimal("0.125"), "negative exponent takes the reciprocal")
     s.check_equal(run_pow("-2.0", 3)[0], Decimal("-8.0"), "negative base, odd exponent -> negative")
+    s.check_equal(run_pow("100.0", 1000000)[0], Decimal("1e2000000"), "power of ten only moves the exponent")
+    s.check_equal(run_pow("-0.001", -3)[0], Decimal("-1e9"), "negative power of ten with a negative exponent")
+    for x_str, y in (("1.000000001", 123456789), ("0.9999999999", -40000000), ("3.0", 16777217)):
+      got, expected, desc = run_pow(x_str, y)
+      s.check_equal(got, expected, f"{desc} matches reference")
 
     # exact half-way rounding tie (round-half-up): "1.0000000000000005" has
     # exactly 17 significant digits with the 17th being a 5, so at
@@ -85,8 +244,82 @@ def run(report):
     got, expected, _ = run_add("1.0000000000000005", "0.0")
     s.check_equal(got, Decimal("1.000000000000001"), "half-way tie rounds up at the target precision")
 
+    # roots
+    s.check_equal(run_sqrt("0.0")[0], Decimal(0), "sqrt(0) = 0")
+    s.check_equal(run_sqrt("16.0")[0], Decimal(4), "sqrt of a perfect square is exact")
+    s.check_equal(run_sqrt("1.5625e-40")[0], Decimal("1.25e-20"), "sqrt of a small exact square")
+    s.check_equal(run_rsqrt("0.25")[0], Decimal(2), "1/sqrt(0.25) = 2 exactly")
+    for x_str, root in (("1e-100", "1e-50"), ("2.25e-100", "1.5e-50"), ("1e-150", "1e-75"), ("4e-400", "2e-200"), ("9e300", "3e150")):
+      s.check_equal(run_sqrt(x_str)[0], Decimal(root), f"sqrt({x_str}) of an exact square far from 1")
+    s.check_equal(run_root("-27.0", 3)[0], Decimal(-3), "odd root of a negative number keeps the sign")
+    s.check_equal(run_root("1e300", 7)[0], _correctly_rounded(lambda: _decimal_root(Decimal("1e300"), 7), 16), "7th root of 1e300")
+    for x_str, n in (("2.0", 2), ("10.0", 3), ("0.5", 5), ("123456.789", 12)):
+      got, expected, desc = run_root(x_str, n)
+      s.check_equal(got, expected, f"{desc} matches reference")
+    root = 10 ** 332 + 1
+    s.check_equal(run_root_long(f"{root ** 2}e-664", "sqrt", 1000)[0], Decimal(f"{root}e-332"), "sqrt of a 665 digit exact square")
+    s.check_equal(run_root_long(f"{root ** 3}e-996", 3, 1000)[0], Decimal(f"{root}e-332"), "cube root of a 997 digit exact cube")
+    ax, ar = str_to_axpf(ctx, "-4.0"), AXP_Float()
+    s.check(not axp_sqrtf(byref(ctx), byref(ax), byref(ar)), "sqrt of a negative number is rejected")
+    axp_freef(byref(ax))
+
+    s.check_equal(run_cmp("1.50", "1.5")[0], (0, 0), "cmpf ignores trailing zeros")
+    s.check_equal(run_cmp("-0.0", "0")[0], (0, 0), "cmpf treats -0 as 0")
+    s.check_equal(run_cmp("-2", "1")[0], (-1, 1), "cmpf orders by sign before magnitude")
+    s.check_equal(run_cmp("0.001", "999e-6")[0], (1, 1), "cmpf compares across different exponents")
+    # struct-of-arrays kernels
+    s.check_equal(run_array_add(["1.5", "0.0", "-2"], ["-1.5", "1e-30", "-1e30"])[0], [Decimal(0), Decimal("1e-30"), Decimal("-1e30")],
+                  "array_addf cancels, keeps tiny and huge addends")
+    s.check_equal(run_array_add(["1e20"], ["-0.000000000000000000000001"])[0], [Decimal("1e20")],
+                  "array_addf rounds back up past a borrow far below the kept digits")
+    s.check_equal(run_array_add(["9999999999999999"], ["0.5"])[0], [Decimal("1e16")], "array_addf carries into a new digit")
+    s.check_equal(run_array_scalar(["1.25", "-3"], "0", True)[0], [Decimal(0), Decimal(0)], "array_mulf_scalar by zero")
+    s.check_equal(run_array_sum([])[0], Decimal(0), "array_sumf of an empty array is zero")
+    col = _to_array([str(v) for v in range(1000)])
+    before, after, res = AXP_CtxStats(), AXP_CtxStats(), AXP_FloatArray()
+    axp_ctx_stats_get(byref(ctx), byref(before))
+    axp_float_array_addf(byref(ctx), byref(col), byref(col), byref(res))
+    axp_ctx_stats_get(byref(ctx), byref(after))
+    s.check_equal(after.alloc_count - before.alloc_count, 3, "array_addf allocates the result and one scratch buffer, not per value")
+    axp_float_array_free(byref(ctx), byref(res))
+    short = _to_array(["1"])
+    s.check(not axp_float_array_addf(byref(ctx), byref(col), byref(short), byref(res)) and ctx.err == AXP_ERR_SIZE,
+            "array_addf rejects arrays of different lengths")
+    empty = AXP_FloatArray()
+    s.check(not axp_float_array_minmaxf(byref(ctx), byref(empty), None, None) and ctx.err == AXP_ERR_SIZE,
+            "array_minmaxf rejects an empty array")
+    axp_float_array_free(byref(ctx), byref(col)); axp_float_array_free(byref(ctx), byref(short))
+    s.fuzz("random_array_add", 2_000, lambda: _gen_columns(2), run_array_add)
+    s.fuzz("random_array_add_scalar", 2_000, lambda: (_gen_columns(1)[0], gen_randomf(30, 20), False), run_array_scalar)
+    s.fuzz("random_array_mul_scalar", 2_000, lambda: (_gen_columns(1)[0], gen_randomf(30, 20), True), run_array_scalar)
+    s.fuzz("random_array_sum", 2_000, lambda: _gen_columns(1), run_array_sum)
+    s.fuzz("random_array_sum_wide", 2_000, _gen_wide_sum, run_array_sum)
+    s.check_equal(run_array_sum(["1e400", "5e384", "-1e-400", "-1e400", "1e384"])[0], Decimal("6.000000000000000e384"),
+                  "array_sumf keeps values left after the largest ones cancel")
+    s.check_equal(run_array_sum(["1e400", "5e384", "-1e-400"])[0], Decimal("1e400"),
+                  "array_sumf rounds down a half lowered by a value far below it")
+    s.check_equal(run_array_sum(["1e400", "5e384", "1e-400"])[0], Decimal("1.000000000000001e400"),
+                  "array_sumf rounds up a half raised by a value far below it")
+    s.fuzz("random_array_order", 2_000, lambda: _gen_columns(2), run_array_order)
+    s.fuzz("random_cmp", 10_000, lambda: (gen_randomf(50, 30), gen_randomf(50, 30)), run_cmp)
+    s.fuzz("random_cmp_close", 5_000, lambda: (lambda x: (x, random.choice([x, x + "1", "-" + x.lstrip("-"), x + "0"])))(gen_randomf(20, 10)), run_cmp)
     s.fuzz("random_add", 20_000, lambda: (gen_randomf(50, 30), gen_randomf(50, 30)), run_add)
     s.fuzz("random_sub", 20_000, lambda: (gen_randomf(50, 30), gen_randomf(50, 30)), run_sub)
     s.fuzz("random_mul", 20_000, lambda: (gen_randomf(50, 30), gen_randomf(50, 30)), run_mul)
     s.fuzz("random_div", 20_000, lambda: (gen_randomf(50, 30), gen_randomf(50, 30, only_pos=True)), run_div)
     s.fuzz("random_pow", 20_000, lambda: (gen_randomf(5, 30), random.randint(-1000, 1000)), run_pow)
+    for x_str, y in (("-0.902", -15), ("-0.000000000000037", -26), ("-0.0646", -29), ("-0.0000000000000000030004", -7),
+                     ("-44.734", -427), ("77000000.0", -679), ("-124800000000.0", -286)):
+      got, expected, desc = run_pow_retry(x_str, y)
+      s.check_equal(got, expected, f"{desc} resumes the exact powers of x")
+    s.fuzz("random_pow_retry", 3_000, lambda: (gen_randomf(5, 30), random.randint(-1000, 1000)), run_pow_retry)
+    s.fuzz("random_pow_large_exp", 500, lambda: ("1." + "0" * random.randint(6, 9) + str(random.randint(1, 999)), random.randint(-2 ** 30, 2 ** 30)), run_pow)
+    s.fuzz("random_sqrt", 10_000, lambda: [gen_randomf(16, 60, only_pos=True)], run_sqrt)
+    s.fuzz("random_sqrt_exact", 2_000, lambda: [format(Decimal(random.randint(1, 10 ** 8)) ** 2 * Decimal(10) ** random.randint(-20, 20), 'f')], run_sqrt)
+    s.fuzz("random_sqrt_exact_wide", 2_000, lambda: [f"{random.randint(1, 10 ** 8) ** 2}e{2 * random.randint(-800, 800)}"], run_sqrt)
+    s.fuzz("random_sqrt_wide", 2_000, lambda: [f"{gen_randomi(16, True)}e{random.randint(-1600, 1600)}"], run_sqrt)
+    s.fuzz("random_rsqrt_wide", 2_000, lambda: [f"{gen_randomi(16, True)}e{random.randint(-1600, 1600)}"], run_rsqrt)
+    s.fuzz("random_root_wide", 2_000, lambda: (f"{gen_randomi(16)}e{random.randint(-1600, 1600)}", random.choice([3, 5, 7])), run_root)
+    s.fuzz("random_rsqrt", 5_000, lambda: [gen_randomf(16, 60, only_pos=True)], run_rsqrt)
+    s.fuzz("random_root_long", 24, gen_root_long_arg, run_root_long)
+    s.fuzz("random_root", 5_000, lambda: (gen_randomf(16, 60), random.choice([1, 3, 5, 7, 9, 31])), run_root)
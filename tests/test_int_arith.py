@@ -1,8 +1,12 @@
+import math
 import random
-from ctypes import byref
+from ctypes import byref, c_int8
 
 import framework
-from axp_bindings import AXP_Int, new_ctx, axp_addi, axp_subi, axp_muli, axp_divi, axp_powi, axp_freei, int_to_axpi, axpi_to_int
+from axp_bindings import (AXP_Int, new_ctx, axp_addi, axp_subi, axp_muli, axp_divi, axp_powi, axp_isqrti, axp_modi, axp_powmodi,
+                          axp_gcdi, axp_lcmi, axp_gcdexti, axp_factoriali, axp_binomiali, axp_primoriali,
+                          axp_rising_factoriali, axp_cmpi, axp_abs_cmpi, axp_freei, int_to_axpi, axpi_to_int,
+                          AXP_MUL_LIMB_THRESHOLD, AXP_MUL_KARATSUBA_LIMBS)
 from helpers import gen_randomi, gen_nonzero_int
 
 ctx = new_ctx(precision=16)
@@ -21,6 +25,23 @@ def run_sub(x, y):
   axp_freei(byref(ax)); axp_freei(byref(ay)); axp_freei(byref(ar))
   return got, x - y, f"{x} - {y}"
 
+def _mul_tier_operand(digits):
+  # Random digits, all nines for the longest carry chains, or sparse so whole limbs are zero
+  kind = random.choice(["random", "nines", "sparse"])
+  if kind == "nines": v = 10 ** digits - 1
+  elif kind == "sparse": v = 10 ** (digits - 1) + sum(random.randint(1, 9) * 10 ** random.randrange(digits) for _ in range(3))
+  else: v = random.randint(10 ** (digits - 1), 10 ** digits - 1)
+  return -v if random.randint(0, 1) else v
+
+def gen_mul_tier_arg():
+  # Operand lengths next to the digit/limb and schoolbook/Karatsuba boundaries, several Karatsuba levels and
+  # unbalanced products that go through the sliced path
+  k = AXP_MUL_KARATSUBA_LIMBS * 8
+  sizes = [AXP_MUL_LIMB_THRESHOLD - 1, AXP_MUL_LIMB_THRESHOLD, AXP_MUL_LIMB_THRESHOLD + 1, k - 1, k, k + 1, 2 * k + 3, 9 * k + 5]
+  x_sz = random.choice(sizes)
+  y_sz = random.choice(sizes + [x_sz * random.randint(2, 7) + random.randint(0, 7)])
+  return (_mul_tier_operand(x_sz), _mul_tier_operand(y_sz))
+
 def run_mul(x, y):
   ax, ay, ar = int_to_axpi(ctx, x), int_to_axpi(ctx, y), AXP_Int()
   axp_muli(byref(ctx), byref(ax), byref(ay), byref(ar))
@@ -47,6 +68,91 @@ def run_pow(x, y):
   axp_freei(byref(ax)); axp_freei(byref(ar))
   return got, x ** y, f"{x} ^ {y}"
 
+def run_isqrt(x):
+  ax, ar = int_to_axpi(ctx, x), AXP_Int()
+  axp_isqrti(byref(ctx), byref(ax), byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ax)); axp_freei(byref(ar))
+  return got, math.isqrt(x), f"isqrt({x})"
+
+def run_mod(x, m):
+  ax, am, ar = int_to_axpi(ctx, x), int_to_axpi(ctx, m), AXP_Int()
+  axp_modi(byref(ctx), byref(ax), byref(am), byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ax)); axp_freei(byref(am)); axp_freei(byref(ar))
+  return got, x % abs(m), f"{x} mod {m}"
+
+def run_powmod(b, e, m):
+  ab, ae, am, ar = int_to_axpi(ctx, b), int_to_axpi(ctx, e), int_to_axpi(ctx, m), AXP_Int()
+  axp_powmodi(byref(ctx), byref(ab), byref(ae), byref(am), byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ab)); axp_freei(byref(ae)); axp_freei(byref(am)); axp_freei(byref(ar))
+  return got, pow(b, e, abs(m)), f"{b} ^ {e} mod {m}"
+
+def run_gcd(x, y):
+  ax, ay, ar = int_to_axpi(ctx, x), int_to_axpi(ctx, y), AXP_Int()
+  axp_gcdi(byref(ctx), byref(ax), byref(ay), byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ax)); axp_freei(byref(ay)); axp_freei(byref(ar))
+  return got, math.gcd(x, y), f"gcd({x}, {y})"
+
+def run_lcm(x, y):
+  ax, ay, ar = int_to_axpi(ctx, x), int_to_axpi(ctx, y), AXP_Int()
+  axp_lcmi(byref(ctx), byref(ax), byref(ay), byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ax)); axp_freei(byref(ay)); axp_freei(byref(ar))
+  return got, math.lcm(x, y), f"lcm({x}, {y})"
+
+def run_gcdext(x, y):
+  ax, ay, ag, as_, at = int_to_axpi(ctx, x), int_to_axpi(ctx, y), AXP_Int(), AXP_Int(), AXP_Int()
+  axp_gcdexti(byref(ctx), byref(ax), byref(ay), byref(ag), byref(as_), byref(at))
+  g, s, t = axpi_to_int(ag), axpi_to_int(as_), axpi_to_int(at)
+  axp_freei(byref(ax)); axp_freei(byref(ay)); axp_freei(byref(ag)); axp_freei(byref(as_)); axp_freei(byref(at))
+  # Bezout identity with the true gcd, not a particular (s, t) pair
+  return (g, s * x + t * y), (math.gcd(x, y), math.gcd(x, y)), f"gcdext({x}, {y})"
+
+def _primorial(n):
+  return math.prod(p for p in range(2, n + 1) if all(p % d for d in range(2, math.isqrt(p) + 1)))
+
+def _rising(x, n):
+  return math.prod(range(x, x + n))
+
+def run_factorial(n):
+  ar = AXP_Int()
+  axp_factoriali(byref(ctx), n, byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ar))
+  return got, math.factorial(n), f"{n}!"
+
+def run_binomial(n, k):
+  ar = AXP_Int()
+  axp_binomiali(byref(ctx), n, k, byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ar))
+  return got, math.comb(n, k), f"C({n}, {k})"
+
+def run_primorial(n):
+  ar = AXP_Int()
+  axp_primoriali(byref(ctx), n, byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ar))
+  return got, _primorial(n), f"{n}#"
+
+def run_rising(x, n):
+  ax, ar = int_to_axpi(ctx, x), AXP_Int()
+  axp_rising_factoriali(byref(ctx), byref(ax), n, byref(ar))
+  got = axpi_to_int(ar)
+  axp_freei(byref(ax)); axp_freei(byref(ar))
+  return got, _rising(x, n), f"rising({x}, {n})"
+
+def run_cmp(x, y):
+  ax, ay, res, abs_res = int_to_axpi(ctx, x), int_to_axpi(ctx, y), c_int8(), c_int8()
+  axp_cmpi(byref(ctx), byref(ax), byref(ay), byref(res))
+  axp_abs_cmpi(byref(ctx), byref(ax), byref(ay), byref(abs_res))
+  axp_freei(byref(ax)); axp_freei(byref(ay))
+  sgn = lambda a, b: (a > b) - (a < b)
+  return (res.value, abs_res.value), (sgn(x, y), sgn(abs(x), abs(y))), f"cmp({x}, {y})"
+
 def run(report):
   with framework.Suite("int_arith", report) as s:
     # edge cases
@@ -71,10 +177,78 @@ def run(report):
     s.check_equal(run_pow(-2, 3)[0], -8, "negative base, odd exponent -> negative")
     s.check_equal(run_pow(-2, 4)[0], 16, "negative base, even exponent -> positive")
     s.check_equal(run_pow(2, 64)[0], 2 ** 64, "pow beyond native int64 range")
+    s.check_equal(run_pow(10, 1000)[0], 10 ** 1000, "power of ten is a digit shift")
+    s.check_equal(run_pow(-1000, 333)[0], -(10 ** 999), "negative power of ten keeps an odd sign")
+    s.check_equal(run_pow(120, 77)[0], 120 ** 77, "trailing zeros of the base are shifted out")
+    s.check_equal(run_isqrt(0)[0], 0, "isqrt(0) = 0")
+    s.check_equal(run_isqrt(99)[0], 9, "isqrt rounds down below a perfect square")
+    s.check_equal(run_isqrt(100)[0], 10, "isqrt of a perfect square is exact")
+    s.check_equal(run_isqrt(10 ** 60 - 1)[0], 10 ** 30 - 1, "isqrt just below a large power of ten")
+    s.check_equal(run_mod(-7, 3)[0], 2, "mod of a negative number is the least non-negative residue")
+    s.check_equal(run_mod(7, -3)[0], 1, "mod uses the magnitude of a negative modulus")
+    s.check_equal(run_mod(-9, 3)[0], 0, "mod of a negative multiple is 0")
+    s.check_equal(run_powmod(5, 0, 7)[0], 1, "b^0 mod m = 1")
+    s.check_equal(run_powmod(5, 3, 1)[0], 0, "anything mod 1 = 0")
+    s.check_equal(run_powmod(0, 5, 7)[0], 0, "0^e mod m = 0")
+    s.check_equal(run_powmod(-2, 3, 5)[0], 2, "negative base is reduced first")
+    s.check_equal(run_powmod(2, 10 ** 30, 10 ** 9 + 7)[0], pow(2, 10 ** 30, 10 ** 9 + 7), "exponent far beyond what axp_powi could build")
+    for b, e, m in ((3, 2 ** 127 - 2, 2 ** 127 - 1), (12345678901234567890, 98765432109876543210, 10 ** 40 + 1), (7, 10 ** 50, 999999999999)):
+      got, expected, desc = run_powmod(b, e, m)
+      s.check_equal(got, expected, f"{desc} matches reference")
+    s.check_equal(run_gcd(0, 0)[0], 0, "gcd(0, 0) = 0")
+    s.check_equal(run_gcd(0, -15)[0], 15, "gcd(0, n) = |n|")
+    s.check_equal(run_gcd(-12, 18)[0], 6, "gcd ignores signs")
+    fib = [1, 1]
+    while len(fib) < 400: fib.append(fib[-1] + fib[-2])
+    s.check_equal(run_gcd(fib[-1], fib[-2])[0], 1, "consecutive Fibonacci numbers take the longest quotient chain")
+    s.check_equal(run_gcd(2 ** 400 * 3 ** 50, 6 ** 120)[0], math.gcd(2 ** 400 * 3 ** 50, 6 ** 120), "gcd of numbers sharing a large factor")
+    s.check_equal(run_lcm(0, 7)[0], 0, "lcm(0, n) = 0")
+    s.check_equal(run_lcm(-4, 6)[0], 12, "lcm is non-negative")
+    s.check_equal(run_gcdext(240, 46)[0], (2, 2), "gcdext satisfies the Bezout identity")
+    s.check_equal(run_gcdext(-240, 0)[0], (240, 240), "gcdext with a zero argument")
+    s.check_equal(run_gcdext(fib[-1], fib[-2])[0], (1, 1), "gcdext of consecutive Fibonacci numbers")
+    s.check_equal(run_factorial(0)[0], 1, "0! = 1")
+    s.check_equal(run_factorial(20)[0], math.factorial(20), "20! still fits a single leaf")
+    s.check_equal(run_factorial(21)[0], math.factorial(21), "21! takes the first swing")
+    s.check_equal(run_factorial(3000)[0], math.factorial(3000), "3000! by prime swing")
+    s.check_equal(run_binomial(5, 7)[0], 0, "C(n, k) = 0 for k > n")
+    s.check_equal(run_binomial(10, 0)[0], 1, "C(n, 0) = 1")
+    s.check_equal(run_binomial(1000, 500)[0], math.comb(1000, 500), "central binomial coefficient")
+    s.check_equal(run_binomial(2 ** 31, 2)[0], math.comb(2 ** 31, 2), "C(2^31, 2) without sieving up to n")
+    s.check_equal(run_binomial(2 ** 32 - 1, 2 ** 32 - 4)[0], math.comb(2 ** 32 - 1, 3), "C(n, n - 3) at the top of the size range")
+    s.check_equal(run_binomial(10 ** 6, 500)[0], math.comb(10 ** 6, 500), "binomial at the direct/sieve crossover")
+    s.check_equal(run_primorial(1)[0], 1, "1# = 1")
+    s.check_equal(run_primorial(100)[0], _primorial(100), "primorial of 100")
+    s.check_equal(run_rising(7, 0)[0], 1, "empty rising factorial is 1")
+    s.check_equal(run_rising(1, 500)[0], math.factorial(500), "rising(1, n) = n!")
+    s.check_equal(run_rising(-3, 5)[0], 0, "rising factorial through zero")
+    s.check_equal(run_rising(-7, 3)[0], -210, "rising factorial of a negative start")
+    s.check_equal(run_rising(10 ** 30, 20)[0], _rising(10 ** 30, 20), "rising factorial beyond the uint64 leaves")
 
+    s.fuzz("random_cmp", 10_000, lambda: random.choice([(gen_randomi(30), gen_randomi(30)), (lambda x: (x, -x))(gen_randomi(30))]), run_cmp)
     s.fuzz("random_add", 20_000, lambda: (gen_randomi(80), gen_randomi(80)), run_add)
     s.fuzz("random_sub", 20_000, lambda: (gen_randomi(80), gen_randomi(80)), run_sub)
     s.fuzz("random_mul", 20_000, lambda: (gen_randomi(80), gen_randomi(80)), run_mul)
     s.fuzz("random_div", 20_000, lambda: (gen_randomi(80), gen_nonzero_int(80)), run_div)
+    for digits in (AXP_MUL_LIMB_THRESHOLD, AXP_MUL_KARATSUBA_LIMBS * 8, AXP_MUL_KARATSUBA_LIMBS * 8 * 4 + 1):
+      s.check_equal(run_mul(10 ** digits - 1, 10 ** digits - 1)[0], (10 ** digits - 1) ** 2, f"all nines squared at {digits} digits")
+    s.fuzz("random_mul_tiers", 2_000, gen_mul_tier_arg, run_mul)
+    s.fuzz("random_mul_large", 500, lambda: (gen_randomi(random.choice([200, 3000])), gen_randomi(3000)), run_mul)
     s.fuzz("random_pow_small_exp", 20_000, lambda: (gen_randomi(3), random.randint(0, 20)), run_pow)
+    s.fuzz("random_isqrt", 5_000, lambda: [abs(gen_randomi(80))], run_isqrt)
+    s.fuzz("random_isqrt_long", 200, lambda: [abs(gen_randomi(2500))], run_isqrt)
+    s.fuzz("random_isqrt_long_square", 200, lambda: (lambda r: [r * r - random.randint(0, 1) + (r == 0)])(abs(gen_randomi(1200))), run_isqrt)
+    s.fuzz("random_pow_trailing_zeros", 5_000, lambda: (gen_randomi(3) * 10 ** random.randint(0, 6), random.randint(0, 60)), run_pow)
+    s.fuzz("random_mod", 20_000, lambda: (gen_randomi(80), gen_nonzero_int(40)), run_mod)
+    s.fuzz("random_powmod", 3_000, lambda: (gen_randomi(60), abs(gen_randomi(60)), gen_nonzero_int(50)), run_powmod)
+    s.fuzz("random_powmod_small_mod", 5_000, lambda: (gen_randomi(20), abs(gen_randomi(8)), gen_nonzero_int(2)), run_powmod)
+    s.fuzz("random_gcd", 10_000, lambda: (gen_randomi(80), gen_randomi(80)), run_gcd)
+    s.fuzz("random_gcd_long", 10, lambda: (lambda g: (gen_randomi(7000) * g, gen_randomi(7000) * g))(gen_randomi(3000)), run_gcd)
+    s.fuzz("random_gcd_common", 3_000, lambda: (lambda g: (gen_randomi(60) * g, gen_randomi(60) * g))(gen_randomi(40)), run_gcd)
+    s.fuzz("random_lcm", 5_000, lambda: (gen_randomi(50), gen_randomi(50)), run_lcm)
+    s.fuzz("random_gcdext", 5_000, lambda: (gen_randomi(80), gen_randomi(80)), run_gcdext)
+    s.fuzz("random_factorial", 300, lambda: [random.randint(0, 600)], run_factorial)
+    s.fuzz("random_binomial_small_k", 500, lambda: (lambda n: (n, random.choice([random.randint(0, 40), n - random.randint(0, 40)])))(random.randint(40, 10 ** 9)), run_binomial)
+    s.fuzz("random_binomial", 2_000, lambda: (lambda n: (n, random.randint(0, n + 2)))(random.randint(0, 400)), run_binomial)
+    s.fuzz("random_rising", 2_000, lambda: (gen_randomi(random.choice([3, 40])), random.randint(0, 60)), run_rising)
     s.fuzz("random_pow_large_base", 250, lambda: (gen_randomi(14), random.randint(0, 999)), run_pow)
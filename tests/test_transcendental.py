@@ -1,11 +1,25 @@
+import random
 from ctypes import byref
-from decimal import Decimal, getcontext, ROUND_HALF_UP, MAX_EMAX, MIN_EMIN, Context
+from decimal import Decimal, getcontext, ROUND_HALF_UP, ROUND_FLOOR, MAX_EMAX, MIN_EMIN, Context
 
 import framework
-from axp_bindings import AXP_Float, new_ctx, axp_e_ex, axp_expf, axp_lnf, axp_powff, axp_freef, str_to_axpf, axpf_to_str
+from axp_bindings import (
+  AXP_Float, AXP_CONST_E, AXP_CtxStats, AXP_ERR_OVERFLOW, new_ctx, axp_e_ex, axp_ln2_ex, axp_ln10_ex, axp_pi_ex,
+  axp_const_cache_free, axp_ctx_stats_get, axp_freef_ex, axp_expf, axp_lnf,
+  axp_log10f, axp_log2f, axp_logbf, axp_powff, axp_powff_ex, axp_sinf, axp_sinf_ex, axp_cosf, axp_tanf, axp_atanf,
+  axp_freef, str_to_axpf, axpf_to_str,
+)
 from helpers import gen_randomf
 
 ctx = new_ctx(precision=16)
+long_ctx = new_ctx(precision=120)
+agm_ctx = new_ctx(precision=60)
+agm_ctx.ln_agm_threshold = 1  # force the AGM path at every precision
+agm_long_ctx = new_ctx(precision=2000)  # the default threshold takes the AGM from 1000 working digits
+retry_ctx = new_ctx(precision=16)
+retry_ctx.ziv_safety_digits = 1  # most attempts are ambiguous, retries resume the previous one
+long_retry_ctx = new_ctx(precision=120)
+long_retry_ctx.ziv_safety_digits = 1
 _REF_GUARD_PREC = 50
 
 getcontext().Emax = MAX_EMAX
@@ -27,6 +41,26 @@ def run_e_check(prec):
   expected = _correctly_rounded(lambda: Decimal(1).exp(), prec)
   return got, expected, "e"
 
+def _decimal_pi():
+  # Machin's formula evaluated in the current Decimal context
+  def arctan_inv(x):
+    x2, term, total, k = x * x, Decimal(1) / x, Decimal(0), 0
+    eps = Decimal(10) ** -(getcontext().prec + 2)
+    while term > eps:
+      total += term / (2 * k + 1) if k % 2 == 0 else -term / (2 * k + 1)
+      term /= x2
+      k += 1
+    return total
+  return 16 * arctan_inv(5) - 4 * arctan_inv(239)
+
+def run_const_check(fn, reference, prec, c=None):
+  c = c or ctx
+  ar = AXP_Float()
+  fn(byref(c), byref(ar), prec)
+  got = Decimal(axpf_to_str(c, ar))
+  axp_freef_ex(byref(c), byref(ar))
+  return got, _correctly_rounded(reference, prec)
+
 def run_expf(x_str):
   ax, ar = str_to_axpf(ctx, x_str), AXP_Float()
   axp_expf(byref(ctx), byref(ax), byref(ar))
@@ -35,6 +69,41 @@ def run_expf(x_str):
   expected = _correctly_rounded(lambda: Decimal(x_str).exp(), ctx.precision)
   return got, expected, f"e^{x_str}"
 
+def run_expf_long(x_str):
+  # Full length arguments take the 2^k reduction + rectangular splitting path
+  ax, ar = str_to_axpf(long_ctx, x_str), AXP_Float()
+  axp_expf(byref(long_ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(long_ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: Decimal(x_str).exp(), long_ctx.precision)
+  return got, expected, f"e^{x_str}"
+
+def run_expf_retry(x_str, retry=retry_ctx):
+  ax, ar = str_to_axpf(retry, x_str), AXP_Float()
+  axp_expf(byref(retry), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(retry, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: Decimal(x_str).exp(), retry.precision)
+  return got, expected, f"e^{x_str} with retries"
+
+def run_expf_huge(x_str):
+  # The result exponent is past what Decimal can hold, so compare e^x = m * 10^i with i = floor(x / ln 10)
+  ax, ar = str_to_axpf(ctx, x_str), AXP_Float()
+  ok = axp_expf(byref(ctx), byref(ax), byref(ar))
+  mant, _, exp = axpf_to_str(ctx, ar).partition("e") if ok else ("", "", "0")
+  axp_freef(byref(ax))
+  if ok: axp_freef(byref(ar))
+  c = Context(prec=80, rounding=ROUND_HALF_UP, Emax=MAX_EMAX, Emin=MIN_EMIN)
+  q = c.divide(Decimal(x_str), c.ln(Decimal(10)))
+  i = q.to_integral_value(rounding=ROUND_FLOOR)
+  m = Context(prec=ctx.precision, rounding=ROUND_HALF_UP).plus(c.power(Decimal(10), c.subtract(q, i)))
+  return (Decimal(mant) if ok else None, int(exp)), (m, int(i)), f"e^{x_str}"
+
+def gen_long_exp_arg():
+  sign = random.choice(["", "-"])
+  frac = "".join(random.choice("0123456789") for _ in range(random.randint(100, 116)))
+  return [f"{sign}{random.randint(0, 300)}.{frac}"]
+
 def run_lnf(x_str):
   ax, ar = str_to_axpf(ctx, x_str), AXP_Float()
   axp_lnf(byref(ctx), byref(ax), byref(ar))
@@ -43,6 +112,58 @@ def run_lnf(x_str):
   expected = _correctly_rounded(lambda: Decimal(x_str).ln(), ctx.precision)
   return got, expected, f"ln({x_str})"
 
+def run_lnf_retry(x_str):
+  ax, ar = str_to_axpf(retry_ctx, x_str), AXP_Float()
+  axp_lnf(byref(retry_ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(retry_ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: Decimal(x_str).ln(), retry_ctx.precision)
+  return got, expected, f"ln({x_str}) with retries"
+
+def run_lnf_agm(x_str):
+  ax, ar = str_to_axpf(agm_ctx, x_str), AXP_Float()
+  axp_lnf(byref(agm_ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(agm_ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: Decimal(x_str).ln(), agm_ctx.precision)
+  return got, expected, f"agm ln({x_str})"
+
+def run_lnf_agm_long(x_str, precision):
+  agm_long_ctx.precision = precision
+  ax, ar = str_to_axpf(agm_long_ctx, x_str), AXP_Float()
+  x_str = axpf_to_str(agm_long_ctx, ax)
+  axp_lnf(byref(agm_long_ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(agm_long_ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: Decimal(x_str).ln(), precision)
+  return got, expected, f"agm ln({x_str[:40]}...) at {precision} digits"
+
+def gen_agm_long_arg():
+  precision = random.choice([1000, 2000])
+  digits = "".join(random.choice("0123456789") for _ in range(random.choice([3, precision - 1])))
+  return (f"{random.randint(1, 9)}.{digits}e{random.randint(-30, 30)}", precision)
+
+def run_logf(fn, x_str, reference, desc):
+  ax, ar = str_to_axpf(ctx, x_str), AXP_Float()
+  fn(byref(ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  return got, _correctly_rounded(reference, ctx.precision), desc
+
+def run_log10f(x_str):
+  return run_logf(axp_log10f, x_str, lambda: Decimal(x_str).log10(), f"log10({x_str})")
+
+def run_log2f(x_str):
+  return run_logf(axp_log2f, x_str, lambda: Decimal(x_str).ln() / Decimal(2).ln(), f"log2({x_str})")
+
+def run_logbf(x_str, b_str):
+  ax, ab, ar = str_to_axpf(ctx, x_str), str_to_axpf(ctx, b_str), AXP_Float()
+  axp_logbf(byref(ctx), byref(ax), byref(ab), byref(ar))
+  got = Decimal(axpf_to_str(ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ab)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: Decimal(x_str).ln() / Decimal(b_str).ln(), ctx.precision)
+  return got, expected, f"log_{b_str}({x_str})"
+
 def run_powff(x_str, y_str):
   ax, ay, ar = str_to_axpf(ctx, x_str), str_to_axpf(ctx, y_str), AXP_Float()
   axp_powff(byref(ctx), byref(ax), byref(ay), byref(ar))
@@ -55,11 +176,102 @@ def run_powff(x_str, y_str):
   expected = big_ctx.plus(expected_full)
   return got, expected, f"{x_str} ** {y_str}"
 
+def _decimal_sin_cos(x):
+  # Reduce modulo pi/2 with the digits of x added to the context, then the Taylor series of both
+  prec = getcontext().prec
+  getcontext().prec = prec + max(0, x.adjusted() + 1) + 10
+  half_pi = _decimal_pi() / 2
+  k = int((x / half_pi).to_integral_value())
+  r = x - k * half_pi
+  getcontext().prec = prec + 10
+  s, c, term, i = r, Decimal(1), r, 1
+  while True:
+    term = -term * r * r / ((2 * i) * (2 * i + 1))
+    if abs(term) < Decimal(10) ** -(prec + 20): break
+    s += term
+    i += 1
+  term, i = Decimal(1), 1
+  while True:
+    term = -term * r * r / ((2 * i - 1) * (2 * i))
+    if abs(term) < Decimal(10) ** -(prec + 20): break
+    c += term
+    i += 1
+  getcontext().prec = prec
+  return [(s, c), (c, -s), (-s, -c), (-c, s)][k % 4]
+
+def _decimal_atan(x):
+  prec = getcontext().prec
+  getcontext().prec = prec + 10
+  if abs(x) > 1:
+    res = (_decimal_pi() / 2 - _decimal_atan(1 / abs(x))).copy_sign(x)
+    getcontext().prec = prec
+    return +res
+  a = x
+  for _ in range(4): a = a / (1 + (1 + a * a).sqrt())
+  total, power, i = a, a, 1
+  while True:
+    power = -power * a * a
+    term = power / (2 * i + 1)
+    if abs(term) < Decimal(10) ** -(prec + 20): break
+    total += term
+    i += 1
+  getcontext().prec = prec
+  return 16 * total
+
+def run_trigf(name, x_str):
+  fn, ref = {
+    "sin": (axp_sinf, lambda x: _decimal_sin_cos(x)[0]),
+    "cos": (axp_cosf, lambda x: _decimal_sin_cos(x)[1]),
+    "tan": (axp_tanf, lambda x: _decimal_sin_cos(x)[0] / _decimal_sin_cos(x)[1]),
+    "atan": (axp_atanf, _decimal_atan),
+  }[name]
+  ax, ar = str_to_axpf(ctx, x_str), AXP_Float()
+  fn(byref(ctx), byref(ax), byref(ar))
+  got = Decimal(axpf_to_str(ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  expected = _correctly_rounded(lambda: ref(Decimal(x_str)), ctx.precision)
+  return got, expected, f"{name}({x_str})"
+
+def run_sinf_prec(x_str, prec):
+  ax, ar = str_to_axpf(long_ctx, x_str), AXP_Float()
+  axp_sinf_ex(byref(long_ctx), byref(ax), byref(ar), prec)
+  got = Decimal(axpf_to_str(long_ctx, ar))
+  axp_freef(byref(ax)); axp_freef(byref(ar))
+  return got, _correctly_rounded(lambda: _decimal_sin_cos(Decimal(x_str))[0], prec)
+
 def run(report):
   with framework.Suite("transcendental", report) as s:
     # e
     got, expected, _ = run_e_check(50)
     s.check_equal(got, expected, "e to 50 digits matches Decimal(1).exp()")
+    for prec in (1, 5, 1000):
+      got, expected, _ = run_e_check(prec)
+      s.check_equal(got, expected, f"e to {prec} digits via binary splitting matches Decimal(1).exp()")
+
+    # cached constants
+    for prec in (1, 50, 500):
+      got, expected = run_const_check(axp_ln2_ex, lambda: Decimal(2).ln(), prec)
+      s.check_equal(got, expected, f"ln 2 to {prec} digits matches Decimal(2).ln()")
+      got, expected = run_const_check(axp_ln10_ex, lambda: Decimal(10).ln(), prec)
+      s.check_equal(got, expected, f"ln 10 to {prec} digits matches Decimal(10).ln()")
+      got, expected = run_const_check(axp_pi_ex, _decimal_pi, prec)
+      s.check_equal(got, expected, f"pi to {prec} digits by Chudnovsky matches Machin's formula")
+
+    cache_ctx = new_ctx(precision=16)
+    entry = cache_ctx.constants[AXP_CONST_E]
+    run_const_check(axp_e_ex, lambda: Decimal(1).exp(), 200, cache_ctx)
+    cached_prec, cached_terms = entry.precision, entry.series[0].terms
+    s.check(cached_prec > 200, "e cache holds more than the requested digits", f"got {cached_prec}")
+    got, expected = run_const_check(axp_e_ex, lambda: Decimal(1).exp(), 120, cache_ctx)
+    s.check_equal(got, expected, "lower precision request is served from the cache")
+    s.check_equal(entry.precision, cached_prec, "lower precision request does not recompute e")
+    got, expected = run_const_check(axp_e_ex, lambda: Decimal(1).exp(), 400, cache_ctx)
+    s.check_equal(got, expected, "higher precision request extends the cache")
+    s.check(entry.series[0].terms > cached_terms, "extending the cache adds series terms", f"got {entry.series[0].terms}")
+    axp_const_cache_free(byref(cache_ctx))
+    stats = AXP_CtxStats()
+    axp_ctx_stats_get(byref(cache_ctx), byref(stats))
+    s.check_equal(stats.bytes_live, 0, "axp_const_cache_free releases every cached digit")
 
     # exp edge cases
     s.check_equal(run_expf("0.0")[0], Decimal("1.000000000000000"), "e^0 = 1")
@@ -68,6 +280,15 @@ def run(report):
     got, expected, _ = run_expf("2.0")
     s.check_equal(got, expected, "e^2 matches reference")
 
+    # the argument is only bounded by the exponent range of the result, about ln(10) * AXP_EXP_MAX
+    for x_str in ("1e18", "5.5e18", "-1.2345e19", "2.1e19"):
+      got, expected, desc = run_expf_huge(x_str)
+      s.check_equal(got, expected, f"{desc} near the exponent limit matches reference")
+    ax, ar = str_to_axpf(ctx, "-2.2e19"), AXP_Float()
+    s.check(not axp_expf(byref(ctx), byref(ax), byref(ar)) and ctx.err == AXP_ERR_OVERFLOW,
+            "e^x past the exponent range overflows")
+    axp_freef(byref(ax))
+
     # ln edge cases
     s.check_equal(run_lnf("1.0")[0], Decimal("0"), "ln(1) = 0")
     got, expected, _ = run_lnf("10.0")
@@ -81,6 +302,30 @@ def run(report):
     got, expected, _ = run_lnf(e_str)
     s.check(abs(got - Decimal(1)) < Decimal("1e-14"), "ln(e) is approximately 1", f"got {got}")
 
+    for x_str in ("1e-300", "3.7e280", "0.31", "3.2", "99999.99"):
+      got, expected, desc = run_lnf(x_str)
+      s.check_equal(got, expected, f"{desc} via decimal exponent reduction matches reference")
+
+    # log10, log2, logb
+    s.check_equal(run_log10f("1000.0")[0], Decimal(3), "log10(1000) = 3 exactly")
+    s.check_equal(run_log10f("1e-250")[0], Decimal(-250), "log10(1e-250) = -250 exactly")
+    s.check_equal(run_log2f("1.0")[0], Decimal(0), "log2(1) = 0")
+    s.check_equal(run_log2f("1024.0")[0], Decimal(10), "log2(1024) = 10")
+    s.check_equal(run_logbf("343.0", "7.0")[0], Decimal(3), "log_7(343) = 3")
+    s.check_equal(run_logbf("0.001", "100.0")[0], Decimal("-1.5"), "log_100(0.001) = -1.5")
+    got, expected, _ = run_log10f("2.0")
+    s.check_equal(got, expected, "log10(2) matches reference")
+    ax, ab, ar = str_to_axpf(ctx, "5.0"), str_to_axpf(ctx, "1.0"), AXP_Float()
+    s.check(not axp_logbf(byref(ctx), byref(ax), byref(ab), byref(ar)), "log base 1 is rejected")
+    axp_freef(byref(ax)); axp_freef(byref(ab))
+
+    # AGM ln
+    s.check_equal(run_lnf_agm("1.0")[0], Decimal("0"), "AGM ln(1) = 0")
+    for x_str in ("2.0", "0.5", "10.0", "1.00000000000000000000000000000000000001", "0.99999999999999999999", "1e-300", "7.5e250"):
+      got, expected, desc = run_lnf_agm(x_str)
+      s.check_equal(got, expected, f"{desc} matches reference")
+    s.fuzz("random_ln_agm_long", 12, gen_agm_long_arg, run_lnf_agm_long)
+
     # powff edge cases
     s.check_equal(run_powff("2.0", "0.0")[0], Decimal("1.000000000000000"), "x^0 = 1")
     s.check_equal(run_powff("1.0", "3.5")[0], Decimal("1.000000000000000"), "1^y = 1")
@@ -88,6 +333,8 @@ def run(report):
     s.check_equal(got, expected, "2^0.5 = sqrt(2), matches reference")
     got, expected, _ = run_powff("4.0", "0.5")
     s.check_equal(got, Decimal("2.000000000000000"), "4^0.5 = 2 exactly")
+    s.check_equal(run_powff("1e-300", "1.5")[0], Decimal("1e-450"), "(1e-300)^1.5 through an exact tiny square root")
+    s.check_equal(run_powff("2.25e-100", "0.5")[0], Decimal("1.5e-50"), "(2.25e-100)^0.5 through an exact tiny square root")
     got, expected, _ = run_powff("8.0", "0.3333333333333333")
     s.check(abs(got - Decimal(2)) < Decimal("1e-10"), "8^(1/3) is approximately 2", f"got {got}")
     got, expected, _ = run_powff("2.0", "10.0")  # integer-valued y -> exact delegation path
@@ -96,9 +343,59 @@ def run(report):
     s.check_equal(got, Decimal("0.125000000000000"), "2^-3 via the integer-exponent delegation path")
     got, expected, _ = run_powff("-2.0", "3.0")
     s.check_equal(got, Decimal("-8.00000000000000"), "negative base with integer exponent works")
+    got, expected, _ = run_powff("6.25", "1.5")
+    s.check_equal(got, Decimal("15.62500000000000"), "6.25^1.5 is exact through the square root path")
+    got, expected, _ = run_powff("81.0", "-0.25")
+    s.check_equal(got, expected, "81^-0.25 through the root path matches reference")
+    got, expected, _ = run_powff("0.0314", "-0.004")
+    s.check_equal(got, expected, "1/n root with a negative numerator keeps the exponent")
+    for x_str, y_str, exact in (("16.0", "0.75", "8"), ("1024.0", "0.3", "8"), ("0.0016", "-0.25", "5"),
+                                ("2.25", "-1.5", "0.2962962962962963"), ("12.0", "5.0", "248832")):
+      s.check_equal(run_powff(x_str, y_str)[0], Decimal(exact), f"{x_str} ** {y_str} = {exact} exactly")
+    ax, ay, ar = str_to_axpf(ctx, "6.25"), str_to_axpf(ctx, "1.5"), AXP_Float()
+    axp_powff_ex(byref(ctx), byref(ax), byref(ay), byref(ar), 4)
+    s.check_equal(Decimal(axpf_to_str(ctx, ar)), Decimal("15.63"), "exact power on a rounding midpoint rounds half up")
+    axp_freef(byref(ax)); axp_freef(byref(ay)); axp_freef(byref(ar))
+
+    # trig edge cases
+    s.check_equal(run_trigf("sin", "0.0")[0], Decimal(0), "sin 0 = 0")
+    s.check_equal(run_trigf("cos", "0.0")[0], Decimal(1), "cos 0 = 1")
+    s.check_equal(run_trigf("atan", "0.0")[0], Decimal(0), "atan 0 = 0")
+    got, expected = run_const_check(axp_pi_ex, _decimal_pi, 16)
+    s.check_equal(run_trigf("atan", "1.0")[0] * 4, expected, "4 atan 1 = pi")
+    for name, x_str in (("sin", "3.141592653589793"), ("cos", "1.570796326794897"), ("tan", "1.570796326794897"),
+                        ("sin", "1e22"), ("cos", "-1e22"), ("sin", "1e-30"), ("atan", "1e30"), ("atan", "-0.5")):
+      got, expected, desc = run_trigf(name, x_str)
+      s.check_equal(got, expected, f"{desc} matches reference")
+    for prec in (50, 500):
+      got, expected = run_sinf_prec("12345.678", prec)
+      s.check_equal(got, expected, f"sin(12345.678) to {prec} digits matches reference")
 
     s.fuzz("random_exp", 5_000, lambda: [gen_randomf(3, 2)], run_expf)
+    s.fuzz("random_exp_long", 300, gen_long_exp_arg, run_expf_long)
+    for x_str in ("73.3", "-6.4"):
+      got, expected, desc = run_expf_retry(x_str)
+      s.check_equal(got, expected, f"{desc} matches reference")
+    s.fuzz("random_exp_retry", 2_000, lambda: [gen_randomf(3, 2)], run_expf_retry)
+    s.fuzz("random_exp_long_retry", 200, gen_long_exp_arg, lambda x_str: run_expf_retry(x_str, long_retry_ctx))
     s.fuzz("random_ln", 20_000, lambda: [gen_randomf(5, 30, only_pos=True)], run_lnf)
+    s.fuzz("random_log10", 3_000, lambda: [gen_randomf(5, 300, only_pos=True)], run_log10f)
+    s.fuzz("random_log2", 3_000, lambda: [gen_randomf(5, 300, only_pos=True)], run_log2f)
+    s.fuzz(
+      "random_logb", 1_000,
+      lambda: (gen_randomf(5, 30, only_pos=True), random.choice(["2.0", "3.0", "7.0", "16.0", "0.5", "1.5", "1000.0"])),
+      run_logbf,
+    )
+    s.fuzz("random_ln_retry", 3_000, lambda: [gen_randomf(5, 30, only_pos=True)], run_lnf_retry)
+    s.fuzz("random_ln_agm", 1_000, lambda: [gen_randomf(60, 80, only_pos=True)], run_lnf_agm)
+    for name in ("sin", "cos", "tan", "atan"):
+      s.fuzz(f"random_{name}", 2_000, lambda: [gen_randomf(8, 6)], lambda x_str, name=name: run_trigf(name, x_str))
+    s.fuzz("random_sin_large", 500, lambda: [gen_randomf(16, 40)], lambda x_str: run_trigf("sin", x_str))
+    s.fuzz(
+      "random_powff_rational", 2_000,
+      lambda: (gen_randomf(5, 6, only_pos=True), str(Decimal(random.randint(-40, 40) or 1) / random.choice([2, 4, 5, 8, 20, 25, 125]))),
+      run_powff,
+    )
     s.fuzz(
       "random_powff", 3_000,
       lambda: (gen_randomf(5, 15, only_pos=True), gen_randomf(4, 3)),